@@ -0,0 +1,215 @@
+#include <pathfinder/gpu_mem/allocator.h>
+#include <pathfinder/prelude.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Churns allocations through GpuMemoryAllocator on the null device, which creates no GPU objects,
+// so the timings are the bookkeeping cost of the allocator alone.
+
+using namespace Pathfinder;
+
+// Idle objects created before measuring, so that acquiring from the idle pool has plenty to choose from.
+constexpr uint32_t WARM_UP_BUFFER_COUNT = 4096;
+constexpr uint32_t WARM_UP_TEXTURE_COUNT = 512;
+
+constexpr uint32_t BUFFERS_PER_FRAME = 1000;
+constexpr uint32_t TEXTURES_PER_FRAME = 100;
+constexpr uint32_t BUFFER_RANGES_PER_FRAME = 500;
+
+// Objects are freed after up to this many frames.
+constexpr uint32_t MAX_LIFETIME_FRAMES = 3;
+
+constexpr uint32_t DEFAULT_FRAME_COUNT = 200;
+
+struct LiveObject {
+    enum class Kind {
+        Buffer,
+        Texture,
+        BufferRange,
+    } kind;
+    uint64_t id;
+};
+
+class ChurnBenchmark {
+public:
+    explicit ChurnBenchmark(uint32_t seed)
+        : device_(std::make_shared<DeviceNull>(2)),
+          allocator_(std::make_shared<GpuMemoryAllocator>(device_)),
+          random_(seed),
+          lifetimes_(MAX_LIFETIME_FRAMES + 1) {}
+
+    void warm_up() {
+        begin_frame();
+
+        std::vector<LiveObject> objects;
+        for (uint32_t i = 0; i < WARM_UP_BUFFER_COUNT; i++) {
+            objects.push_back(allocate_buffer());
+        }
+        for (uint32_t i = 0; i < WARM_UP_TEXTURE_COUNT; i++) {
+            objects.push_back(allocate_texture());
+        }
+        for (auto &object : objects) {
+            free_object(object);
+        }
+
+        // Let the freed objects become idle.
+        for (int i = 0; i < device_->get_frames_in_flight() + 1; i++) {
+            begin_frame();
+        }
+    }
+
+    void run_frame() {
+        auto t0 = std::chrono::steady_clock::now();
+        begin_frame();
+        auto t1 = std::chrono::steady_clock::now();
+
+        auto &due = lifetimes_[frame_ % lifetimes_.size()];
+        for (auto &object : due) {
+            free_object(object);
+        }
+        free_count_ += due.size();
+        due.clear();
+        auto t2 = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < BUFFERS_PER_FRAME; i++) {
+            keep(allocate_buffer());
+        }
+        for (uint32_t i = 0; i < TEXTURES_PER_FRAME; i++) {
+            keep(allocate_texture());
+        }
+        for (uint32_t i = 0; i < BUFFER_RANGES_PER_FRAME; i++) {
+            keep(allocate_buffer_range());
+        }
+        auto t3 = std::chrono::steady_clock::now();
+
+        allocator_->purge_if_needed();
+
+        auto stats = allocator_->get_stats();
+        created_ += stats.last_frame_churn.created;
+        reused_ += stats.last_frame_churn.reused;
+
+        begin_frame_time_ += std::chrono::duration<double, std::milli>(t1 - t0).count();
+        free_time_ += std::chrono::duration<double, std::milli>(t2 - t1).count();
+        allocate_time_ += std::chrono::duration<double, std::milli>(t3 - t2).count();
+        allocation_count_ += BUFFERS_PER_FRAME + TEXTURES_PER_FRAME + BUFFER_RANGES_PER_FRAME;
+
+        frame_++;
+    }
+
+    void print_results(uint32_t frame_count) const {
+        auto stats = allocator_->get_stats();
+        auto &device_stats = device_->get_stats();
+
+        printf("frames: %u\n", frame_count);
+        printf("allocate: %.1f ns per object\n", allocate_time_ * 1e6 / (double)allocation_count_);
+        printf("free: %.1f ns per object\n", free_count_ ? free_time_ * 1e6 / (double)free_count_ : 0.0);
+        printf("begin frame: %.3f ms per frame\n", begin_frame_time_ / frame_count);
+        printf("reused: %.1f%% (%zu created, %zu reused)\n",
+               created_ + reused_ ? 100.0 * (double)reused_ / (double)(created_ + reused_) : 0.0,
+               created_,
+               reused_);
+        printf("idle: %zu buffers, %zu textures\n", stats.idle_buffers.count, stats.idle_textures.count);
+        printf("device: %llu buffers and %llu textures created, peak %zu bytes allocated\n",
+               (unsigned long long)device_stats.buffers_created,
+               (unsigned long long)device_stats.textures_created,
+               stats.peak_bytes_allocated);
+    }
+
+private:
+    void begin_frame() {
+        device_->begin_frame();
+        allocator_->begin_frame();
+    }
+
+    LiveObject allocate_buffer() {
+        static const BufferType types[] = {BufferType::Vertex, BufferType::Uniform, BufferType::Storage};
+        static const BufferUsage usages[] = {BufferUsage::Streaming, BufferUsage::Static, BufferUsage::GpuOnly};
+
+        // From 128 bytes to 1 MB, skewed towards small sizes like real frames.
+        auto size = (size_t)128 << std::min(pick(14), pick(14));
+
+        auto id = allocator_->allocate_buffer(size, types[pick(3)], "benchmark buffer", usages[pick(3)]);
+        return {LiveObject::Kind::Buffer, id};
+    }
+
+    LiveObject allocate_texture() {
+        static const TextureFormat formats[] = {TextureFormat::Rgba8Unorm, TextureFormat::Rgba16Float};
+
+        // Render targets come in many exact sizes.
+        Vec2I size(16 * (1 + pick(32)), 16 * (1 + pick(16)));
+
+        auto id = allocator_->allocate_texture(size, formats[pick(2)], "benchmark texture");
+        return {LiveObject::Kind::Texture, id};
+    }
+
+    LiveObject allocate_buffer_range() {
+        auto size = (size_t)16 << pick(9);
+
+        auto id = allocator_->allocate_buffer_range(size, BufferType::Uniform, "benchmark buffer range");
+        return {LiveObject::Kind::BufferRange, id};
+    }
+
+    void free_object(const LiveObject &object) {
+        switch (object.kind) {
+            case LiveObject::Kind::Buffer:
+                allocator_->free_buffer(object.id);
+                break;
+            case LiveObject::Kind::Texture:
+                allocator_->free_texture(object.id);
+                break;
+            case LiveObject::Kind::BufferRange:
+                allocator_->free_buffer_range(object.id);
+                break;
+        }
+    }
+
+    void keep(const LiveObject &object) {
+        auto lifetime = 1 + pick(MAX_LIFETIME_FRAMES);
+        lifetimes_[(frame_ + lifetime) % lifetimes_.size()].push_back(object);
+    }
+
+    /// Uniform in [0, count).
+    uint32_t pick(uint32_t count) {
+        return std::uniform_int_distribution<uint32_t>(0, count - 1)(random_);
+    }
+
+    std::shared_ptr<DeviceNull> device_;
+    std::shared_ptr<GpuMemoryAllocator> allocator_;
+
+    std::mt19937 random_;
+
+    /// Objects to free, indexed by frame.
+    std::vector<std::vector<LiveObject>> lifetimes_;
+
+    uint32_t frame_ = 0;
+
+    double begin_frame_time_ = 0, free_time_ = 0, allocate_time_ = 0;
+    size_t allocation_count_ = 0, free_count_ = 0;
+    size_t created_ = 0, reused_ = 0;
+};
+
+int main(int argc, char **argv) {
+    uint32_t frame_count = argc > 1 ? (uint32_t)std::atoi(argv[1]) : DEFAULT_FRAME_COUNT;
+    if (frame_count == 0) {
+        printf("Usage: %s [frame count]\n", argv[0]);
+        return 1;
+    }
+
+    Logger::set_global_level(Logger::Level::Warn);
+
+    ChurnBenchmark benchmark(1);
+
+    benchmark.warm_up();
+
+    for (uint32_t i = 0; i < frame_count; i++) {
+        benchmark.run_frame();
+    }
+
+    benchmark.print_results(frame_count);
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Pathfinder {
+
+/// Run `task(index)` for every index in [0, count), split into contiguous chunks over at most `max_threads` threads.
+template <typename F>
+void parallel_for(uint32_t count, uint32_t max_threads, const F &task) {
+#ifdef __EMSCRIPTEN__
+    for (uint32_t i = 0; i < count; i++) {
+        task(i);
+    }
+#else
+    uint32_t threads_count = std::min(count, max_threads);
+
+    if (threads_count <= 1) {
+        for (uint32_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(threads_count);
+
+    for (uint32_t t = 0; t < threads_count; t++) {
+        uint32_t begin = uint64_t(count) * t / threads_count;
+        uint32_t end = uint64_t(count) * (t + 1) / threads_count;
+
+        threads.emplace_back([&task, begin, end] {
+            for (uint32_t i = begin; i < end; i++) {
+                task(i);
+            }
+        });
+    }
+
+    for (auto &t : threads) {
+        t.join();
+    }
+#endif
+}
+
+} // namespace Pathfinder
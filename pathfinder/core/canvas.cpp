@@ -154,16 +154,19 @@ Canvas::Canvas(Vec2I size,
                const std::shared_ptr<Device> &_device,
                const std::shared_ptr<Queue> &_queue,
                RenderMode _render_mode)
-    : device(_device), render_mode(_render_mode) {
+    : Canvas(size, std::make_shared<RendererContext>(_device, _queue), _render_mode) {}
+
+Canvas::Canvas(Vec2I size, const std::shared_ptr<RendererContext> &context, RenderMode _render_mode)
+    : device(context->device), render_mode(_render_mode) {
     // Create the renderer and scene builder.
     if (render_mode == RenderMode::Hybrid) {
         Logger::info("Created new canvas using Raster render mode");
-        renderer = std::make_shared<RendererD3D9>(device, _queue);
+        renderer = std::make_shared<RendererD3D9>(context);
         scene_builder = std::make_shared<SceneBuilderD3D9>();
     } else {
 #ifdef PATHFINDER_ENABLE_COMPUTE
         Logger::info("Created new canvas using Compute render mode");
-        renderer = std::make_shared<RendererD3D11>(device, _queue);
+        renderer = std::make_shared<RendererD3D11>(context);
         scene_builder = std::make_shared<SceneBuilderD3D11>();
 #else
         throw std::runtime_error(std::string("Pathfinder Compute mode is selected but not enabled!"));
@@ -566,6 +569,18 @@ void Canvas::draw(bool clear_dst_texture) {
     renderer->reset();
 }
 
+std::shared_ptr<RendererContext> Canvas::get_renderer_context() const {
+    return renderer->context;
+}
+
+void Canvas::set_memory_budget(size_t budget) {
+    renderer->set_memory_budget(budget);
+}
+
+GpuMemoryStats Canvas::get_memory_stats() const {
+    return renderer->get_memory_stats();
+}
+
 void Canvas::set_scene(const std::shared_ptr<Scene> &new_scene) {
     if (!new_scene) {
         Logger::warn("Attempted to set a NULL scene!");
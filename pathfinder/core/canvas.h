@@ -48,11 +48,19 @@ enum class PathOp {
 /// Normally, we only need one canvas to render multiple scenes.
 class Canvas {
 public:
+    /// Create a canvas with a renderer context of its own.
     Canvas(Vec2I size,
            const std::shared_ptr<Device> &_device,
            const std::shared_ptr<Queue> &_queue,
            RenderMode _render_mode);
 
+    /// Create a canvas sharing pipelines, static resources and GPU memory with other canvases of the context.
+    /// Cheaper than creating a canvas with a new context, e.g. for one canvas per document or thumbnail.
+    Canvas(Vec2I size, const std::shared_ptr<RendererContext> &context, RenderMode _render_mode);
+
+    /// To create other canvases sharing it.
+    std::shared_ptr<RendererContext> get_renderer_context() const;
+
     /// Set the final render target.
     void set_dst_texture(const std::shared_ptr<Texture> &new_dst_texture);
 
@@ -176,6 +184,12 @@ public:
 
     void draw(bool clear_dst_texture);
 
+    /// Limit the GPU memory held by all canvases of the renderer context. Zero means no limit.
+    void set_memory_budget(size_t budget);
+
+    /// Memory of all canvases of the renderer context.
+    GpuMemoryStats get_memory_stats() const;
+
     // Extensions
 
     Pattern create_pattern_from_canvas(Canvas &canvas, const Transform2 &transform);
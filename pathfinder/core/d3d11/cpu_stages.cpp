@@ -0,0 +1,825 @@
+#include "cpu_stages.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "../../common/io.h"
+#include "../../common/parallel.h"
+#include "../../shaders/generated/area_lut_png.h"
+#include "../renderer.h"
+
+#ifdef PATHFINDER_ENABLE_COMPUTE
+
+namespace Pathfinder {
+
+constexpr uint32_t CPU_STAGE_THREADS = 4;
+
+// Keep these in sync with the shaders.
+constexpr uint32_t TILE_FIELD_NEXT_TILE_ID = 0;
+constexpr uint32_t TILE_FIELD_FIRST_FILL_ID = 1;
+constexpr uint32_t TILE_FIELD_BACKDROP_ALPHA_TILE_ID = 2;
+constexpr uint32_t TILE_FIELD_CONTROL = 3;
+
+constexpr uint32_t MAX_ITERATIONS = 1024;
+
+constexpr float DICE_TOLERANCE = 0.25f;
+constexpr float DICE_MICROLINE_LENGTH = 16.0f;
+
+static_assert(sizeof(TileD3D11) == 4 * sizeof(uint32_t), "TileD3D11 must be four words!");
+static_assert(sizeof(PropagateMetadataD3D11) == 12 * sizeof(uint32_t), "PropagateMetadataD3D11 must be three uvec4s!");
+
+/// Binary search used by dice.comp and bound.comp to find the path an invocation belongs to.
+template <typename T, typename G>
+uint32_t find_path_index(const std::vector<T> &paths, uint32_t index, const G &get_first_index) {
+    uint32_t low_path_index = 0, high_path_index = paths.size();
+    int iteration = 0;
+    while (iteration < 1024 && low_path_index + 1 < high_path_index) {
+        uint32_t mid_path_index = low_path_index + (high_path_index - low_path_index) / 2;
+        uint32_t mid_index = get_first_index(paths[mid_path_index]);
+        if (index < mid_index) {
+            high_path_index = mid_path_index;
+        } else {
+            low_path_index = mid_path_index;
+            if (index == mid_index) {
+                break;
+            }
+        }
+        iteration++;
+    }
+    return low_path_index;
+}
+
+inline uint32_t *tile_words(std::vector<TileD3D11> &tiles) {
+    return reinterpret_cast<uint32_t *>(tiles.data());
+}
+
+inline const uint32_t *tile_words(const std::vector<TileD3D11> &tiles) {
+    return reinterpret_cast<const uint32_t *>(tiles.data());
+}
+
+/// Sign-extend the lower 24 bits.
+inline int32_t unpack_alpha_tile_id(uint32_t word) {
+    return int32_t(word << 8) >> 8;
+}
+
+inline bool is_hidden_by_even_odd(uint32_t tile_word, int32_t backdrop) {
+    int32_t tile_ctrl = int32_t((tile_word >> 16) & 0xffu);
+    int32_t mask_ctrl = (tile_ctrl >> TILE_CTRL_MASK_0_SHIFT) & 0x3;
+    return (mask_ctrl & TILE_CTRL_MASK_EVEN_ODD) != 0 && std::abs(backdrop) % 2 == 0;
+}
+
+inline Vec2F mix(Vec2F a, Vec2F b, float t) {
+    return a + (b - a) * t;
+}
+
+inline float glsl_mod(float x, float y) {
+    return x - y * std::floor(x / y);
+}
+
+void emit_microline(Vec2F from, Vec2F to, uint32_t path_index, MicrolineD3D11 &microline) {
+    float values[4] = {from.x, from.y, to.x, to.y};
+    int32_t pixels[4], fract_pixels[4];
+
+    for (int i = 0; i < 4; i++) {
+        auto subpixels = (int32_t)std::round(std::clamp(values[i], -32768.0f, 32767.0f) * 256.0f);
+        pixels[i] = (int32_t)std::floor((float)subpixels / 256.0f);
+        fract_pixels[i] = subpixels - pixels[i] * 256;
+    }
+
+    microline.from_x_px = (int16_t)pixels[0];
+    microline.from_y_px = (int16_t)pixels[1];
+    microline.to_x_px = (int16_t)pixels[2];
+    microline.to_y_px = (int16_t)pixels[3];
+    microline.from_x_subpx = (uint8_t)fract_pixels[0];
+    microline.from_y_subpx = (uint8_t)fract_pixels[1];
+    microline.to_x_subpx = (uint8_t)fract_pixels[2];
+    microline.to_y_subpx = (uint8_t)fract_pixels[3];
+    microline.path_index = path_index;
+}
+
+/// A segment of a path, with quadratic control points converted to cubic ones.
+struct DiceSegment {
+    Vec2F from, ctrl0, ctrl1, to;
+    bool is_curve = false;
+    uint32_t microline_count = 0;
+    uint32_t path_index = 0;
+
+    Vec2F sample(float t) const {
+        if (!is_curve) {
+            return mix(from, to, t);
+        }
+        auto p0p1 = mix(from, ctrl0, t), p1p2 = mix(ctrl0, ctrl1, t), p2p3 = mix(ctrl1, to, t);
+        return mix(mix(p0p1, p1p2, t), mix(p1p2, p2p3, t), t);
+    }
+};
+
+CpuStagesD3D11::CpuStagesD3D11() {
+    auto image_buffer = ImageBuffer::from_memory({std::begin(area_lut_png), std::end(area_lut_png)}, false);
+
+    area_lut_size_ = image_buffer->get_size();
+
+    auto texel_count = area_lut_size_.area();
+    auto data = image_buffer->get_data();
+
+    area_lut_.resize(texel_count * 4);
+    for (size_t i = 0; i < area_lut_.size(); i++) {
+        area_lut_[i] = data[i] / 255.0f;
+    }
+}
+
+std::vector<MicrolineD3D11> CpuStagesD3D11::dice(const std::vector<DiceMetadataD3D11> &dice_metadata,
+                                                 uint32_t batch_segment_count,
+                                                 const SegmentsD3D11 &segments,
+                                                 const Transform2 &transform) const {
+    if (dice_metadata.empty()) {
+        return {};
+    }
+
+    std::vector<DiceSegment> dice_segments(batch_segment_count);
+
+    // Count microlines per segment.
+    parallel_for(batch_segment_count, CPU_STAGE_THREADS, [&](uint32_t batch_segment_index) {
+        uint32_t batch_path_index =
+            find_path_index(dice_metadata, batch_segment_index, [](const DiceMetadataD3D11 &metadata) {
+                return metadata.first_batch_segment_index;
+            });
+
+        const auto &metadata = dice_metadata[batch_path_index];
+        uint32_t global_segment_index =
+            batch_segment_index - metadata.first_batch_segment_index + metadata.first_global_segment_index;
+
+        const auto &indices = segments.indices[global_segment_index];
+        uint32_t from_point_index = indices.first_point_index;
+        uint32_t flags = indices.flag;
+
+        uint32_t to_point_index = from_point_index;
+        if (flags & CURVE_IS_CUBIC) {
+            to_point_index += 3;
+        } else if (flags & CURVE_IS_QUADRATIC) {
+            to_point_index += 2;
+        } else {
+            to_point_index += 1;
+        }
+
+        auto &segment = dice_segments[batch_segment_index];
+        segment.path_index = batch_path_index;
+        segment.from = transform * segments.points[from_point_index];
+        segment.to = transform * segments.points[to_point_index];
+        segment.is_curve = (flags & (CURVE_IS_CUBIC | CURVE_IS_QUADRATIC)) != 0;
+
+        float segment_count_f;
+        if (segment.is_curve) {
+            auto ctrl0 = transform * segments.points[from_point_index + 1];
+            if (flags & CURVE_IS_QUADRATIC) {
+                segment.ctrl0 = (segment.from + ctrl0 * 2.0f) * (1.0f / 3.0f);
+                segment.ctrl1 = (segment.to + ctrl0 * 2.0f) * (1.0f / 3.0f);
+            } else {
+                segment.ctrl0 = ctrl0;
+                segment.ctrl1 = transform * segments.points[from_point_index + 2];
+            }
+
+            // Thomas Sederberg, "Computer-Aided Geometric Design" notes, section 10.6 "Error Bounds".
+            auto a = segment.ctrl1 - segment.ctrl0 * 2.0f + segment.from;
+            auto b = segment.to - segment.ctrl1 * 2.0f + segment.ctrl0;
+            Vec2F bound = {6.0f * std::max(std::abs(a.x), std::abs(b.x)),
+                           6.0f * std::max(std::abs(a.y), std::abs(b.y))};
+            segment_count_f = std::sqrt(bound.length() / (8.0f * DICE_TOLERANCE));
+        } else {
+            segment_count_f = (segment.to - segment.from).length() / DICE_MICROLINE_LENGTH;
+        }
+
+        segment.microline_count = std::max((int32_t)std::ceil(segment_count_f), 1);
+    });
+
+    // Exclusive prefix sum, which replaces the atomic counter in the shader.
+    std::vector<uint32_t> first_microline_indices(batch_segment_count);
+    uint32_t microline_count = 0;
+    for (uint32_t i = 0; i < batch_segment_count; i++) {
+        first_microline_indices[i] = microline_count;
+        microline_count += dice_segments[i].microline_count;
+    }
+
+    std::vector<MicrolineD3D11> microlines(microline_count);
+
+    // Emit microlines.
+    parallel_for(batch_segment_count, CPU_STAGE_THREADS, [&](uint32_t batch_segment_index) {
+        const auto &segment = dice_segments[batch_segment_index];
+        auto first_index = first_microline_indices[batch_segment_index];
+
+        auto prev_point = segment.from;
+        for (uint32_t i = 0; i < segment.microline_count; i++) {
+            float next_t = float(i + 1) / float(segment.microline_count);
+            auto next_point = segment.sample(next_t);
+
+            emit_microline(prev_point, next_point, segment.path_index, microlines[first_index + i]);
+
+            prev_point = next_point;
+        }
+    });
+
+    return microlines;
+}
+
+void CpuStagesD3D11::bound(std::vector<TileD3D11> &tiles, const std::vector<TilePathInfoD3D11> &tile_path_info) const {
+    if (tile_path_info.empty()) {
+        return;
+    }
+
+    auto words = tile_words(tiles);
+
+    parallel_for(tiles.size(), CPU_STAGE_THREADS, [&](uint32_t tile_index) {
+        uint32_t path_index = find_path_index(tile_path_info, tile_index, [](const TilePathInfoD3D11 &info) {
+            return info.first_tile_index;
+        });
+
+        const auto &path_info = tile_path_info[path_index];
+
+        // Same as the w component of the path info.
+        uint32_t control_word =
+            uint32_t(path_info.color) | (uint32_t(path_info.ctrl) << 16) | (uint32_t(uint8_t(path_info.backdrop)) << 24);
+
+        words[tile_index * 4 + TILE_FIELD_NEXT_TILE_ID] = ~0u;
+        words[tile_index * 4 + TILE_FIELD_FIRST_FILL_ID] = ~0u;
+        words[tile_index * 4 + TILE_FIELD_BACKDROP_ALPHA_TILE_ID] = 0x00ffffffu;
+        words[tile_index * 4 + TILE_FIELD_CONTROL] = control_word;
+    });
+}
+
+std::vector<Fill> CpuStagesD3D11::bin(const std::vector<MicrolineD3D11> &microlines,
+                                      const std::vector<PropagateMetadataD3D11> &propagate_metadata,
+                                      std::vector<TileD3D11> &tiles,
+                                      std::vector<BackdropInfoD3D11> &backdrops) const {
+    std::vector<Fill> fills;
+
+    auto words = tile_words(tiles);
+
+    auto compute_tile_outcodes = [](Vec2I tile_coords, const RectI &rect, bool outcodes[4]) {
+        outcodes[0] = tile_coords.x < rect.left;
+        outcodes[1] = tile_coords.y < rect.top;
+        outcodes[2] = tile_coords.x >= rect.right;
+        outcodes[3] = tile_coords.y >= rect.bottom;
+        return outcodes[0] || outcodes[1] || outcodes[2] || outcodes[3];
+    };
+
+    auto compute_tile_index = [](Vec2I tile_coords, const RectI &rect, uint32_t tile_offset) {
+        return uint32_t(int32_t(tile_offset) + (tile_coords.x - rect.left) + (tile_coords.y - rect.top) * rect.width());
+    };
+
+    auto add_fill = [&](Vec2F from, Vec2F to, Vec2I tile_coords, const PropagateMetadataD3D11 &metadata) {
+        bool outcodes[4];
+        if (compute_tile_outcodes(tile_coords, metadata.tile_rect, outcodes)) {
+            return;
+        }
+        auto tile_index = compute_tile_index(tile_coords, metadata.tile_rect, metadata.tile_offset);
+
+        // Clip line. If too narrow, cull.
+        auto tile_origin = (tile_coords * Vec2I(16)).to_f32();
+        auto local_from = (from - tile_origin) * 256.0f;
+        auto local_to = (to - tile_origin) * 256.0f;
+        auto scaled_local_line = LineSegmentU16{(uint16_t)(int64_t)local_from.x,
+                                                (uint16_t)(int64_t)local_from.y,
+                                                (uint16_t)(int64_t)local_to.x,
+                                                (uint16_t)(int64_t)local_to.y};
+        if (scaled_local_line.from_x == scaled_local_line.to_x) {
+            return;
+        }
+
+        // Insert into the tile's linked list.
+        auto fill_index = (uint32_t)fills.size();
+        auto fill_link = words[tile_index * 4 + TILE_FIELD_FIRST_FILL_ID];
+        words[tile_index * 4 + TILE_FIELD_FIRST_FILL_ID] = fill_index;
+
+        fills.push_back({scaled_local_line, fill_link});
+    };
+
+    auto adjust_backdrop = [&](int32_t backdrop_delta, Vec2I tile_coords, const PropagateMetadataD3D11 &metadata) {
+        const auto &rect = metadata.tile_rect;
+
+        bool outcodes[4];
+        if (compute_tile_outcodes(tile_coords, rect, outcodes)) {
+            if (!outcodes[0] && outcodes[1] && !outcodes[2]) {
+                auto backdrop_index = metadata.backdrop_offset + uint32_t(tile_coords.x - rect.left);
+                backdrops[backdrop_index].initial_backdrop += backdrop_delta;
+            }
+        } else {
+            auto tile_index = compute_tile_index(tile_coords, rect, metadata.tile_offset);
+            words[tile_index * 4 + TILE_FIELD_BACKDROP_ALPHA_TILE_ID] += uint32_t(backdrop_delta) << 24;
+        }
+    };
+
+    enum class StepDirection { None, X, Y };
+
+    for (const auto &microline : microlines) {
+        Vec2F from = {microline.from_x_px + microline.from_x_subpx / 256.0f,
+                      microline.from_y_px + microline.from_y_subpx / 256.0f};
+        Vec2F to = {microline.to_x_px + microline.to_x_subpx / 256.0f, microline.to_y_px + microline.to_y_subpx / 256.0f};
+
+        const auto &metadata = propagate_metadata[microline.path_index];
+
+        // Straight port of `process_line_segment()`.
+        const float tile_size = 16.0f;
+
+        Vec2I from_tile_coords = (from / tile_size).floor();
+        Vec2I to_tile_coords = (to / tile_size).floor();
+
+        Vec2F vector = to - from;
+        Vec2I tile_step = {vector.x < 0 ? -1 : 1, vector.y < 0 ? -1 : 1};
+
+        Vec2F first_tile_crossing = ((from_tile_coords + Vec2I(vector.x >= 0 ? 1 : 0, vector.y >= 0 ? 1 : 0)) * 16)
+                                        .to_f32();
+
+        Vec2F t_max = (first_tile_crossing - from) / vector;
+        Vec2F t_delta = {std::abs(tile_size / vector.x), std::abs(tile_size / vector.y)};
+
+        Vec2F current_position = from;
+        Vec2I tile_coords = from_tile_coords;
+        auto last_step_direction = StepDirection::None;
+
+        for (uint32_t iteration = 0; iteration < MAX_ITERATIONS; iteration++) {
+            StepDirection next_step_direction;
+            if (t_max.x < t_max.y) {
+                next_step_direction = StepDirection::X;
+            } else if (t_max.x > t_max.y) {
+                next_step_direction = StepDirection::Y;
+            } else if (tile_step.x > 0) {
+                next_step_direction = StepDirection::X;
+            } else {
+                next_step_direction = StepDirection::Y;
+            }
+
+            float next_t = std::min(next_step_direction == StepDirection::X ? t_max.x : t_max.y, 1.0f);
+
+            // If we've reached the end tile, don't step at all.
+            if (tile_coords == to_tile_coords) {
+                next_step_direction = StepDirection::None;
+            }
+
+            Vec2F next_position = mix(from, to, next_t);
+
+            add_fill(current_position, next_position, tile_coords, metadata);
+
+            // Add extra fills if necessary.
+            auto tile_origin = (tile_coords * Vec2I(16)).to_f32();
+            if (tile_step.y < 0 && next_step_direction == StepDirection::Y) {
+                add_fill(next_position, tile_origin, tile_coords, metadata);
+            } else if (tile_step.y > 0 && last_step_direction == StepDirection::Y) {
+                add_fill(tile_origin, current_position, tile_coords, metadata);
+            }
+
+            // Adjust backdrop if necessary.
+            if (tile_step.x < 0 && last_step_direction == StepDirection::X) {
+                adjust_backdrop(1, tile_coords, metadata);
+            } else if (tile_step.x > 0 && next_step_direction == StepDirection::X) {
+                adjust_backdrop(-1, tile_coords, metadata);
+            }
+
+            // Take a step.
+            if (next_step_direction == StepDirection::X) {
+                t_max.x += t_delta.x;
+                tile_coords.x += tile_step.x;
+            } else if (next_step_direction == StepDirection::Y) {
+                t_max.y += t_delta.y;
+                tile_coords.y += tile_step.y;
+            } else {
+                break;
+            }
+
+            current_position = next_position;
+            last_step_direction = next_step_direction;
+        }
+    }
+
+    return fills;
+}
+
+std::vector<AlphaTileD3D11> CpuStagesD3D11::propagate(Vec2I framebuffer_tile_size,
+                                                      uint32_t first_alpha_tile_index,
+                                                      const std::vector<BackdropInfoD3D11> &backdrops,
+                                                      Range column_range,
+                                                      const std::vector<PropagateMetadataD3D11> &propagate_metadata,
+                                                      std::vector<TileD3D11> &tiles,
+                                                      const CpuTileBatchD3D11 *clip_batch,
+                                                      std::vector<int32_t> &z_buffer,
+                                                      std::vector<FirstTileD3D11> &first_tile_map) const {
+    std::vector<AlphaTileD3D11> alpha_tiles;
+
+    auto draw_words = tile_words(tiles);
+    const uint32_t *clip_words = clip_batch ? tile_words(clip_batch->tiles) : nullptr;
+
+    // The shader reads the clip metadata as an array of uvec4s with a stride of two.
+    const uint32_t *clip_metadata_words =
+        clip_batch ? reinterpret_cast<const uint32_t *>(clip_batch->propagate_metadata.data()) : nullptr;
+
+    auto calculate_tile_index = [](uint32_t buffer_offset, const RectI &tile_rect, Vec2I tile_coord) {
+        return buffer_offset + tile_coord.y * tile_rect.width() + tile_coord.x;
+    };
+
+    for (auto column_index = column_range.start; column_index < column_range.end; column_index++) {
+        const auto &backdrop = backdrops[column_index];
+
+        int32_t current_backdrop = backdrop.initial_backdrop;
+        int32_t tile_x = backdrop.tile_x_offset;
+
+        const auto &draw_metadata = propagate_metadata[backdrop.path_index];
+        const auto &draw_tile_rect = draw_metadata.tile_rect;
+        uint32_t draw_tile_buffer_offset = draw_metadata.tile_offset;
+        bool z_write = draw_metadata.z_write != 0;
+
+        auto clip_path_index = int32_t(draw_metadata.clip_path_index);
+        RectI clip_tile_rect(0, 0, 0, 0);
+        uint32_t clip_tile_buffer_offset = 0;
+        if (clip_path_index >= 0 && clip_metadata_words) {
+            auto rect_words = clip_metadata_words + (clip_path_index * 2 + 0) * 4;
+            auto offset_words = clip_metadata_words + (clip_path_index * 2 + 1) * 4;
+            clip_tile_rect = RectI((int32_t)rect_words[0], (int32_t)rect_words[1], (int32_t)rect_words[2], (int32_t)rect_words[3]);
+            clip_tile_buffer_offset = offset_words[0];
+        }
+
+        for (int32_t tile_y = 0; tile_y < draw_tile_rect.height(); tile_y++) {
+            Vec2I draw_tile_coord = {tile_x, tile_y};
+            auto draw_tile_index = calculate_tile_index(draw_tile_buffer_offset, draw_tile_rect, draw_tile_coord);
+
+            int32_t draw_alpha_tile_index = -1;
+            int32_t clip_alpha_tile_index = -1;
+            auto draw_first_fill_index = int32_t(draw_words[draw_tile_index * 4 + TILE_FIELD_FIRST_FILL_ID]);
+            int32_t draw_backdrop_delta = int32_t(draw_words[draw_tile_index * 4 + TILE_FIELD_BACKDROP_ALPHA_TILE_ID]) >> 24;
+            uint32_t draw_tile_word = draw_words[draw_tile_index * 4 + TILE_FIELD_CONTROL] & 0x00ffffffu;
+
+            int32_t draw_tile_backdrop = current_backdrop;
+            bool have_draw_alpha_mask = draw_first_fill_index >= 0;
+            bool need_new_alpha_tile = have_draw_alpha_mask;
+
+            // Handle clip if necessary.
+            if (clip_path_index >= 0 && clip_words) {
+                Vec2I tile_coord = draw_tile_coord + Vec2I(draw_tile_rect.left, draw_tile_rect.top);
+                if (tile_coord.x >= clip_tile_rect.left && tile_coord.y >= clip_tile_rect.top &&
+                    tile_coord.x < clip_tile_rect.right && tile_coord.y < clip_tile_rect.bottom) {
+                    Vec2I clip_tile_coord = tile_coord - Vec2I(clip_tile_rect.left, clip_tile_rect.top);
+                    auto clip_tile_index = calculate_tile_index(clip_tile_buffer_offset, clip_tile_rect, clip_tile_coord);
+
+                    auto this_clip_alpha_tile_index =
+                        unpack_alpha_tile_id(clip_words[clip_tile_index * 4 + TILE_FIELD_BACKDROP_ALPHA_TILE_ID]);
+
+                    int32_t clip_tile_backdrop = int32_t(clip_words[clip_tile_index * 4 + TILE_FIELD_CONTROL]) >> 24;
+
+                    if (this_clip_alpha_tile_index >= 0) {
+                        if (have_draw_alpha_mask) {
+                            clip_alpha_tile_index = this_clip_alpha_tile_index;
+                            need_new_alpha_tile = true;
+                        } else if (draw_tile_backdrop != 0) {
+                            // This is a solid draw tile, but there's a clip applied. Replace it
+                            // with an alpha tile pointing directly to the clip mask.
+                            draw_alpha_tile_index = this_clip_alpha_tile_index;
+                            clip_alpha_tile_index = -1;
+                            need_new_alpha_tile = false;
+                        } else {
+                            draw_alpha_tile_index = -1;
+                            clip_alpha_tile_index = -1;
+                            need_new_alpha_tile = false;
+                        }
+                    } else if (clip_tile_backdrop == 0) {
+                        // This is a blank clip tile. Cull the draw tile entirely.
+                        draw_tile_backdrop = 0;
+                        need_new_alpha_tile = false;
+                    }
+                } else {
+                    // This draw tile is outside the clip path bounding rect. Cull the draw tile.
+                    draw_tile_backdrop = 0;
+                    need_new_alpha_tile = false;
+                }
+            }
+
+            if (need_new_alpha_tile) {
+                auto draw_batch_alpha_tile_index = (uint32_t)alpha_tiles.size();
+                alpha_tiles.push_back({draw_tile_index, uint32_t(clip_alpha_tile_index)});
+                draw_alpha_tile_index = int32_t(draw_batch_alpha_tile_index + first_alpha_tile_index);
+            }
+
+            draw_words[draw_tile_index * 4 + TILE_FIELD_BACKDROP_ALPHA_TILE_ID] =
+                (uint32_t(draw_alpha_tile_index) & 0x00ffffffu) | (uint32_t(draw_backdrop_delta) << 24);
+            draw_words[draw_tile_index * 4 + TILE_FIELD_CONTROL] = draw_tile_word | (uint32_t(draw_tile_backdrop) << 24);
+
+            // Even-Odd fill rule will make some solid tiles invisible, we shouldn't write them into Z buffer.
+            if (draw_tile_backdrop != 0 && is_hidden_by_even_odd(draw_tile_word, draw_tile_backdrop)) {
+                z_write = false;
+            }
+
+            Vec2I final_tile_coord = draw_tile_coord + Vec2I(draw_tile_rect.left, draw_tile_rect.top);
+            int32_t tile_map_index = final_tile_coord.y * framebuffer_tile_size.x + final_tile_coord.x;
+
+            // The GPU silently drops out-of-bounds writes.
+            bool in_bounds = tile_map_index >= 0 && tile_map_index < (int32_t)first_tile_map.size();
+
+            // Write to Z-buffer if necessary.
+            if (in_bounds && z_write && draw_tile_backdrop != 0 && draw_alpha_tile_index < 0) {
+                z_buffer[tile_map_index] = std::max(z_buffer[tile_map_index], int32_t(draw_tile_index));
+            }
+
+            // Stitch into the linked list if necessary.
+            if (in_bounds && (draw_tile_backdrop != 0 || draw_alpha_tile_index >= 0)) {
+                auto next_tile_index = first_tile_map[tile_map_index].first_tile;
+                first_tile_map[tile_map_index].first_tile = int32_t(draw_tile_index);
+                draw_words[draw_tile_index * 4 + TILE_FIELD_NEXT_TILE_ID] = uint32_t(next_tile_index);
+            }
+
+            current_backdrop += draw_backdrop_delta;
+        }
+    }
+
+    return alpha_tiles;
+}
+
+F32x4 CpuStagesD3D11::sample_area_lut(float u, float v) const {
+    // Texel centers are at half-integer coordinates.
+    float x = u * area_lut_size_.x - 0.5f;
+    float y = v * area_lut_size_.y - 0.5f;
+
+    float x_floor = std::floor(x), y_floor = std::floor(y);
+    float fx = x - x_floor, fy = y - y_floor;
+
+    auto clamp_x = [this](int32_t i) { return std::clamp(i, 0, area_lut_size_.x - 1); };
+    auto clamp_y = [this](int32_t i) { return std::clamp(i, 0, area_lut_size_.y - 1); };
+
+    int32_t x0 = clamp_x((int32_t)x_floor), x1 = clamp_x((int32_t)x_floor + 1);
+    int32_t y0 = clamp_y((int32_t)y_floor), y1 = clamp_y((int32_t)y_floor + 1);
+
+    auto texel = [this](int32_t tx, int32_t ty) {
+        auto p = &area_lut_[(ty * area_lut_size_.x + tx) * 4];
+        return F32x4(p[0], p[1], p[2], p[3]);
+    };
+
+    auto top = texel(x0, y0) + (texel(x1, y0) - texel(x0, y0)) * F32x4::splat(fx);
+    auto bottom = texel(x0, y1) + (texel(x1, y1) - texel(x0, y1)) * F32x4::splat(fx);
+
+    return top + (bottom - top) * F32x4::splat(fy);
+}
+
+F32x4 CpuStagesD3D11::compute_coverage(Vec2F from, Vec2F to) const {
+    // Determine winding, and sort into a consistent order so we only need to find one root below.
+    auto left = from.x < to.x ? from : to, right = from.x < to.x ? to : from;
+
+    // Shoot a vertical ray toward the curve.
+    Vec2F window = {std::clamp(from.x, -0.5f, 0.5f), std::clamp(to.x, -0.5f, 0.5f)};
+    float offset = (window.x + window.y) * 0.5f - left.x;
+    float t = offset / (right.x - left.x);
+
+    // Compute position and derivative to form a line approximation.
+    float y = left.y + (right.y - left.y) * t;
+    float d = (right.y - left.y) / (right.x - left.x);
+
+    // Look up area under that line, and scale horizontally to the window size.
+    float dx = window.x - window.y;
+
+    return sample_area_lut((y + 8.0f) / 16.0f, std::abs(d * dx) / 16.0f) * F32x4::splat(dx);
+}
+
+void CpuStagesD3D11::fill(const std::vector<Fill> &fills,
+                          const std::vector<TileD3D11> &tiles,
+                          const std::vector<AlphaTileD3D11> &alpha_tiles,
+                          Range alpha_tile_range) {
+    auto words = tile_words(tiles);
+
+    auto texel_coord = [](uint32_t alpha_tile_index, uint32_t x, uint32_t y) {
+        uint32_t tile_x = alpha_tile_index & 0xffu;
+        uint32_t tile_y = ((alpha_tile_index >> 8u) & 0xffu) | (((alpha_tile_index >> 16u) & 0xffu) << 8u);
+        return (tile_y * 4 + y) * MASK_FRAMEBUFFER_WIDTH + tile_x * 16 + x;
+    };
+
+    auto alpha_tile_count = uint32_t(alpha_tile_range.end - alpha_tile_range.start);
+
+    parallel_for(alpha_tile_count, CPU_STAGE_THREADS, [&](uint32_t batch_alpha_tile_index) {
+        auto alpha_tile_index = uint32_t(alpha_tile_range.start) + batch_alpha_tile_index;
+        const auto &alpha_tile = alpha_tiles[batch_alpha_tile_index];
+
+        auto tile_index = alpha_tile.alpha_tile_index;
+        auto first_fill_index = int32_t(words[tile_index * 4 + TILE_FIELD_FIRST_FILL_ID]);
+        uint32_t tile_control_word = words[tile_index * 4 + TILE_FIELD_CONTROL];
+        int32_t backdrop = int32_t(tile_control_word) >> 24;
+
+        int32_t tile_ctrl = int32_t((tile_control_word >> 16) & 0xffu);
+        int32_t mask_ctrl = (tile_ctrl >> TILE_CTRL_MASK_0_SHIFT) & 0x3;
+
+        // clip_tile_index should be converted to int first, as it might be negative.
+        auto clip_tile_index = int32_t(alpha_tile.clip_tile_index);
+
+        // One texel holds four rows of coverage, one per channel.
+        for (uint32_t y = 0; y < 4; y++) {
+            for (uint32_t x = 0; x < 16; x++) {
+                Vec2F tile_frag_coord = {float(x) + 0.5f, float(y * 4) + 0.5f};
+
+                auto coverages = F32x4::splat(float(backdrop));
+
+                auto fill_index = first_fill_index;
+                for (uint32_t iteration = 0; fill_index >= 0 && iteration < MAX_ITERATIONS; iteration++) {
+                    const auto &line = fills[fill_index].line_segment;
+
+                    Vec2F from = Vec2F(line.from_x, line.from_y) / 256.0f - tile_frag_coord;
+                    Vec2F to = Vec2F(line.to_x, line.to_y) / 256.0f - tile_frag_coord;
+
+                    coverages += compute_coverage(from, to);
+
+                    fill_index = int32_t(fills[fill_index].link);
+                }
+
+                float values[4] = {coverages.get<0>(), coverages.get<1>(), coverages.get<2>(), coverages.get<3>()};
+
+                for (auto &value : values) {
+                    if (mask_ctrl & TILE_CTRL_MASK_WINDING) {
+                        value = std::clamp(std::abs(value), 0.0f, 1.0f);
+                    } else {
+                        value = std::clamp(1.0f - std::abs(1.0f - glsl_mod(value, 2.0f)), 0.0f, 1.0f);
+                    }
+                }
+
+                // Handle clip if necessary.
+                if (clip_tile_index >= 0) {
+                    auto clip_texel = mask_texels_[texel_coord(clip_tile_index, x, y)];
+                    values[0] = std::min(values[0], clip_texel.r_ / 255.0f);
+                    values[1] = std::min(values[1], clip_texel.g_ / 255.0f);
+                    values[2] = std::min(values[2], clip_texel.b_ / 255.0f);
+                    values[3] = std::min(values[3], clip_texel.a_ / 255.0f);
+                }
+
+                auto &texel = mask_texels_[texel_coord(alpha_tile_index, x, y)];
+                texel.r_ = (uint8_t)std::lround(values[0] * 255.0f);
+                texel.g_ = (uint8_t)std::lround(values[1] * 255.0f);
+                texel.b_ = (uint8_t)std::lround(values[2] * 255.0f);
+                texel.a_ = (uint8_t)std::lround(values[3] * 255.0f);
+            }
+        }
+    });
+}
+
+void CpuStagesD3D11::sort(std::vector<TileD3D11> &tiles,
+                          std::vector<FirstTileD3D11> &first_tile_map,
+                          const std::vector<int32_t> &z_buffer) const {
+    auto words = tile_words(tiles);
+
+    auto get_next_tile = [words](int32_t tile_index) {
+        return int32_t(words[tile_index * 4 + TILE_FIELD_NEXT_TILE_ID]);
+    };
+    auto set_next_tile = [words](int32_t tile_index, int32_t next_tile_index) {
+        words[tile_index * 4 + TILE_FIELD_NEXT_TILE_ID] = uint32_t(next_tile_index);
+    };
+
+    // Each tile belongs to exactly one list, so lists can be sorted in parallel.
+    parallel_for(first_tile_map.size(), CPU_STAGE_THREADS, [&](uint32_t global_tile_index) {
+        int32_t z_value = z_buffer[global_tile_index];
+
+        int32_t unsorted_first_tile_index = first_tile_map[global_tile_index].first_tile;
+        int32_t sorted_first_tile_index = -1;
+
+        while (unsorted_first_tile_index >= 0) {
+            int32_t current_tile_index = unsorted_first_tile_index;
+            unsorted_first_tile_index = get_next_tile(current_tile_index);
+
+            if (current_tile_index < z_value) {
+                continue;
+            }
+
+            int32_t prev_trial_tile_index = -1;
+            int32_t trial_tile_index = sorted_first_tile_index;
+            while (true) {
+                if (trial_tile_index < 0 || current_tile_index < trial_tile_index) {
+                    if (prev_trial_tile_index < 0) {
+                        set_next_tile(current_tile_index, sorted_first_tile_index);
+                        sorted_first_tile_index = current_tile_index;
+                    } else {
+                        set_next_tile(current_tile_index, trial_tile_index);
+                        set_next_tile(prev_trial_tile_index, current_tile_index);
+                    }
+                    break;
+                }
+                prev_trial_tile_index = trial_tile_index;
+                trial_tile_index = get_next_tile(trial_tile_index);
+            }
+        }
+
+        first_tile_map[global_tile_index].first_tile = sorted_first_tile_index;
+    });
+}
+
+void CpuStagesD3D11::sort_by_keys(std::vector<TileD3D11> &tiles,
+                                  std::vector<FirstTileD3D11> &first_tile_map,
+                                  const std::vector<int32_t> &z_buffer) const {
+    auto words = tile_words(tiles);
+
+    // Generate keys. Unlike the GPU, framebuffer tiles are visited in order.
+    std::vector<TileSortKeyD3D11> keys;
+    keys.reserve(tiles.size());
+
+    for (uint32_t global_tile_index = 0; global_tile_index < first_tile_map.size(); global_tile_index++) {
+        int32_t z_value = z_buffer[global_tile_index];
+
+        int32_t tile_index = first_tile_map[global_tile_index].first_tile;
+        while (tile_index >= 0) {
+            if (tile_index >= z_value) {
+                keys.push_back({global_tile_index, uint32_t(tile_index)});
+            }
+            tile_index = int32_t(words[tile_index * 4 + TILE_FIELD_NEXT_TILE_ID]);
+        }
+
+        first_tile_map[global_tile_index].first_tile = -1;
+    }
+
+    // Stable LSD radix sort, by tile index first and then by framebuffer tile.
+    std::vector<TileSortKeyD3D11> sorted_keys(keys.size());
+
+    auto sort_pass = [&](bool by_tile_index, uint32_t digit_shift) {
+        auto get_digit = [&](const TileSortKeyD3D11 &key) {
+            uint32_t value = by_tile_index ? key.tile_index : key.framebuffer_tile_index;
+            return (value >> digit_shift) & ((1u << RADIX_SORT_DIGIT_BITS) - 1);
+        };
+
+        std::array<uint32_t, 1 << RADIX_SORT_DIGIT_BITS> offsets{};
+        for (const auto &key : keys) {
+            offsets[get_digit(key)]++;
+        }
+
+        uint32_t offset = 0;
+        for (auto &digit_offset : offsets) {
+            uint32_t count = digit_offset;
+            digit_offset = offset;
+            offset += count;
+        }
+
+        for (const auto &key : keys) {
+            sorted_keys[offsets[get_digit(key)]++] = key;
+        }
+
+        keys.swap(sorted_keys);
+    };
+
+    for (uint32_t pass = 0; pass < radix_sort_pass_count(tiles.size()); pass++) {
+        sort_pass(true, pass * RADIX_SORT_DIGIT_BITS);
+    }
+    for (uint32_t pass = 0; pass < radix_sort_pass_count(first_tile_map.size()); pass++) {
+        sort_pass(false, pass * RADIX_SORT_DIGIT_BITS);
+    }
+
+    // Link the sorted keys back into tile lists.
+    for (size_t key_index = 0; key_index < keys.size(); key_index++) {
+        const auto &key = keys[key_index];
+
+        int32_t next_tile_index = -1;
+        if (key_index + 1 < keys.size() && keys[key_index + 1].framebuffer_tile_index == key.framebuffer_tile_index) {
+            next_tile_index = int32_t(keys[key_index + 1].tile_index);
+        }
+        words[key.tile_index * 4 + TILE_FIELD_NEXT_TILE_ID] = uint32_t(next_tile_index);
+
+        if (key_index == 0 || keys[key_index - 1].framebuffer_tile_index != key.framebuffer_tile_index) {
+            first_tile_map[key.framebuffer_tile_index].first_tile = int32_t(key.tile_index);
+        }
+    }
+}
+
+uint32_t CpuStagesD3D11::tile(const std::vector<TileD3D11> &tiles,
+                              const std::vector<FirstTileD3D11> &first_tile_map) const {
+    auto words = tile_words(tiles);
+
+    std::vector<uint32_t> layer_counts(first_tile_map.size());
+
+    parallel_for(first_tile_map.size(), CPU_STAGE_THREADS, [&](uint32_t global_tile_index) {
+        uint32_t layer_count = 0;
+
+        int32_t tile_index = first_tile_map[global_tile_index].first_tile;
+        while (tile_index >= 0) {
+            int32_t alpha_tile_index = unpack_alpha_tile_id(words[tile_index * 4 + TILE_FIELD_BACKDROP_ALPHA_TILE_ID]);
+            uint32_t tile_control_word = words[tile_index * 4 + TILE_FIELD_CONTROL];
+            int32_t backdrop = int32_t(tile_control_word) >> 24;
+
+            // Solid tiles hidden by the even-odd fill rule are skipped.
+            if (alpha_tile_index >= 0 || backdrop == 0 || !is_hidden_by_even_odd(tile_control_word, backdrop)) {
+                layer_count++;
+            }
+
+            tile_index = int32_t(words[tile_index * 4 + TILE_FIELD_NEXT_TILE_ID]);
+        }
+
+        layer_counts[global_tile_index] = layer_count;
+    });
+
+    uint32_t total = 0;
+    for (auto count : layer_counts) {
+        total += count;
+    }
+
+    return total;
+}
+
+void CpuStagesD3D11::resize_mask(uint32_t page_count) {
+    size_t texel_count = (size_t)MASK_FRAMEBUFFER_WIDTH * MASK_FRAMEBUFFER_HEIGHT * page_count;
+
+    if (mask_texels_.size() < texel_count) {
+        mask_texels_.resize(texel_count);
+    }
+}
+
+const std::vector<ColorU> &CpuStagesD3D11::get_mask_texels() const {
+    return mask_texels_;
+}
+
+} // namespace Pathfinder
+
+#endif
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <vector>
+
+#include "../../common/color.h"
+#include "../../common/f32x4.h"
+#include "gpu_data.h"
+
+#ifdef PATHFINDER_ENABLE_COMPUTE
+
+namespace Pathfinder {
+
+/// Work counts of the stages run on CPU, accumulated over a frame.
+struct CpuStageStatsD3D11 {
+    uint32_t batch_count = 0;
+    uint32_t segment_count = 0;
+    uint32_t microline_count = 0;
+    uint32_t tile_count = 0;
+    uint32_t fill_count = 0;
+    uint32_t alpha_tile_count = 0;
+    /// Tile layers the tile stage composites.
+    uint32_t composited_tile_count = 0;
+};
+
+/// Outputs of the CPU stages for one tile batch.
+/// Kept until the end of the frame, as later batches may be clipped against it.
+struct CpuTileBatchD3D11 {
+    std::vector<TileD3D11> tiles;
+    std::vector<PropagateMetadataD3D11> propagate_metadata;
+    std::vector<FirstTileD3D11> first_tile_map;
+    /// Z-buffer without the indirect draw params header.
+    std::vector<int32_t> z_buffer;
+};
+
+/// CPU implementation of the D3D11 compute stages.
+///
+/// Each stage mirrors its compute shader in `shaders/d3d11` and works on the same data layout,
+/// so its output can be compared against the GPU buffers word by word.
+/// Stages whose invocations are independent run on several threads. The order of microlines,
+/// fills and alpha tiles is deterministic, as the CPU version doesn't rely on atomics.
+class CpuStagesD3D11 {
+public:
+    CpuStagesD3D11();
+
+    /// Mirrors dice.comp.
+    std::vector<MicrolineD3D11> dice(const std::vector<DiceMetadataD3D11> &dice_metadata,
+                                     uint32_t batch_segment_count,
+                                     const SegmentsD3D11 &segments,
+                                     const Transform2 &transform) const;
+
+    /// Mirrors bound.comp. `tiles` should be sized to the batch tile count.
+    void bound(std::vector<TileD3D11> &tiles, const std::vector<TilePathInfoD3D11> &tile_path_info) const;
+
+    /// Mirrors bin.comp. Links fills into `tiles` and adjusts `backdrops`.
+    std::vector<Fill> bin(const std::vector<MicrolineD3D11> &microlines,
+                          const std::vector<PropagateMetadataD3D11> &propagate_metadata,
+                          std::vector<TileD3D11> &tiles,
+                          std::vector<BackdropInfoD3D11> &backdrops) const;
+
+    /// Mirrors propagate.comp. Allocates alpha tiles starting from `first_alpha_tile_index`.
+    /// Only the backdrop columns in `column_range` are propagated, like a dispatch bound to a clip level.
+    std::vector<AlphaTileD3D11> propagate(Vec2I framebuffer_tile_size,
+                                          uint32_t first_alpha_tile_index,
+                                          const std::vector<BackdropInfoD3D11> &backdrops,
+                                          Range column_range,
+                                          const std::vector<PropagateMetadataD3D11> &propagate_metadata,
+                                          std::vector<TileD3D11> &tiles,
+                                          const CpuTileBatchD3D11 *clip_batch,
+                                          std::vector<int32_t> &z_buffer,
+                                          std::vector<FirstTileD3D11> &first_tile_map) const;
+
+    /// Mirrors fill.comp. Rasterizes alpha tiles in `alpha_tile_range` into the mask texels.
+    void fill(const std::vector<Fill> &fills,
+              const std::vector<TileD3D11> &tiles,
+              const std::vector<AlphaTileD3D11> &alpha_tiles,
+              Range alpha_tile_range);
+
+    /// Mirrors sort.comp.
+    void sort(std::vector<TileD3D11> &tiles,
+              std::vector<FirstTileD3D11> &first_tile_map,
+              const std::vector<int32_t> &z_buffer) const;
+
+    /// Mirrors sort_keys.comp and radix_sort.comp. Gives the same tile lists as sort().
+    void sort_by_keys(std::vector<TileD3D11> &tiles,
+                      std::vector<FirstTileD3D11> &first_tile_map,
+                      const std::vector<int32_t> &z_buffer) const;
+
+    /// Walks the tile lists the way tile.comp does.
+    /// Compositing itself depends on the texture metadata and color textures, so it stays on GPU.
+    /// @return Number of tile layers that would be composited.
+    uint32_t tile(const std::vector<TileD3D11> &tiles, const std::vector<FirstTileD3D11> &first_tile_map) const;
+
+    /// Grow the mask texels to hold the given number of mask pages. Existing content is kept.
+    void resize_mask(uint32_t page_count);
+
+    /// RGBA8 texels laid out the same way as the mask texture.
+    const std::vector<ColorU> &get_mask_texels() const;
+
+private:
+    /// Area LUT sampled with bilinear filtering and clamp-to-edge addressing, as the GPU does.
+    F32x4 sample_area_lut(float u, float v) const;
+
+    F32x4 compute_coverage(Vec2F from, Vec2F to) const;
+
+    /// Normalized RGBA values.
+    std::vector<float> area_lut_;
+    Vec2I area_lut_size_;
+
+    std::vector<ColorU> mask_texels_;
+};
+
+} // namespace Pathfinder
+
+#endif
@@ -76,6 +76,56 @@ uint32_t TileBatchDataD3D11::push(const BuiltPath &path,
     return batch_path_index;
 }
 
+void TileBatchDataD3D11::group_columns_by_clip_level() {
+    auto &clip_levels = prepare_info.clip_levels;
+
+    uint32_t level_count = 0;
+    for (auto level : clip_levels) {
+        level_count = std::max(level_count, level + 1);
+    }
+
+    if (level_count <= 1) {
+        return;
+    }
+
+    auto &propagate_metadata = prepare_info.propagate_metadata;
+
+    std::vector<BackdropInfoD3D11> grouped_backdrops;
+    grouped_backdrops.reserve(prepare_info.backdrops.size() + level_count * CLIP_LEVEL_COLUMN_ALIGNMENT);
+
+    prepare_info.level_column_ranges.clear();
+
+    for (uint32_t level = 0; level < level_count; level++) {
+        // Padding columns are never read, as they are out of the column range of any level.
+        auto level_start = (grouped_backdrops.size() + CLIP_LEVEL_COLUMN_ALIGNMENT - 1) /
+                           CLIP_LEVEL_COLUMN_ALIGNMENT * CLIP_LEVEL_COLUMN_ALIGNMENT;
+        grouped_backdrops.resize(level_start, BackdropInfoD3D11{0, 0, 0});
+
+        for (uint32_t path_index = 0; path_index < clip_levels.size(); path_index++) {
+            if (clip_levels[path_index] != level) {
+                continue;
+            }
+
+            auto &metadata = propagate_metadata[path_index];
+            auto old_offset = metadata.backdrop_offset;
+            auto column_count = metadata.tile_rect.width();
+
+            metadata.backdrop_offset = grouped_backdrops.size();
+
+            grouped_backdrops.insert(grouped_backdrops.end(),
+                                     prepare_info.backdrops.begin() + old_offset,
+                                     prepare_info.backdrops.begin() + old_offset + column_count);
+        }
+
+        // A level whose paths have no columns has nothing to propagate.
+        if (grouped_backdrops.size() > level_start) {
+            prepare_info.level_column_ranges.emplace_back(level_start, grouped_backdrops.size());
+        }
+    }
+
+    prepare_info.backdrops = std::move(grouped_backdrops);
+}
+
 Range SegmentsD3D11::add_path(const Outline &outline) {
     auto first_segment_index = indices.size();
 
@@ -14,6 +14,22 @@
 
 namespace Pathfinder {
 
+/// Backdrop columns of each clip level start at a multiple of this, so a level can be bound at a storage buffer
+/// offset. 64 columns take 768 bytes, a multiple of the largest offset alignment (256 bytes) found in practice.
+constexpr uint32_t CLIP_LEVEL_COLUMN_ALIGNMENT = 64;
+
+/// Bits sorted by each pass of the tile radix sort. Keep in sync with radix_sort.comp.
+constexpr uint32_t RADIX_SORT_DIGIT_BITS = 4;
+
+/// Number of radix sort passes needed to order values in [0, value_count).
+inline uint32_t radix_sort_pass_count(uint32_t value_count) {
+    uint32_t bits = 0;
+    while (bits < 32 && (uint64_t(1) << bits) < value_count) {
+        bits++;
+    }
+    return (bits + RADIX_SORT_DIGIT_BITS - 1) / RADIX_SORT_DIGIT_BITS;
+}
+
 struct GlobalPathId {
     uint32_t batch_id;
     uint32_t path_index;
@@ -23,6 +39,12 @@ struct FirstTileD3D11 {
     int32_t first_tile = -1;
 };
 
+/// Sort key of a tile in a framebuffer tile list, ordered by framebuffer tile first and then by tile index.
+struct TileSortKeyD3D11 {
+    uint32_t framebuffer_tile_index;
+    uint32_t tile_index;
+};
+
 struct MicrolineD3D11 {
     int16_t from_x_px;
     int16_t from_y_px;
@@ -110,6 +132,14 @@ struct PrepareTilesInfoD3D11 {
 
     /// A transform to apply to the segments.
     Transform2 transform;
+
+    /// Nesting level of each path. Only filled for clip batches.
+    /// A clip path without a subclip is at level 0, otherwise it's one level above its subclip.
+    std::vector<uint32_t> clip_levels;
+
+    /// Backdrop columns of each clip level, in propagation order.
+    /// Empty if all paths can be propagated at once.
+    std::vector<Range> level_column_ranges;
 };
 
 /// Where a path should come from (draw or clip).
@@ -147,6 +177,10 @@ struct TileBatchDataD3D11 {
                   bool z_write,
                   LastSceneInfo &last_scene);
 
+    /// Regroup the backdrop columns by clip level, so that each level can be propagated after its subclips.
+    /// Does nothing if there's only one level.
+    void group_columns_by_clip_level();
+
     /// The ID of this batch.
     /// The renderer should not assume that these values are consecutive.
     uint32_t batch_id = 0;
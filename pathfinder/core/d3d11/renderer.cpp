@@ -19,8 +19,12 @@
     #include "../../shaders/generated/bound_comp_shdbin.h"
     #include "../../shaders/generated/dice_comp_shdbin.h"
     #include "../../shaders/generated/fill_comp_shdbin.h"
+    #include "../../shaders/generated/fill_group_comp_shdbin.h"
+    #include "../../shaders/generated/fill_grouped_comp_shdbin.h"
     #include "../../shaders/generated/propagate_comp_shdbin.h"
+    #include "../../shaders/generated/radix_sort_comp_shdbin.h"
     #include "../../shaders/generated/sort_comp_shdbin.h"
+    #include "../../shaders/generated/sort_keys_comp_shdbin.h"
     #include "../../shaders/generated/tile_comp_shdbin.h"
 /* clang-format on */
 
@@ -36,7 +40,22 @@ constexpr uint32_t BOUND_WORKGROUP_SIZE = 64;
 constexpr uint32_t DICE_WORKGROUP_SIZE = 64;
 constexpr uint32_t BIN_WORKGROUP_SIZE = 64;
 constexpr uint32_t PROPAGATE_WORKGROUP_SIZE = 64;
+constexpr uint32_t FILL_GROUP_WORKGROUP_SIZE = 64;
 constexpr uint32_t SORT_WORKGROUP_SIZE = 64;
+constexpr uint32_t SORT_KEYS_WORKGROUP_SIZE = 64;
+constexpr uint32_t RADIX_SORT_WORKGROUP_SIZE = 256;
+
+// Keep these in sync with sort_keys.comp and radix_sort.comp.
+constexpr int32_t SORT_KEYS_MODE_GENERATE = 0;
+constexpr int32_t SORT_KEYS_MODE_LINK = 1;
+constexpr int32_t RADIX_SORT_MODE_COUNT = 0;
+constexpr int32_t RADIX_SORT_MODE_SCAN = 1;
+constexpr int32_t RADIX_SORT_MODE_SCATTER = 2;
+constexpr uint32_t RADIX_SORT_DIGIT_COUNT = 1 << RADIX_SORT_DIGIT_BITS;
+constexpr uint32_t SORT_INFO_HISTOGRAMS = 4;
+
+// Keep this in sync with fill_group.comp and fill_grouped.comp.
+constexpr uint32_t FILL_RANGES_HEADER_SIZE = 4;
 
 // If clear destination texture before drawing using D3D11.
 constexpr int32_t LOAD_ACTION_CLEAR = 0;
@@ -52,10 +71,7 @@ Vec2I pixel_size_to_tile_size(Vec2I pixel_size) {
     return {size.x / TILE_WIDTH, size.y / TILE_HEIGHT};
 }
 
-void SceneSourceBuffers::upload(SegmentsD3D11 &segments,
-                                const std::shared_ptr<GpuMemoryAllocator> &allocator,
-                                const std::shared_ptr<Device> &device,
-                                const std::shared_ptr<CommandEncoder> &encoder) {
+void SceneSourceBuffers::reserve(const SegmentsD3D11 &segments, const std::shared_ptr<GpuMemoryAllocator> &allocator) {
     auto needed_points_capacity = upper_power_of_two(segments.points.size());
     auto needed_point_indices_capacity = upper_power_of_two(segments.indices.size());
 
@@ -66,7 +82,10 @@ void SceneSourceBuffers::upload(SegmentsD3D11 &segments,
         }
 
         points_buffer = std::make_shared<uint64_t>(
-            allocator->allocate_buffer(needed_points_capacity * sizeof(Vec2F), BufferType::Storage, "points buffer"));
+            allocator->allocate_buffer(needed_points_capacity * sizeof(Vec2F),
+                                       BufferType::Storage,
+                                       "points buffer",
+                                       BufferUsage::Static));
 
         points_capacity = needed_points_capacity;
     }
@@ -80,15 +99,35 @@ void SceneSourceBuffers::upload(SegmentsD3D11 &segments,
         point_indices_buffer = std::make_shared<uint64_t>(
             allocator->allocate_buffer(needed_point_indices_capacity * sizeof(SegmentIndicesD3D11),
                                        BufferType::Storage,
-                                       "point indices buffer"));
+                                       "point indices buffer",
+                                       BufferUsage::Static));
 
         point_indices_capacity = needed_point_indices_capacity;
     }
 
     point_indices_count = segments.indices.size();
+}
+
+void SceneSourceBuffers::release(const std::shared_ptr<GpuMemoryAllocator> &allocator) {
+    if (points_buffer) {
+        allocator->free_buffer(*points_buffer);
+        points_buffer = nullptr;
+        points_capacity = 0;
+    }
+
+    if (point_indices_buffer) {
+        allocator->free_buffer(*point_indices_buffer);
+        point_indices_buffer = nullptr;
+        point_indices_capacity = 0;
+    }
+}
 
+void SceneSourceBuffers::upload(SegmentsD3D11 &segments,
+                                const std::shared_ptr<GpuMemoryAllocator> &allocator,
+                                const std::shared_ptr<Device> &device,
+                                const std::shared_ptr<CommandEncoder> &encoder) {
     // Upload data.
-    if (needed_points_capacity != 0 && needed_point_indices_capacity != 0) {
+    if (!segments.points.empty() && !segments.indices.empty()) {
         encoder->write_buffer(allocator->get_buffer(*points_buffer),
                               0,
                               segments.points.size() * sizeof(Vec2F),
@@ -101,6 +140,18 @@ void SceneSourceBuffers::upload(SegmentsD3D11 &segments,
     }
 }
 
+void SceneBuffers::reserve(const SegmentsD3D11 &draw_segments,
+                           const SegmentsD3D11 &clip_segments,
+                           const std::shared_ptr<GpuMemoryAllocator> &allocator) {
+    draw.reserve(draw_segments, allocator);
+    clip.reserve(clip_segments, allocator);
+}
+
+void SceneBuffers::release(const std::shared_ptr<GpuMemoryAllocator> &allocator) {
+    draw.release(allocator);
+    clip.release(allocator);
+}
+
 void SceneBuffers::upload(SegmentsD3D11 &draw_segments,
                           SegmentsD3D11 &clip_segments,
                           const std::shared_ptr<GpuMemoryAllocator> &allocator,
@@ -110,25 +161,25 @@ void SceneBuffers::upload(SegmentsD3D11 &draw_segments,
     clip.upload(clip_segments, allocator, device, encoder);
 }
 
-RendererD3D11::RendererD3D11(const std::shared_ptr<Device> &device, const std::shared_ptr<Queue> &queue)
-    : Renderer(device, queue) {
+RendererD3D11::RendererD3D11(const std::shared_ptr<RendererContext> &_context) : Renderer(_context) {
     allocated_microline_count = INITIAL_ALLOCATED_MICROLINE_COUNT;
     allocated_fill_count = INITIAL_ALLOCATED_FILL_COUNT;
 
-    // Create uniform buffers.
-    bin_ub_id = allocator->allocate_buffer(4 * sizeof(int32_t), BufferType::Uniform, "bin uniform buffer");
-    bound_ub_id = allocator->allocate_buffer(4 * sizeof(int32_t), BufferType::Uniform, "bound uniform buffer");
-    dice_ub0_id = allocator->allocate_buffer(12 * sizeof(float), BufferType::Uniform, "dice uniform buffer 0");
-    dice_ub1_id = allocator->allocate_buffer(4 * sizeof(int32_t), BufferType::Uniform, "dice uniform buffer 1");
-    fill_ub_id = allocator->allocate_buffer(4 * sizeof(int32_t), BufferType::Uniform, "fill uniform buffer");
-    propagate_ub_id = allocator->allocate_buffer(4 * sizeof(int32_t), BufferType::Uniform, "propagate uniform buffer");
-    sort_ub_id = allocator->allocate_buffer(4 * sizeof(int32_t), BufferType::Uniform, "sort uniform buffer");
-    tile_ub_id = allocator->allocate_buffer(sizeof(TileUniformD3d11), BufferType::Uniform, "tile uniform buffer");
+    compute_queue_ = context->compute_queue;
+    if (compute_queue_) {
+        compute_graph_ = std::make_shared<RenderGraph>(allocator);
+    }
+    prepare_graph_ = render_graph;
 }
 
-void RendererD3D11::set_up_pipelines() {
-    auto default_sampler = get_default_sampler();
+RendererD3D11::~RendererD3D11() {
+    // The allocator is shared with the other renderers of the context, so everything has to be given back.
+    free_tile_batch_buffers();
 
+    scene_buffers.release(allocator);
+}
+
+void RendererD3D11::set_up_pipelines() {
     {
         std::vector<DescriptorLayout> layouts = {
             DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
@@ -136,33 +187,26 @@ void RendererD3D11::set_up_pipelines() {
             DescriptorLayout{2, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{3, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{4, ShaderStage::Compute, DescriptorType::StorageBuffer},
-            DescriptorLayout{5, ShaderStage::Compute, DescriptorType::UniformBuffer},
-            DescriptorLayout{6, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(5, ShaderStage::Compute, 12 * sizeof(float)),
+            DescriptorLayout::push_constant(6, ShaderStage::Compute, 4 * sizeof(int32_t)),
         };
 
-        dice_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        dice_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
     dice_descriptor_set = device->create_descriptor_set(dice_descriptor_set_layout_);
-    dice_descriptor_set->add_or_update({
-        Descriptor::uniform(5, allocator->get_buffer(dice_ub0_id)),
-        Descriptor::uniform(6, allocator->get_buffer(dice_ub1_id)),
-    });
 
     {
         std::vector<DescriptorLayout> layouts = {
             DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{1, ShaderStage::Compute, DescriptorType::StorageBuffer},
-            DescriptorLayout{2, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(2, ShaderStage::Compute, 4 * sizeof(int32_t)),
         };
 
-        bound_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        bound_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
     bound_descriptor_set = device->create_descriptor_set(bound_descriptor_set_layout_);
-    bound_descriptor_set->add_or_update({
-        Descriptor::uniform(2, allocator->get_buffer(bound_ub_id)),
-    });
 
     {
         std::vector<DescriptorLayout> layouts = {
@@ -172,16 +216,13 @@ void RendererD3D11::set_up_pipelines() {
             DescriptorLayout{3, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{4, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{5, ShaderStage::Compute, DescriptorType::StorageBuffer},
-            DescriptorLayout{6, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(6, ShaderStage::Compute, 4 * sizeof(int32_t)),
         };
 
-        bin_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        bin_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
     bin_descriptor_set = device->create_descriptor_set(bin_descriptor_set_layout_);
-    bin_descriptor_set->add_or_update({
-        Descriptor::uniform(6, allocator->get_buffer(bin_ub_id)),
-    });
 
     {
         std::vector<DescriptorLayout> layouts = {
@@ -193,32 +234,24 @@ void RendererD3D11::set_up_pipelines() {
             DescriptorLayout{5, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{6, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{7, ShaderStage::Compute, DescriptorType::StorageBuffer},
-            DescriptorLayout{8, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(8, ShaderStage::Compute, 4 * sizeof(int32_t)),
         };
 
-        propagate_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        propagate_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
-    propagate_descriptor_set = device->create_descriptor_set(propagate_descriptor_set_layout_);
-    propagate_descriptor_set->add_or_update({
-        Descriptor::uniform(8, allocator->get_buffer(propagate_ub_id)),
-    });
-
     {
         std::vector<DescriptorLayout> layouts = {
             DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{1, ShaderStage::Compute, DescriptorType::StorageBuffer},
             DescriptorLayout{2, ShaderStage::Compute, DescriptorType::StorageBuffer},
-            DescriptorLayout{3, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(3, ShaderStage::Compute, 4 * sizeof(int32_t)),
         };
 
-        sort_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        sort_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
     sort_descriptor_set = device->create_descriptor_set(sort_descriptor_set_layout_);
-    sort_descriptor_set->add_or_update({
-        Descriptor::uniform(3, allocator->get_buffer(sort_ub_id)),
-    });
 
     {
         std::vector<DescriptorLayout> layouts = {
@@ -227,21 +260,13 @@ void RendererD3D11::set_up_pipelines() {
             DescriptorLayout{2, ShaderStage::Compute, DescriptorType::StorageBuffer}, // Read only.
             DescriptorLayout{3, ShaderStage::Compute, DescriptorType::Image},
             DescriptorLayout{4, ShaderStage::Compute, DescriptorType::Sampler},
-            DescriptorLayout{5, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(5, ShaderStage::Compute, 4 * sizeof(int32_t)),
+            DescriptorLayout{6, ShaderStage::Compute, DescriptorType::StorageBuffer}, // Read only. Grouped fill only.
         };
 
-        fill_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        fill_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
-    fill_descriptor_set = device->create_descriptor_set(fill_descriptor_set_layout_);
-    fill_descriptor_set->add_or_update({
-        Descriptor::sampled(4,
-
-                            allocator->get_texture(area_lut_texture_id),
-                            default_sampler),
-        Descriptor::uniform(5, allocator->get_buffer(fill_ub_id)),
-    });
-
     {
         std::vector<DescriptorLayout> layouts = {
             DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
@@ -252,51 +277,65 @@ void RendererD3D11::set_up_pipelines() {
             DescriptorLayout{5, ShaderStage::Compute, DescriptorType::Sampler},
             DescriptorLayout{6, ShaderStage::Compute, DescriptorType::Sampler},
             DescriptorLayout{7, ShaderStage::Compute, DescriptorType::Image}, // Unused binding.
-            DescriptorLayout{8, ShaderStage::Compute, DescriptorType::UniformBuffer},
+            DescriptorLayout::push_constant(8, ShaderStage::Compute, sizeof(TileUniformD3d11)),
         };
 
-        tile_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        tile_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
-    tile_descriptor_set = device->create_descriptor_set(tile_descriptor_set_layout_);
-    tile_descriptor_set->add_or_update({
-        Descriptor::sampled(6,
-                            allocator->get_texture(dummy_texture_id),
-                            default_sampler), // Unused binding.
-        Descriptor::uniform(8, allocator->get_buffer(tile_ub_id)),
-    });
-
-    auto dice_shader = Shader::create_from_shdbin(dice_comp_shdbin, sizeof(dice_comp_shdbin));
-    auto bound_shader = Shader::create_from_shdbin(bound_comp_shdbin, sizeof(bound_comp_shdbin));
-    auto bin_shader = Shader::create_from_shdbin(bin_comp_shdbin, sizeof(bin_comp_shdbin));
-    auto propagate_shader = Shader::create_from_shdbin(propagate_comp_shdbin, sizeof(propagate_comp_shdbin));
-    auto fill_shader = Shader::create_from_shdbin(fill_comp_shdbin, sizeof(fill_comp_shdbin));
-    auto sort_shader = Shader::create_from_shdbin(sort_comp_shdbin, sizeof(sort_comp_shdbin));
-    auto tile_shader = Shader::create_from_shdbin(tile_comp_shdbin, sizeof(tile_comp_shdbin));
-
     // These pipelines will be called by order.
-    dice_pipeline = device->create_compute_pipeline(device->create_shader_module(dice_shader, "dice comp"),
-                                                    dice_descriptor_set_layout_,
-                                                    "dice pipeline"); // 1
-    bound_pipeline = device->create_compute_pipeline(device->create_shader_module(bound_shader, "bound comp"),
-                                                     bound_descriptor_set_layout_,
-                                                     "bound pipeline"); // 2
-    bin_pipeline = device->create_compute_pipeline(device->create_shader_module(bin_shader, "bin comp"),
-                                                   bin_descriptor_set_layout_,
-                                                   "bin pipeline"); // 3
-    propagate_pipeline =
-        device->create_compute_pipeline(device->create_shader_module(propagate_shader, "propagate comp"),
-                                        propagate_descriptor_set_layout_,
-                                        "propagate pipeline"); // 4
-    fill_pipeline = device->create_compute_pipeline(device->create_shader_module(fill_shader, "fill comp"),
-                                                    fill_descriptor_set_layout_,
-                                                    "fill pipeline"); // 5
-    sort_pipeline = device->create_compute_pipeline(device->create_shader_module(sort_shader, "sort comp"),
-                                                    sort_descriptor_set_layout_,
-                                                    "sort pipeline"); // 6
-    tile_pipeline = device->create_compute_pipeline(device->create_shader_module(tile_shader, "tile comp"),
-                                                    tile_descriptor_set_layout_,
-                                                    "tile pipeline"); // 7
+    dice_pipeline = get_or_create_compute_pipeline(dice_comp_shdbin,
+                                                   sizeof(dice_comp_shdbin),
+                                                   "dice comp",
+                                                   dice_descriptor_set_layout_,
+                                                   "dice pipeline"); // 1
+    bound_pipeline = get_or_create_compute_pipeline(bound_comp_shdbin,
+                                                    sizeof(bound_comp_shdbin),
+                                                    "bound comp",
+                                                    bound_descriptor_set_layout_,
+                                                    "bound pipeline"); // 2
+    bin_pipeline = get_or_create_compute_pipeline(bin_comp_shdbin,
+                                                  sizeof(bin_comp_shdbin),
+                                                  "bin comp",
+                                                  bin_descriptor_set_layout_,
+                                                  "bin pipeline"); // 3
+    propagate_pipeline = get_or_create_compute_pipeline(propagate_comp_shdbin,
+                                                        sizeof(propagate_comp_shdbin),
+                                                        "propagate comp",
+                                                        propagate_descriptor_set_layout_,
+                                                        "propagate pipeline"); // 4
+    fill_pipeline = get_or_create_compute_pipeline(fill_comp_shdbin,
+                                                   sizeof(fill_comp_shdbin),
+                                                   "fill comp",
+                                                   fill_descriptor_set_layout_,
+                                                   "fill pipeline"); // 5
+    sort_pipeline = get_or_create_compute_pipeline(sort_comp_shdbin,
+                                                   sizeof(sort_comp_shdbin),
+                                                   "sort comp",
+                                                   sort_descriptor_set_layout_,
+                                                   "sort pipeline"); // 6
+    tile_pipeline = get_or_create_compute_pipeline(tile_comp_shdbin,
+                                                   sizeof(tile_comp_shdbin),
+                                                   "tile comp",
+                                                   tile_descriptor_set_layout_,
+                                                   "tile pipeline"); // 7
+}
+
+std::shared_ptr<ComputePipeline> RendererD3D11::get_or_create_compute_pipeline(
+    const uint8_t *shdbin,
+    size_t shdbin_size,
+    const std::string &shader_label,
+    const std::shared_ptr<DescriptorSetLayout> &layout,
+    const std::string &label) {
+    return context->get_or_create_compute_pipeline(label, [&]() -> std::shared_ptr<ComputePipeline> {
+        auto shader = Shader::create_from_shdbin(shdbin, shdbin_size);
+
+        auto shader_module = device->create_shader_module(shader, shader_label);
+        if (!shader_module) {
+            return nullptr;
+        }
+        return device->create_compute_pipeline(shader_module, layout, label);
+    });
 }
 
 void RendererD3D11::draw(const std::shared_ptr<SceneBuilder> &_scene_builder, bool _clear_dst_texture) {
@@ -304,35 +343,61 @@ void RendererD3D11::draw(const std::shared_ptr<SceneBuilder> &_scene_builder, bo
 
     allocator->begin_frame();
 
+    if (gpu_profiler) {
+        gpu_profiler->begin_frame();
+    }
+
     auto *scene_builder = static_cast<SceneBuilderD3D11 *>(_scene_builder.get());
 
     if (scene_builder->built_segments.draw_segments.points.empty()) {
         return;
     }
 
+    auto &built_segments = scene_builder->built_segments;
+
+    // Only the GPU backend has stages to run on the compute queue.
+    bool use_compute_queue = compute_queue_ && compute_backend_ == ComputeBackendD3D11::Gpu;
+    prepare_graph_ = use_compute_queue ? compute_graph_ : render_graph;
+
     // RenderCommand::UploadSceneD3D11
-    upload_scene(scene_builder->built_segments.draw_segments, scene_builder->built_segments.clip_segments);
+    // The CPU backend reads the segments directly.
+    if (compute_backend_ == ComputeBackendD3D11::Gpu) {
+        upload_scene(built_segments.draw_segments, built_segments.clip_segments);
+    }
 
     alpha_tile_count = 0;
+    cpu_stage_stats_ = {};
 
-    // Prepare clip tiles.
+    // Prepare clip tiles. All clip paths are in one batch, whatever their nesting level.
     {
-        auto &prepare_batches = scene_builder->clip_batches_d3d11->prepare_batches;
-
-        for (auto iter = prepare_batches.rbegin(); iter != prepare_batches.rend(); ++iter) {
-            if (iter->path_count > 0) {
-                prepare_tiles(*iter);
+        auto &prepare_batch = scene_builder->clip_batches_d3d11->prepare_batch;
+
+        if (prepare_batch.path_count > 0) {
+            if (compute_backend_ == ComputeBackendD3D11::Cpu) {
+                prepare_tiles_on_cpu(prepare_batch, built_segments.clip_segments);
+            } else {
+                prepare_tiles(prepare_batch);
+                submit_prepared_batch();
             }
         }
     }
 
     // Draw tiles.
     for (auto &batch : scene_builder->tile_batches) {
-        prepare_and_draw_tiles(batch);
+        prepare_and_draw_tiles(batch, built_segments.draw_segments);
+    }
+
+    submit_render_graph("draw tiles", false);
+
+    // Prepared tiles that weren't drawn. The frame's resources must not be reused while they're being prepared.
+    if (pending_compute_submission_) {
+        compute_queue_->wait(pending_compute_submission_);
+        pending_compute_submission_ = 0;
     }
 
     // Clear all batch info.
     free_tile_batch_buffers();
+    cpu_tile_batches_.clear();
 }
 
 std::shared_ptr<Texture> RendererD3D11::get_dest_texture() {
@@ -343,16 +408,121 @@ void RendererD3D11::set_dest_texture(const std::shared_ptr<Texture> &new_texture
     dest_texture = new_texture;
 }
 
+void RendererD3D11::set_compute_backend(ComputeBackendD3D11 backend) {
+    compute_backend_ = backend;
+
+    if (compute_backend_ == ComputeBackendD3D11::Cpu && !cpu_stages_) {
+        cpu_stages_ = std::make_unique<CpuStagesD3D11>();
+    }
+}
+
+ComputeBackendD3D11 RendererD3D11::get_compute_backend() const {
+    return compute_backend_;
+}
+
+void RendererD3D11::set_tile_sort(TileSortD3D11 tile_sort) {
+    tile_sort_ = tile_sort;
+}
+
+TileSortD3D11 RendererD3D11::get_tile_sort() const {
+    return tile_sort_;
+}
+
+void RendererD3D11::set_fill_variant(FillVariantD3D11 fill_variant) {
+    fill_variant_ = fill_variant;
+}
+
+FillVariantD3D11 RendererD3D11::get_fill_variant() const {
+    return fill_variant_;
+}
+
+CpuStageStatsD3D11 RendererD3D11::get_cpu_stage_stats() const {
+    return cpu_stage_stats_;
+}
+
 void RendererD3D11::upload_scene(SegmentsD3D11 &draw_segments, SegmentsD3D11 &clip_segments) {
-    auto encoder = device->create_command_encoder("upload scene");
-    scene_buffers.upload(draw_segments, clip_segments, allocator, device, encoder);
-    queue->submit(encoder, fence);
+    // Reallocate right away, so that the stages recorded next bind the new buffers.
+    scene_buffers.reserve(draw_segments, clip_segments, allocator);
+
+    std::vector<RenderGraphResource> scene_buffer_resources;
+    for (const auto *source_buffers : {&scene_buffers.draw, &scene_buffers.clip}) {
+        for (const auto &buffer_id : {source_buffers->points_buffer, source_buffers->point_indices_buffer}) {
+            if (buffer_id) {
+                scene_buffer_resources.push_back(prepare_graph_->import_buffer(allocator->get_buffer(*buffer_id)));
+            }
+        }
+    }
+
+    // The scene builder keeps the segments until the render graph is executed at the end of draw().
+    prepare_graph_->add_pass("upload scene",
+                             {},
+                             scene_buffer_resources,
+                             [this, &draw_segments, &clip_segments](const std::shared_ptr<CommandEncoder> &encoder) {
+                                 scene_buffers.upload(draw_segments, clip_segments, allocator, device, encoder);
+                             });
+}
+
+void RendererD3D11::submit_render_graph(const std::string &label, bool wait) {
+    if (render_graph->is_empty()) {
+        return;
+    }
+
+    auto encoder = device->create_command_encoder(label);
+
+    render_graph->execute(encoder, gpu_profiler.get());
+
+    // Fills and tiles are drawn from what the compute queue has prepared.
+    if (pending_compute_submission_) {
+        queue->wait_for(*compute_queue_, pending_compute_submission_);
+        pending_compute_submission_ = 0;
+    }
+
+    if (wait) {
+        queue->submit(encoder, fence);
+    } else {
+        queue->submit_async(encoder);
+    }
+}
+
+void RendererD3D11::submit_prepare_graph(const std::string &label, bool wait) {
+    if (prepare_graph_ == render_graph) {
+        submit_render_graph(label, wait);
+        return;
+    }
+
+    if (prepare_graph_->is_empty()) {
+        return;
+    }
+
+    auto encoder = device->create_command_encoder(label);
+
+    prepare_graph_->execute(encoder, gpu_profiler.get());
+
+    pending_compute_submission_ = compute_queue_->submit_async(encoder);
+
+    if (wait) {
+        compute_queue_->wait(pending_compute_submission_);
+    }
+}
+
+void RendererD3D11::submit_prepared_batch() {
+    if (prepare_graph_ == render_graph) {
+        return;
+    }
+
+    // Sorting only links the tiles, which filling doesn't read, so the fills can wait for it as well.
+    submit_prepare_graph("sort tiles", false);
+    submit_render_graph("draw batch", false);
 }
 
-void RendererD3D11::prepare_and_draw_tiles(DrawTileBatchD3D11 &batch) {
+void RendererD3D11::prepare_and_draw_tiles(DrawTileBatchD3D11 &batch, const SegmentsD3D11 &draw_segments) {
     auto tile_batch_id = batch.tile_batch_data.batch_id;
 
-    prepare_tiles(batch.tile_batch_data);
+    if (compute_backend_ == ComputeBackendD3D11::Cpu) {
+        prepare_tiles_on_cpu(batch.tile_batch_data, draw_segments);
+    } else {
+        prepare_tiles(batch.tile_batch_data);
+    }
 
     auto &batch_info = tile_batch_info[tile_batch_id];
 
@@ -360,6 +530,8 @@ void RendererD3D11::prepare_and_draw_tiles(DrawTileBatchD3D11 &batch) {
                batch_info.first_tile_map_buffer_id,
                batch.render_target_id,
                batch.color_texture_info);
+
+    submit_prepared_batch();
 }
 
 void RendererD3D11::draw_tiles(uint64_t tiles_d3d11_buffer_id,
@@ -406,7 +578,7 @@ void RendererD3D11::draw_tiles(uint64_t tiles_d3d11_buffer_id,
     }
     Vec2F color_texture_size = color_texture->get_size().to_f32();
 
-    // Update uniform buffers.
+    // Pushed along with the dispatch.
     TileUniformD3d11 uniform_data;
     uniform_data.load_action = clear_op;
     uniform_data.tile_size = {TILE_WIDTH, TILE_HEIGHT};
@@ -417,34 +589,58 @@ void RendererD3D11::draw_tiles(uint64_t tiles_d3d11_buffer_id,
                                       (float)(MASK_FRAMEBUFFER_HEIGHT * mask_storage.allocated_page_count)};
     uniform_data.texture_metadata_size = {TEXTURE_METADATA_TEXTURE_WIDTH, TEXTURE_METADATA_TEXTURE_HEIGHT};
 
-    auto encoder = device->create_command_encoder("draw tiles");
-
-    encoder->write_buffer(allocator->get_buffer(tile_ub_id), 0, sizeof(TileUniformD3d11), &uniform_data);
-
-    // Update descriptor set.
-    tile_descriptor_set->add_or_update({
-        // Read only.
-        Descriptor::storage(0, allocator->get_buffer(tiles_d3d11_buffer_id)),
-        // Read only.
-        Descriptor::storage(1, allocator->get_buffer(first_tile_map_buffer_id)),
-        Descriptor::sampled(2, allocator->get_texture(metadata_texture_id), default_sampler),
-        Descriptor::sampled(3, allocator->get_texture(dummy_texture_id), default_sampler),
-        Descriptor::sampled(4, color_texture, color_texture_sampler),
-        Descriptor::sampled(5, allocator->get_texture(*mask_storage.texture_id), default_sampler),
-        Descriptor::image(7, target_texture),
-    });
+    auto tiles_d3d11_buffer = allocator->get_buffer(tiles_d3d11_buffer_id);
+    auto first_tile_map_buffer = allocator->get_buffer(first_tile_map_buffer_id);
+    auto metadata_texture = allocator->get_texture(metadata_texture_id);
+    auto mask_texture = allocator->get_texture(*mask_storage.texture_id);
 
-    encoder->begin_compute_pass();
+    auto tile_descriptor_set = device->get_or_create_descriptor_set(
+        tile_descriptor_set_layout_,
+        {
+            // Read only.
+            Descriptor::storage(0, tiles_d3d11_buffer),
+            // Read only.
+            Descriptor::storage(1, first_tile_map_buffer),
+            Descriptor::sampled(2, metadata_texture, default_sampler),
+            Descriptor::sampled(3, allocator->get_texture(dummy_texture_id), default_sampler),
+            Descriptor::sampled(4, color_texture, color_texture_sampler),
+            Descriptor::sampled(5, mask_texture, default_sampler),
+            // Unused binding.
+            Descriptor::sampled(6, allocator->get_texture(dummy_texture_id), default_sampler),
+            Descriptor::image(7, target_texture),
+        });
 
-    encoder->bind_compute_pipeline(tile_pipeline);
+    // The color texture may be a render target drawn earlier in the frame.
+    std::vector<RenderGraphResource> reads = {
+        render_graph->import_buffer(tiles_d3d11_buffer),
+        render_graph->import_buffer(first_tile_map_buffer),
+        render_graph->import_texture(metadata_texture),
+        render_graph->import_texture(color_texture),
+        render_graph->import_texture(mask_texture),
+    };
 
-    encoder->bind_descriptor_set(tile_descriptor_set);
+    render_graph->add_pass(
+        "draw tiles",
+        reads,
+        {render_graph->import_texture(target_texture)},
+        [this, uniform_data, tile_descriptor_set, framebuffer_tile_size0](
+            const std::shared_ptr<CommandEncoder> &encoder) {
+            begin_gpu_scope(encoder, "draw tiles");
 
-    encoder->dispatch(framebuffer_tile_size0.x, framebuffer_tile_size0.y, 1);
+            encoder->begin_compute_pass();
 
-    encoder->end_compute_pass();
+            encoder->bind_compute_pipeline(tile_pipeline);
 
-    queue->submit(encoder, fence);
+            encoder->bind_descriptor_set(tile_descriptor_set);
+
+            encoder->push_constants(8, sizeof(TileUniformD3d11), &uniform_data);
+
+            encoder->dispatch(framebuffer_tile_size0.x, framebuffer_tile_size0.y, 1);
+
+            encoder->end_compute_pass();
+
+            end_gpu_scope(encoder);
+        });
 }
 
 Vec2I RendererD3D11::tile_size() const {
@@ -457,7 +653,9 @@ uint64_t RendererD3D11::allocate_z_buffer() {
     // SSBOs to 8 (#373).
     // Add FILL_INDIRECT_DRAW_PARAMS_SIZE in case tile size is zero.
     auto size = tile_size().area() + FILL_INDIRECT_DRAW_PARAMS_SIZE;
-    auto buffer_id = allocator->allocate_buffer(size * sizeof(int32_t), BufferType::Storage, "z buffer");
+    // The fill indirect draw params are read back by mapping.
+    auto buffer_id =
+        allocator->allocate_buffer(size * sizeof(int32_t), BufferType::Storage, "z buffer", BufferUsage::Readback);
 
     return buffer_id;
 }
@@ -465,14 +663,20 @@ uint64_t RendererD3D11::allocate_z_buffer() {
 uint64_t RendererD3D11::allocate_first_tile_map() {
     auto size = tile_size().area();
     auto buffer_id =
-        allocator->allocate_buffer(size * sizeof(FirstTileD3D11), BufferType::Storage, "first tile map buffer");
+        allocator->allocate_buffer(size * sizeof(FirstTileD3D11),
+                                   BufferType::Storage,
+                                   "first tile map buffer",
+                                   BufferUsage::GpuOnly);
 
     return buffer_id;
 }
 
 uint64_t RendererD3D11::allocate_alpha_tile_info(uint32_t index_count) {
     auto buffer_id =
-        allocator->allocate_buffer(index_count * sizeof(AlphaTileD3D11), BufferType::Storage, "alpha tile buffer");
+        allocator->allocate_buffer(index_count * sizeof(AlphaTileD3D11),
+                                   BufferType::Storage,
+                                   "alpha tile buffer",
+                                   BufferUsage::GpuOnly);
 
     return buffer_id;
 }
@@ -483,18 +687,28 @@ PropagateMetadataBufferIDsD3D11 RendererD3D11::upload_propagate_metadata(
     auto propagate_metadata_storage_id =
         allocator->allocate_buffer(propagate_metadata.size() * sizeof(PropagateMetadataD3D11),
                                    BufferType::Storage,
-                                   "propagate metadata buffer");
+                                   "propagate metadata buffer",
+                                   BufferUsage::Static);
 
     auto backdrops_storage_id = allocator->allocate_buffer(backdrops.size() * sizeof(BackdropInfoD3D11),
                                                            BufferType::Storage,
-                                                           "backdrops buffer");
+                                                           "backdrops buffer",
+                                                           BufferUsage::GpuOnly);
+
+    auto propagate_metadata_buffer = allocator->get_buffer(propagate_metadata_storage_id);
+
+    // The batch data outlives the render graph execution.
+    const auto *data = propagate_metadata.data();
+    uint32_t data_size = propagate_metadata.size() * sizeof(PropagateMetadataD3D11);
+
+    auto callback = [propagate_metadata_buffer, data, data_size](const std::shared_ptr<CommandEncoder> &encoder) {
+        encoder->write_buffer(propagate_metadata_buffer, 0, data_size, data);
+    };
 
-    auto encoder = device->create_command_encoder("upload to propagate metadata buffer");
-    encoder->write_buffer(allocator->get_buffer(propagate_metadata_storage_id),
-                          0,
-                          propagate_metadata.size() * sizeof(PropagateMetadataD3D11),
-                          propagate_metadata.data());
-    queue->submit(encoder, fence);
+    prepare_graph_->add_pass("upload to propagate metadata buffer",
+                             {},
+                             {prepare_graph_->import_buffer(propagate_metadata_buffer)},
+                             callback);
 
     return {propagate_metadata_storage_id, backdrops_storage_id};
 }
@@ -502,27 +716,25 @@ PropagateMetadataBufferIDsD3D11 RendererD3D11::upload_propagate_metadata(
 void RendererD3D11::upload_initial_backdrops(uint64_t backdrops_buffer_id, std::vector<BackdropInfoD3D11> &backdrops) {
     auto backdrops_buffer = allocator->get_buffer(backdrops_buffer_id);
 
-    auto encoder = device->create_command_encoder("upload initial backdrops");
-    encoder->write_buffer(backdrops_buffer, 0, backdrops.size() * sizeof(BackdropInfoD3D11), backdrops.data());
-    queue->submit(encoder, fence);
+    // The batch data outlives the render graph execution.
+    const auto *data = backdrops.data();
+    uint32_t data_size = backdrops.size() * sizeof(BackdropInfoD3D11);
+
+    prepare_graph_->add_pass("upload initial backdrops",
+                             {},
+                             {prepare_graph_->import_buffer(backdrops_buffer)},
+                             [backdrops_buffer, data, data_size](const std::shared_ptr<CommandEncoder> &encoder) {
+                                 encoder->write_buffer(backdrops_buffer, 0, data_size, data);
+                             });
 }
 
 void RendererD3D11::prepare_tiles(TileBatchDataD3D11 &batch) {
     // Upload tiles to GPU or allocate them as appropriate.
     auto tiles_d3d11_buffer_id =
-        allocator->allocate_buffer(batch.tile_count * sizeof(TileD3D11), BufferType::Storage, "tiles d3d11 buffer");
-
-    // Fetch and/or allocate clip storage as needed.
-    std::shared_ptr<ClipBufferIDs> clip_buffer_ids;
-    if (batch.clipped_path_info) {
-        auto clip_batch_id = batch.clipped_path_info->clip_batch_id;
-
-        auto clip_tile_batch_info = tile_batch_info[clip_batch_id];
-        auto metadata = clip_tile_batch_info.propagate_metadata_buffer_id;
-        auto tiles = clip_tile_batch_info.tiles_d3d11_buffer_id;
-
-        clip_buffer_ids = std::make_shared<ClipBufferIDs>(ClipBufferIDs{metadata, tiles});
-    }
+        allocator->allocate_buffer(batch.tile_count * sizeof(TileD3D11),
+                                   BufferType::Storage,
+                                   "tiles d3d11 buffer",
+                                   BufferUsage::GpuOnly);
 
     // Allocate a Z-buffer.
     auto z_buffer_id = allocate_z_buffer();
@@ -534,6 +746,30 @@ void RendererD3D11::prepare_tiles(TileBatchDataD3D11 &batch) {
     auto propagate_metadata_buffer_ids =
         upload_propagate_metadata(batch.prepare_info.propagate_metadata, batch.prepare_info.backdrops);
 
+    // Fetch clip storage as needed.
+    std::shared_ptr<ClipBufferIDs> clip_buffer_ids;
+    if (batch.clipped_path_info) {
+        auto clip_batch_id = batch.clipped_path_info->clip_batch_id;
+
+        if (clip_batch_id == batch.batch_id) {
+            // Clip paths with subclips are clipped by paths of the same batch, which are a level below.
+            clip_buffer_ids = std::make_shared<ClipBufferIDs>(
+                ClipBufferIDs{propagate_metadata_buffer_ids.propagate_metadata, tiles_d3d11_buffer_id});
+        } else {
+            auto clip_tile_batch_info = tile_batch_info[clip_batch_id];
+            auto metadata = clip_tile_batch_info.propagate_metadata_buffer_id;
+            auto tiles = clip_tile_batch_info.tiles_d3d11_buffer_id;
+
+            clip_buffer_ids = std::make_shared<ClipBufferIDs>(ClipBufferIDs{metadata, tiles});
+        }
+    }
+
+    // Propagate level by level, or all columns at once if there's only one level.
+    auto column_ranges = batch.prepare_info.level_column_ranges;
+    if (column_ranges.empty()) {
+        column_ranges.emplace_back(0, batch.prepare_info.backdrops.size());
+    }
+
     // Dice (flatten) segments into micro-lines. We might have to do this twice if our
     // first attempt runs out of space in the storage buffer.
     std::shared_ptr<MicrolinesBufferIDsD3D11> microlines_storage{};
@@ -583,7 +819,7 @@ void RendererD3D11::prepare_tiles(TileBatchDataD3D11 &batch) {
 
     auto alpha_tiles_buffer_id = allocate_alpha_tile_info(batch.tile_count);
 
-    auto propagate_tiles_info = propagate_tiles(batch.prepare_info.backdrops.size(),
+    auto propagate_tiles_info = propagate_tiles(column_ranges,
                                                 tiles_d3d11_buffer_id,
                                                 z_buffer_id,
                                                 first_tile_map_buffer_id,
@@ -603,7 +839,11 @@ void RendererD3D11::prepare_tiles(TileBatchDataD3D11 &batch) {
     allocator->free_buffer(alpha_tiles_buffer_id);
 
     // FIXME(pcwalton): This seems like the wrong place to do this...
-    sort_tiles(tiles_d3d11_buffer_id, first_tile_map_buffer_id, z_buffer_id);
+    if (tile_sort_ == TileSortD3D11::Radix && set_up_radix_sort_pipelines()) {
+        sort_tiles_by_keys(tiles_d3d11_buffer_id, first_tile_map_buffer_id, z_buffer_id, batch.tile_count);
+    } else {
+        sort_tiles(tiles_d3d11_buffer_id, first_tile_map_buffer_id, z_buffer_id);
+    }
 
     // Record tile batch info.
     tile_batch_info[batch.batch_id] = TileBatchInfoD3D11{
@@ -615,6 +855,171 @@ void RendererD3D11::prepare_tiles(TileBatchDataD3D11 &batch) {
     };
 }
 
+void RendererD3D11::prepare_tiles_on_cpu(TileBatchDataD3D11 &batch, const SegmentsD3D11 &segments) {
+    // The pending uploads read the mask texels, which are about to be modified.
+    submit_render_graph("upload cpu prepared tiles", false);
+
+    auto &prepare_info = batch.prepare_info;
+
+    auto &cpu_batch = cpu_tile_batches_[batch.batch_id];
+    cpu_batch.propagate_metadata = prepare_info.propagate_metadata;
+
+    // Fetch clip results as needed.
+    const CpuTileBatchD3D11 *clip_batch = nullptr;
+    if (batch.clipped_path_info) {
+        auto iter = cpu_tile_batches_.find(batch.clipped_path_info->clip_batch_id);
+        if (iter != cpu_tile_batches_.end()) {
+            clip_batch = &iter->second;
+        }
+    }
+
+    auto microlines = cpu_stages_->dice(prepare_info.dice_metadata, batch.segment_count, segments, prepare_info.transform);
+
+    cpu_batch.tiles.resize(batch.tile_count);
+    cpu_stages_->bound(cpu_batch.tiles, prepare_info.tile_path_info);
+
+    // Binning modifies the backdrops, so work on a copy like the GPU path does with the backdrops buffer.
+    auto backdrops = prepare_info.backdrops;
+    auto fills = cpu_stages_->bin(microlines, cpu_batch.propagate_metadata, cpu_batch.tiles, backdrops);
+
+    auto tile_area = tile_size().area();
+    cpu_batch.z_buffer.assign(tile_area, 0);
+    cpu_batch.first_tile_map.assign(tile_area, FirstTileD3D11());
+
+    // Propagate and fill level by level, as a level reads both the tiles and the masks of its subclips.
+    auto column_ranges = prepare_info.level_column_ranges;
+    if (column_ranges.empty()) {
+        column_ranges.emplace_back(0, backdrops.size());
+    }
+
+    auto alpha_tile_range = Range(alpha_tile_count, alpha_tile_count);
+    auto old_mask_texture_id = mask_storage.texture_id;
+
+    for (const auto &column_range : column_ranges) {
+        auto alpha_tiles = cpu_stages_->propagate(framebuffer_tile_size(),
+                                                  alpha_tile_count,
+                                                  backdrops,
+                                                  column_range,
+                                                  cpu_batch.propagate_metadata,
+                                                  cpu_batch.tiles,
+                                                  clip_batch,
+                                                  cpu_batch.z_buffer,
+                                                  cpu_batch.first_tile_map);
+
+        auto level_alpha_tile_range = Range(alpha_tile_count, alpha_tile_count + alpha_tiles.size());
+        alpha_tile_count = level_alpha_tile_range.end;
+
+        reallocate_alpha_tile_pages_if_necessary();
+
+        cpu_stages_->resize_mask(mask_storage.allocated_page_count);
+        cpu_stages_->fill(fills, cpu_batch.tiles, alpha_tiles, level_alpha_tile_range);
+    }
+
+    alpha_tile_range.end = alpha_tile_count;
+    bool mask_reallocated = mask_storage.texture_id != old_mask_texture_id;
+
+    if (tile_sort_ == TileSortD3D11::Radix) {
+        cpu_stages_->sort_by_keys(cpu_batch.tiles, cpu_batch.first_tile_map, cpu_batch.z_buffer);
+    } else {
+        cpu_stages_->sort(cpu_batch.tiles, cpu_batch.first_tile_map, cpu_batch.z_buffer);
+    }
+
+    cpu_stage_stats_.batch_count++;
+    cpu_stage_stats_.segment_count += batch.segment_count;
+    cpu_stage_stats_.microline_count += microlines.size();
+    cpu_stage_stats_.tile_count += batch.tile_count;
+    cpu_stage_stats_.fill_count += fills.size();
+    cpu_stage_stats_.alpha_tile_count += alpha_tile_range.length();
+    cpu_stage_stats_.composited_tile_count += cpu_stages_->tile(cpu_batch.tiles, cpu_batch.first_tile_map);
+
+    // Upload the results into the same buffers the GPU path produces.
+    auto tiles_d3d11_buffer_id =
+        allocator->allocate_buffer(batch.tile_count * sizeof(TileD3D11),
+                                   BufferType::Storage,
+                                   "tiles d3d11 buffer",
+                                   BufferUsage::GpuOnly);
+    auto z_buffer_id = allocate_z_buffer();
+    auto first_tile_map_buffer_id = allocate_first_tile_map();
+    auto propagate_metadata_buffer_id =
+        allocator->allocate_buffer(cpu_batch.propagate_metadata.size() * sizeof(PropagateMetadataD3D11),
+                                   BufferType::Storage,
+                                   "propagate metadata buffer",
+                                   BufferUsage::Static);
+
+    std::array<uint32_t, FILL_INDIRECT_DRAW_PARAMS_SIZE> indirect_draw_params = {
+        6, (uint32_t)fills.size(), 0, 0, (uint32_t)alpha_tile_range.length(), (uint32_t)microlines.size(), 0, 0};
+
+    auto tiles_d3d11_buffer = allocator->get_buffer(tiles_d3d11_buffer_id);
+    auto z_buffer = allocator->get_buffer(z_buffer_id);
+    auto first_tile_map_buffer = allocator->get_buffer(first_tile_map_buffer_id);
+    auto propagate_metadata_buffer = allocator->get_buffer(propagate_metadata_buffer_id);
+    auto mask_texture = allocator->get_texture(*mask_storage.texture_id);
+
+    // Upload the mask rows touched by this batch. A reallocated mask texture has lost all previous rows.
+    uint32_t first_mask_row = 0, end_mask_row = 0;
+    if (alpha_tile_range.length() > 0 || mask_reallocated) {
+        // 256 alpha tiles per row of tiles, and 4 texel rows per row of tiles.
+        first_mask_row = mask_reallocated ? 0 : uint32_t(alpha_tile_range.start >> 8) * 4;
+        end_mask_row = uint32_t((alpha_tile_range.end + 0xff) >> 8) * 4;
+    }
+
+    std::vector<RenderGraphResource> writes = {
+        render_graph->import_buffer(tiles_d3d11_buffer),
+        render_graph->import_buffer(z_buffer),
+        render_graph->import_buffer(first_tile_map_buffer),
+        render_graph->import_buffer(propagate_metadata_buffer),
+        render_graph->import_texture(mask_texture),
+    };
+
+    // The CPU batch outlives the render graph execution, and the mask texels stay untouched until
+    // the next batch submits the graph.
+    render_graph->add_pass(
+        "upload cpu prepared tiles",
+        {},
+        writes,
+        [=, &cpu_batch](const std::shared_ptr<CommandEncoder> &encoder) {
+            encoder->write_buffer(tiles_d3d11_buffer,
+                                  0,
+                                  cpu_batch.tiles.size() * sizeof(TileD3D11),
+                                  cpu_batch.tiles.data());
+
+            encoder->write_buffer(z_buffer,
+                                  0,
+                                  FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
+                                  indirect_draw_params.data());
+            encoder->write_buffer(z_buffer,
+                                  FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
+                                  tile_area * sizeof(int32_t),
+                                  cpu_batch.z_buffer.data());
+
+            encoder->write_buffer(first_tile_map_buffer,
+                                  0,
+                                  tile_area * sizeof(FirstTileD3D11),
+                                  cpu_batch.first_tile_map.data());
+
+            encoder->write_buffer(propagate_metadata_buffer,
+                                  0,
+                                  cpu_batch.propagate_metadata.size() * sizeof(PropagateMetadataD3D11),
+                                  cpu_batch.propagate_metadata.data());
+
+            if (end_mask_row > first_mask_row) {
+                auto &mask_texels = cpu_stages_->get_mask_texels();
+                encoder->write_texture(mask_texture,
+                                       RectI(0, first_mask_row, MASK_FRAMEBUFFER_WIDTH, end_mask_row),
+                                       mask_texels.data() + (size_t)first_mask_row * MASK_FRAMEBUFFER_WIDTH);
+            }
+        });
+
+    // Record tile batch info.
+    tile_batch_info[batch.batch_id] = TileBatchInfoD3D11{
+        batch.tile_count,
+        z_buffer_id,
+        tiles_d3d11_buffer_id,
+        propagate_metadata_buffer_id,
+        first_tile_map_buffer_id,
+    };
+}
+
 std::shared_ptr<MicrolinesBufferIDsD3D11> RendererD3D11::dice_segments(std::vector<DiceMetadataD3D11> &dice_metadata,
                                                                        uint32_t batch_segment_count,
                                                                        PathSource path_source,
@@ -622,13 +1027,16 @@ std::shared_ptr<MicrolinesBufferIDsD3D11> RendererD3D11::dice_segments(std::vect
     // Allocate some general buffers.
     auto microlines_buffer_id = allocator->allocate_buffer(allocated_microline_count * sizeof(MicrolineD3D11),
                                                            BufferType::Storage,
-                                                           "microline buffer");
+                                                           "microline buffer",
+                                                           BufferUsage::GpuOnly);
     auto dice_metadata_buffer_id = allocator->allocate_buffer(dice_metadata.size() * sizeof(DiceMetadataD3D11),
                                                               BufferType::Storage,
-                                                              "dice metadata buffer");
+                                                              "dice metadata buffer",
+                                                              BufferUsage::Static);
     auto indirect_draw_params_buffer_id = allocator->allocate_buffer(FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
                                                                      BufferType::Storage,
-                                                                     "indirect draw params buffer");
+                                                                     "indirect draw params buffer",
+                                                                     BufferUsage::Readback);
 
     auto microlines_buffer = allocator->get_buffer(microlines_buffer_id);
     auto dice_metadata_buffer = allocator->get_buffer(dice_metadata_buffer_id);
@@ -642,67 +1050,86 @@ std::shared_ptr<MicrolinesBufferIDsD3D11> RendererD3D11::dice_segments(std::vect
 
     uint32_t indirect_compute_params[8] = {0, 0, 0, 0, point_indices_count, 0, 0, 0};
 
-    auto encoder = device->create_command_encoder("dice segments");
-
-    // Upload dice indirect draw params, which will be read later.
-    encoder->write_buffer(indirect_draw_params_buffer,
-                          0,
-                          FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
-                          indirect_compute_params);
-
-    // Upload dice metadata.
-    encoder->write_buffer(dice_metadata_buffer,
-                          0,
-                          dice_metadata.size() * sizeof(DiceMetadataD3D11),
-                          dice_metadata.data());
-
-    // Update uniform buffers.
-    // Note that a row of mat2 occupies 4 floats just like a mat4.
-    std::array<float, 10> ubo_data0 = {transform.m11(),
-                                       transform.m21(),
-                                       0,
-                                       0,
-                                       transform.m12(),
-                                       transform.m22(),
-                                       0,
-                                       0,
-                                       transform.get_position().x,
-                                       transform.get_position().y};
-    encoder->write_buffer(allocator->get_buffer(dice_ub0_id), 0, 10 * sizeof(float), ubo_data0.data());
-
-    std::array<int32_t, 3> ubo_data1 = {static_cast<int32_t>(dice_metadata.size()),
-                                        static_cast<int32_t>(batch_segment_count),
-                                        static_cast<int32_t>(allocated_microline_count)};
-    encoder->write_buffer(allocator->get_buffer(dice_ub1_id), 0, 3 * sizeof(int32_t), ubo_data1.data());
-
     auto points_buffer = allocator->get_buffer(points_buffer_id);
     auto point_indices_buffer = allocator->get_buffer(point_indices_buffer_id);
 
-    // Bind storage buffers.
-    dice_descriptor_set->add_or_update({
-        // Read and write.
-        Descriptor::storage(0, indirect_draw_params_buffer),
-        // Read only.
-        Descriptor::storage(1, dice_metadata_buffer),
-        // Read only.
-        Descriptor::storage(2, points_buffer),
-        // Read only.
-        Descriptor::storage(3, point_indices_buffer),
-        // Write only.
-        Descriptor::storage(4, microlines_buffer),
-    });
+    std::vector<RenderGraphResource> reads = {
+        prepare_graph_->import_buffer(points_buffer),
+        prepare_graph_->import_buffer(point_indices_buffer),
+    };
+    std::vector<RenderGraphResource> writes = {
+        prepare_graph_->import_buffer(indirect_draw_params_buffer),
+        prepare_graph_->import_buffer(dice_metadata_buffer),
+        prepare_graph_->import_buffer(microlines_buffer),
+    };
+
+    // The graph is submitted before returning, so the pass can refer to locals.
+    prepare_graph_->add_pass("dice segments", reads, writes, [&](const std::shared_ptr<CommandEncoder> &encoder) {
+        // Upload dice indirect draw params, which will be read later.
+        encoder->write_buffer(indirect_draw_params_buffer,
+                              0,
+                              FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
+                              indirect_compute_params);
+
+        // Upload dice metadata.
+        encoder->write_buffer(dice_metadata_buffer,
+                              0,
+                              dice_metadata.size() * sizeof(DiceMetadataD3D11),
+                              dice_metadata.data());
+
+        // Uniforms, pushed with the dispatch. The data covers each whole uniform block.
+        // Note that a row of mat2 occupies 4 floats just like a mat4.
+        std::array<float, 12> ubo_data0 = {transform.m11(),
+                                           transform.m21(),
+                                           0,
+                                           0,
+                                           transform.m12(),
+                                           transform.m22(),
+                                           0,
+                                           0,
+                                           transform.get_position().x,
+                                           transform.get_position().y,
+                                           0,
+                                           0};
+
+        std::array<int32_t, 4> ubo_data1 = {static_cast<int32_t>(dice_metadata.size()),
+                                            static_cast<int32_t>(batch_segment_count),
+                                            static_cast<int32_t>(allocated_microline_count),
+                                            0};
+
+        // Bind storage buffers.
+        dice_descriptor_set->add_or_update({
+            // Read and write.
+            Descriptor::storage(0, indirect_draw_params_buffer),
+            // Read only.
+            Descriptor::storage(1, dice_metadata_buffer),
+            // Read only.
+            Descriptor::storage(2, points_buffer),
+            // Read only.
+            Descriptor::storage(3, point_indices_buffer),
+            // Write only.
+            Descriptor::storage(4, microlines_buffer),
+        });
 
-    encoder->begin_compute_pass();
+        begin_gpu_scope(encoder, "dice segments");
 
-    encoder->bind_compute_pipeline(dice_pipeline);
+        encoder->begin_compute_pass();
 
-    encoder->bind_descriptor_set(dice_descriptor_set);
+        encoder->bind_compute_pipeline(dice_pipeline);
 
-    encoder->dispatch((batch_segment_count + DICE_WORKGROUP_SIZE - 1) / DICE_WORKGROUP_SIZE, 1, 1);
+        encoder->bind_descriptor_set(dice_descriptor_set);
 
-    encoder->end_compute_pass();
+        encoder->push_constants(5, sizeof(ubo_data0), ubo_data0.data());
+        encoder->push_constants(6, sizeof(ubo_data1), ubo_data1.data());
 
-    queue->submit(encoder, fence);
+        encoder->dispatch((batch_segment_count + DICE_WORKGROUP_SIZE - 1) / DICE_WORKGROUP_SIZE, 1, 1);
+
+        encoder->end_compute_pass();
+
+        end_gpu_scope(encoder);
+    });
+
+    submit_prepare_graph("dice segments", true);
 
     // Read indirect draw params back to CPU memory.
     indirect_draw_params_buffer->download_via_mapping(FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
@@ -733,45 +1160,58 @@ std::shared_ptr<MicrolinesBufferIDsD3D11> RendererD3D11::dice_segments(std::vect
 void RendererD3D11::bound(uint64_t tiles_d3d11_buffer_id,
                           uint32_t tile_count,
                           std::vector<TilePathInfoD3D11> &tile_path_info) {
-    // This is a staging buffer, which will be freed at the end of this function.
-    auto path_info_buffer_id = allocator->allocate_buffer(tile_path_info.size() * sizeof(TilePathInfoD3D11),
+    // Only used by this pass, so it's transient.
+    auto path_info_buffer = prepare_graph_->create_buffer(tile_path_info.size() * sizeof(TilePathInfoD3D11),
                                                           BufferType::Storage,
                                                           "path info buffer");
 
-    auto encoder = device->create_command_encoder("bound");
-
-    // Upload buffer data.
-    auto tile_path_info_buffer = allocator->get_buffer(path_info_buffer_id);
-    encoder->write_buffer(tile_path_info_buffer,
-                          0,
-                          tile_path_info.size() * sizeof(TilePathInfoD3D11),
-                          tile_path_info.data());
-
-    // Update uniform buffers.
-    std::array<int32_t, 2> ubo_data = {static_cast<int32_t>(tile_path_info.size()), static_cast<int32_t>(tile_count)};
-    encoder->write_buffer(allocator->get_buffer(bound_ub_id), 0, 2 * sizeof(int32_t), ubo_data.data());
-
-    // Update the descriptor set.
-    bound_descriptor_set->add_or_update({
-        // Read only.
-        Descriptor::storage(0, tile_path_info_buffer),
-        // Write only.
-        Descriptor::storage(1, allocator->get_buffer(tiles_d3d11_buffer_id)),
-    });
+    auto tiles_d3d11_buffer = allocator->get_buffer(tiles_d3d11_buffer_id);
 
-    encoder->begin_compute_pass();
+    // The batch data outlives the render graph execution.
+    const auto *path_info_data = tile_path_info.data();
+    uint32_t path_info_count = tile_path_info.size();
+
+    prepare_graph_->add_pass(
+        "bound",
+        {},
+        {path_info_buffer, prepare_graph_->import_buffer(tiles_d3d11_buffer)},
+        [this, path_info_buffer, tiles_d3d11_buffer, path_info_data, path_info_count, tile_count](
+            const std::shared_ptr<CommandEncoder> &encoder) {
+            // Upload buffer data.
+            auto tile_path_info_buffer = prepare_graph_->get_buffer(path_info_buffer);
+            encoder->write_buffer(tile_path_info_buffer,
+                                  0,
+                                  path_info_count * sizeof(TilePathInfoD3D11),
+                                  path_info_data);
+
+            // Update the descriptor set.
+            bound_descriptor_set->add_or_update({
+                // Read only.
+                Descriptor::storage(0, tile_path_info_buffer),
+                // Write only.
+                Descriptor::storage(1, tiles_d3d11_buffer),
+            });
+
+            begin_gpu_scope(encoder, "bound");
 
-    encoder->bind_compute_pipeline(bound_pipeline);
+            encoder->begin_compute_pass();
 
-    encoder->bind_descriptor_set(bound_descriptor_set);
+            encoder->bind_compute_pipeline(bound_pipeline);
 
-    encoder->dispatch((tile_count + BOUND_WORKGROUP_SIZE - 1) / BOUND_WORKGROUP_SIZE, 1, 1);
+            encoder->bind_descriptor_set(bound_descriptor_set);
 
-    encoder->end_compute_pass();
+            std::array<int32_t, 4> ubo_data = {static_cast<int32_t>(path_info_count),
+                                               static_cast<int32_t>(tile_count),
+                                               0,
+                                               0};
+            encoder->push_constants(2, sizeof(ubo_data), ubo_data.data());
 
-    queue->submit(encoder, fence);
+            encoder->dispatch((tile_count + BOUND_WORKGROUP_SIZE - 1) / BOUND_WORKGROUP_SIZE, 1, 1);
 
-    allocator->free_buffer(path_info_buffer_id);
+            encoder->end_compute_pass();
+
+            end_gpu_scope(encoder);
+        });
 }
 
 std::shared_ptr<FillBufferInfoD3D11> RendererD3D11::bin_segments(
@@ -781,55 +1221,81 @@ std::shared_ptr<FillBufferInfoD3D11> RendererD3D11::bin_segments(
     uint64_t z_buffer_id) {
     // What will be the output of this function.
     auto fill_vertex_buffer_id =
-        allocator->allocate_buffer(allocated_fill_count * sizeof(Fill), BufferType::Storage, "fill vertex buffer");
+        allocator->allocate_buffer(allocated_fill_count * sizeof(Fill),
+                                   BufferType::Storage,
+                                   "fill vertex buffer",
+                                   BufferUsage::GpuOnly);
 
     uint32_t indirect_draw_params[FILL_INDIRECT_DRAW_PARAMS_SIZE] = {6, 0, 0, 0, 0, microlines_storage.count, 0, 0};
 
-    auto encoder = device->create_command_encoder("bin segments");
-
+    auto microlines_buffer = allocator->get_buffer(microlines_storage.buffer_id);
+    auto propagate_metadata_buffer = allocator->get_buffer(propagate_metadata_buffer_ids.propagate_metadata);
     auto z_buffer = allocator->get_buffer(z_buffer_id);
+    auto fill_vertex_buffer = allocator->get_buffer(fill_vertex_buffer_id);
+    auto tiles_d3d11_buffer = allocator->get_buffer(tiles_d3d11_buffer_id);
+    auto backdrops_buffer = allocator->get_buffer(propagate_metadata_buffer_ids.backdrops);
 
-    // Upload Z buffer data.
-    {
-        // Upload fill indirect draw params to header of the Z-buffer.
-        // This is in the Z-buffer, not its own buffer, to work around the 8 SSBO limitation on
-        // some devices (#373).
-        encoder->write_buffer(z_buffer, 0, FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t), indirect_draw_params);
-
-        // Update uniform buffers.
-        std::array<int32_t, 2> ubo_data = {(int32_t)microlines_storage.count, (int32_t)allocated_fill_count};
-        encoder->write_buffer(allocator->get_buffer(bin_ub_id), 0, 2 * sizeof(int32_t), ubo_data.data());
-    }
+    std::vector<RenderGraphResource> reads = {
+        prepare_graph_->import_buffer(microlines_buffer),
+        prepare_graph_->import_buffer(propagate_metadata_buffer),
+        prepare_graph_->import_buffer(tiles_d3d11_buffer),
+        prepare_graph_->import_buffer(backdrops_buffer),
+    };
+    std::vector<RenderGraphResource> writes = {
+        prepare_graph_->import_buffer(z_buffer),
+        prepare_graph_->import_buffer(fill_vertex_buffer),
+        prepare_graph_->import_buffer(tiles_d3d11_buffer),
+        prepare_graph_->import_buffer(backdrops_buffer),
+    };
 
-    // Update the descriptor set.
-    bin_descriptor_set->add_or_update({
-        // Read only.
-        Descriptor::storage(0, allocator->get_buffer(microlines_storage.buffer_id)),
-        // Read only.
-        Descriptor::storage(1,
-
-                            allocator->get_buffer(propagate_metadata_buffer_ids.propagate_metadata)),
-        // Read and write.
-        Descriptor::storage(2, z_buffer),
-        // Write only.
-        Descriptor::storage(3, allocator->get_buffer(fill_vertex_buffer_id)),
-        // Read and write.
-        Descriptor::storage(4, allocator->get_buffer(tiles_d3d11_buffer_id)),
-        // Read and write.
-        Descriptor::storage(5, allocator->get_buffer(propagate_metadata_buffer_ids.backdrops)),
-    });
+    // The graph is submitted before returning, so the pass can refer to locals.
+    prepare_graph_->add_pass("bin segments", reads, writes, [&](const std::shared_ptr<CommandEncoder> &encoder) {
+        // Upload Z buffer data.
+        {
+            // Upload fill indirect draw params to header of the Z-buffer.
+            // This is in the Z-buffer, not its own buffer, to work around the 8 SSBO limitation on
+            // some devices (#373).
+            encoder->write_buffer(z_buffer,
+                                  0,
+                                  FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
+                                  indirect_draw_params);
+        }
+
+        // Update the descriptor set.
+        bin_descriptor_set->add_or_update({
+            // Read only.
+            Descriptor::storage(0, microlines_buffer),
+            // Read only.
+            Descriptor::storage(1, propagate_metadata_buffer),
+            // Read and write.
+            Descriptor::storage(2, z_buffer),
+            // Write only.
+            Descriptor::storage(3, fill_vertex_buffer),
+            // Read and write.
+            Descriptor::storage(4, tiles_d3d11_buffer),
+            // Read and write.
+            Descriptor::storage(5, backdrops_buffer),
+        });
 
-    encoder->begin_compute_pass();
+        begin_gpu_scope(encoder, "bin segments");
 
-    encoder->bind_compute_pipeline(bin_pipeline);
+        encoder->begin_compute_pass();
 
-    encoder->bind_descriptor_set(bin_descriptor_set);
+        encoder->bind_compute_pipeline(bin_pipeline);
 
-    encoder->dispatch((microlines_storage.count + BIN_WORKGROUP_SIZE - 1) / BIN_WORKGROUP_SIZE, 1, 1);
+        encoder->bind_descriptor_set(bin_descriptor_set);
 
-    encoder->end_compute_pass();
+        std::array<int32_t, 4> ubo_data = {(int32_t)microlines_storage.count, (int32_t)allocated_fill_count, 0, 0};
+        encoder->push_constants(6, sizeof(ubo_data), ubo_data.data());
 
-    queue->submit(encoder, fence);
+        encoder->dispatch((microlines_storage.count + BIN_WORKGROUP_SIZE - 1) / BIN_WORKGROUP_SIZE, 1, 1);
+
+        encoder->end_compute_pass();
+
+        end_gpu_scope(encoder);
+    });
+
+    submit_prepare_graph("bin segments", true);
 
     // Read buffer.
     z_buffer->download_via_mapping(FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t), 0, indirect_draw_params);
@@ -846,11 +1312,12 @@ std::shared_ptr<FillBufferInfoD3D11> RendererD3D11::bin_segments(
 
     auto fill_buffer_info = std::make_shared<FillBufferInfoD3D11>();
     fill_buffer_info->fill_vertex_buffer_id = fill_vertex_buffer_id;
+    fill_buffer_info->fill_count = needed_fill_count;
 
     return fill_buffer_info;
 }
 
-PropagateTilesInfoD3D11 RendererD3D11::propagate_tiles(uint32_t column_count,
+PropagateTilesInfoD3D11 RendererD3D11::propagate_tiles(const std::vector<Range> &column_ranges,
                                                        uint64_t tiles_d3d11_buffer_id,
                                                        uint64_t z_buffer_id,
                                                        uint64_t first_tile_map_buffer_id,
@@ -863,93 +1330,130 @@ PropagateTilesInfoD3D11 RendererD3D11::propagate_tiles(uint32_t column_count,
     auto z_buffer = allocator->get_buffer(z_buffer_id);
     auto alpha_tiles_buffer = allocator->get_buffer(alpha_tiles_buffer_id);
 
-    auto encoder = device->create_command_encoder("propagate tiles");
-
     // Upload data to buffers.
     // TODO(pcwalton): Zero out the Z-buffer on GPU?
     auto z_buffer_size = tile_size();
     auto tile_area = z_buffer_size.area();
     auto z_buffer_data = std::vector<int32_t>(tile_area, 0);
 
-    // Fill zeros in the Z buffer. Note the offset for the fill indirect params.
-    encoder->write_buffer(z_buffer,
-                          FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
-                          tile_area * sizeof(int32_t),
-                          z_buffer_data.data());
-
     // TODO(pcwalton): Initialize the first tiles buffer on GPU?
     auto first_tile_map_buffer = allocator->get_buffer(first_tile_map_buffer_id);
     auto first_tile_map = std::vector<FirstTileD3D11>(tile_area, FirstTileD3D11());
-    encoder->write_buffer(first_tile_map_buffer, 0, tile_area * sizeof(FirstTileD3D11), first_tile_map.data());
 
-    // Update uniform buffers.
     auto framebuffer_tile_size0 = framebuffer_tile_size();
-    std::array<int32_t, 4> ubo_data = {(int32_t)framebuffer_tile_size0.x,
-                                       (int32_t)framebuffer_tile_size0.y,
-                                       (int32_t)column_count,
-                                       (int32_t)alpha_tile_count};
-    encoder->write_buffer(allocator->get_buffer(propagate_ub_id), 0, 4 * sizeof(int32_t), ubo_data.data());
 
-    // Update the descriptor set.
-    {
-        propagate_descriptor_set->add_or_update({
-            // Read only.
-            Descriptor::storage(0, propagate_metadata_buffer),
-            // Read only.
-            Descriptor::storage(2, backdrops_buffer),
-            // Read and write.
-            Descriptor::storage(3, tiles_d3d11_buffer),
-            // Read and write.
-            Descriptor::storage(5, z_buffer),
-            // Read and write.
-            Descriptor::storage(6, first_tile_map_buffer),
-            // Write only.
-            Descriptor::storage(7, alpha_tiles_buffer),
-        });
-
-        if (clip_buffer_ids) {
-            auto clip_metadata_buffer = allocator->get_buffer(clip_buffer_ids->metadata);
-            auto clip_tile_buffer = allocator->get_buffer(clip_buffer_ids->tiles);
+    // Alpha tile count of the batch after each level, read from the Z-buffer header.
+    std::vector<uint32_t> level_alpha_tile_counts(column_ranges.size());
 
-            propagate_descriptor_set->add_or_update({
-                // Read only.
-                Descriptor::storage(1, clip_metadata_buffer),
-                // Read and write.
-                Descriptor::storage(4, clip_tile_buffer),
-            });
-        } else { // Placeholders.
-            propagate_descriptor_set->add_or_update({
-                Descriptor::storage(1, propagate_metadata_buffer),
-                Descriptor::storage(4, tiles_d3d11_buffer),
-            });
-        }
+    std::shared_ptr<Buffer> clip_metadata_buffer, clip_tile_buffer;
+    if (clip_buffer_ids) {
+        clip_metadata_buffer = allocator->get_buffer(clip_buffer_ids->metadata);
+        clip_tile_buffer = allocator->get_buffer(clip_buffer_ids->tiles);
     }
 
-    encoder->begin_compute_pass();
-
-    encoder->bind_compute_pipeline(propagate_pipeline);
-
-    encoder->bind_descriptor_set(propagate_descriptor_set);
-
-    encoder->dispatch((column_count + PROPAGATE_WORKGROUP_SIZE - 1) / PROPAGATE_WORKGROUP_SIZE, 1, 1);
-
-    encoder->end_compute_pass();
+    std::vector<RenderGraphResource> reads = {
+        prepare_graph_->import_buffer(propagate_metadata_buffer),
+        prepare_graph_->import_buffer(backdrops_buffer),
+        prepare_graph_->import_buffer(tiles_d3d11_buffer),
+        prepare_graph_->import_buffer(z_buffer),
+        prepare_graph_->import_buffer(first_tile_map_buffer),
+    };
+    std::vector<RenderGraphResource> writes = {
+        prepare_graph_->import_buffer(tiles_d3d11_buffer),
+        prepare_graph_->import_buffer(z_buffer),
+        prepare_graph_->import_buffer(first_tile_map_buffer),
+        prepare_graph_->import_buffer(alpha_tiles_buffer),
+    };
+    if (clip_buffer_ids) {
+        reads.push_back(prepare_graph_->import_buffer(clip_metadata_buffer));
+        reads.push_back(prepare_graph_->import_buffer(clip_tile_buffer));
+        writes.push_back(prepare_graph_->import_buffer(clip_tile_buffer));
+    }
 
-    uint32_t fill_indirect_draw_params[FILL_INDIRECT_DRAW_PARAMS_SIZE];
+    // The graph is submitted before returning, so the pass can refer to locals.
+    prepare_graph_->add_pass("propagate tiles", reads, writes, [&](const std::shared_ptr<CommandEncoder> &encoder) {
+        // Fill zeros in the Z buffer. Note the offset for the fill indirect params.
+        encoder->write_buffer(z_buffer,
+                              FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t),
+                              tile_area * sizeof(int32_t),
+                              z_buffer_data.data());
+
+        encoder->write_buffer(first_tile_map_buffer, 0, tile_area * sizeof(FirstTileD3D11), first_tile_map.data());
+
+        begin_gpu_scope(encoder, "propagate tiles");
+
+        // A level reads the propagated tiles of its subclips, so levels are dispatched in order.
+        // They all go into the same submission, as the alpha tile counter in the Z-buffer header
+        // keeps counting across levels.
+        for (size_t level = 0; level < column_ranges.size(); level++) {
+            auto &column_range = column_ranges[level];
+            auto column_count = column_range.length();
+
+            // Each level propagates its own range of backdrops, so it has its own descriptor set.
+            auto propagate_descriptor_set = device->get_or_create_descriptor_set(
+                propagate_descriptor_set_layout_,
+                {
+                    // Read only.
+                    Descriptor::storage(0, propagate_metadata_buffer),
+                    // Read only. The propagate metadata buffer is a placeholder if there are no clips.
+                    Descriptor::storage(1, clip_buffer_ids ? clip_metadata_buffer : propagate_metadata_buffer),
+                    // Read only.
+                    Descriptor::storage(2,
+                                        backdrops_buffer,
+                                        column_range.start * sizeof(BackdropInfoD3D11),
+                                        column_count * sizeof(BackdropInfoD3D11)),
+                    // Read and write.
+                    Descriptor::storage(3, tiles_d3d11_buffer),
+                    // Read and write. The tiles buffer is a placeholder if there are no clips.
+                    Descriptor::storage(4, clip_buffer_ids ? clip_tile_buffer : tiles_d3d11_buffer),
+                    // Read and write.
+                    Descriptor::storage(5, z_buffer),
+                    // Read and write.
+                    Descriptor::storage(6, first_tile_map_buffer),
+                    // Write only.
+                    Descriptor::storage(7, alpha_tiles_buffer),
+                });
+
+            encoder->begin_compute_pass();
+
+            encoder->bind_compute_pipeline(propagate_pipeline);
+
+            encoder->bind_descriptor_set(propagate_descriptor_set);
+
+            std::array<int32_t, 4> ubo_data = {(int32_t)framebuffer_tile_size0.x,
+                                               (int32_t)framebuffer_tile_size0.y,
+                                               (int32_t)column_count,
+                                               (int32_t)alpha_tile_count};
+            encoder->push_constants(8, sizeof(ubo_data), ubo_data.data());
+
+            encoder->dispatch((column_count + PROPAGATE_WORKGROUP_SIZE - 1) / PROPAGATE_WORKGROUP_SIZE, 1, 1);
+
+            encoder->end_compute_pass();
+
+            encoder->read_buffer(z_buffer,
+                                 FILL_INDIRECT_DRAW_PARAMS_ALPHA_TILE_COUNT_INDEX * sizeof(uint32_t),
+                                 sizeof(uint32_t),
+                                 &level_alpha_tile_counts[level]);
+        }
 
-    queue->submit(encoder, fence);
+        end_gpu_scope(encoder);
+    });
 
-    // Read buffer.
-    z_buffer->download_via_mapping(FILL_INDIRECT_DRAW_PARAMS_SIZE * sizeof(uint32_t), 0, fill_indirect_draw_params);
+    submit_prepare_graph("propagate tiles", true);
 
     // Do this after the command buffer is submitted.
-    auto batch_alpha_tile_count = fill_indirect_draw_params[FILL_INDIRECT_DRAW_PARAMS_ALPHA_TILE_COUNT_INDEX];
+    PropagateTilesInfoD3D11 propagate_tiles_info;
 
     auto alpha_tile_start = alpha_tile_count;
-    alpha_tile_count += batch_alpha_tile_count;
+    for (auto level_alpha_tile_count : level_alpha_tile_counts) {
+        propagate_tiles_info.level_alpha_tile_ends.push_back(alpha_tile_start + level_alpha_tile_count);
+    }
+    alpha_tile_count += level_alpha_tile_counts.back();
     auto alpha_tile_end = alpha_tile_count;
 
-    return {Range(alpha_tile_start, alpha_tile_end)};
+    propagate_tiles_info.alpha_tile_range = Range(alpha_tile_start, alpha_tile_end);
+
+    return propagate_tiles_info;
 }
 
 Vec2I RendererD3D11::framebuffer_tile_size() {
@@ -961,44 +1465,143 @@ void RendererD3D11::draw_fills(FillBufferInfoD3D11 &fill_storage_info,
                                uint64_t alpha_tiles_buffer_id,
                                PropagateTilesInfoD3D11 &propagate_tiles_info) {
     auto alpha_tile_range = propagate_tiles_info.alpha_tile_range;
-
-    // This setup is a workaround for the annoying 64K limit of compute invocation in OpenGL.
-    uint32_t _alpha_tile_count = alpha_tile_range.end - alpha_tile_range.start;
-
-    auto encoder = device->create_command_encoder("draw fills");
-
-    // Update uniform buffer.
-    auto framebuffer_tile_size0 = framebuffer_tile_size();
-    std::array<int32_t, 2> ubo_data = {static_cast<int32_t>(alpha_tile_range.start),
-                                       static_cast<int32_t>(alpha_tile_range.end)};
-    encoder->write_buffer(allocator->get_buffer(fill_ub_id), 0, 2 * sizeof(int32_t), ubo_data.data());
+    auto level_alpha_tile_ends = propagate_tiles_info.level_alpha_tile_ends;
 
     auto fill_vertex_buffer = allocator->get_buffer(fill_storage_info.fill_vertex_buffer_id);
     auto tiles_d3d11_buffer = allocator->get_buffer(tiles_d3d11_buffer_id);
     auto alpha_tiles_buffer = allocator->get_buffer(alpha_tiles_buffer_id);
+    auto mask_texture = allocator->get_texture(*mask_storage.texture_id);
+    auto area_lut_texture = allocator->get_texture(area_lut_texture_id);
+    auto default_sampler = get_default_sampler();
 
-    // Update descriptor set.
-    fill_descriptor_set->add_or_update({
-        // Read only.
-        Descriptor::storage(0, fill_vertex_buffer),
-        // Read only.
-        Descriptor::storage(1, tiles_d3d11_buffer),
-        // Read only.
-        Descriptor::storage(2, alpha_tiles_buffer),
-        Descriptor::image(3, allocator->get_texture(*mask_storage.texture_id)),
-    });
+    bool grouped = fill_variant_ == FillVariantD3D11::Grouped && set_up_grouped_fill_pipelines();
+
+    auto batch_alpha_tile_count = uint32_t(alpha_tile_range.end - alpha_tile_range.start);
+
+    std::vector<RenderGraphResource> reads = {
+        render_graph->import_buffer(fill_vertex_buffer),
+        render_graph->import_buffer(tiles_d3d11_buffer),
+        render_graph->import_buffer(alpha_tiles_buffer),
+    };
+    std::vector<RenderGraphResource> writes = {render_graph->import_texture(mask_texture)};
+
+    // Grouped fills only live until the fills are drawn.
+    RenderGraphResource grouped_fills = 0, fill_ranges = 0;
+
+    if (grouped) {
+        grouped_fills = render_graph->create_buffer(std::max(fill_storage_info.fill_count, 1u) * 2 * sizeof(uint32_t),
+                                                    BufferType::Storage,
+                                                    "grouped fills buffer");
+        fill_ranges =
+            render_graph->create_buffer((FILL_RANGES_HEADER_SIZE + batch_alpha_tile_count * 2) * sizeof(uint32_t),
+                                        BufferType::Storage,
+                                        "fill ranges buffer");
+
+        writes.push_back(grouped_fills);
+        writes.push_back(fill_ranges);
+    }
+
+    auto callback = [=](const std::shared_ptr<CommandEncoder> &encoder) {
+        // Fills are read from the fill buffer directly, or from their grouped copies.
+        // The fill ranges binding is unused by the linked list variant, so the alpha tiles buffer is a placeholder.
+        auto fills_buffer = fill_vertex_buffer;
+        auto fill_ranges_buffer = alpha_tiles_buffer;
+
+        begin_gpu_scope(encoder, "draw fills");
+
+        if (grouped) {
+            fills_buffer = render_graph->get_buffer(grouped_fills);
+            fill_ranges_buffer = render_graph->get_buffer(fill_ranges);
+
+            // Reset the grouped fill count.
+            uint32_t grouped_fill_count = 0;
+            encoder->write_buffer(fill_ranges_buffer, 0, sizeof(uint32_t), &grouped_fill_count);
+
+            // Group the fills of all levels at once, as binning is done for the whole batch.
+            if (batch_alpha_tile_count > 0) {
+                auto fill_group_descriptor_set = device->get_or_create_descriptor_set(
+                    fill_group_descriptor_set_layout_,
+                    {
+                        // Read only.
+                        Descriptor::storage(0, fill_vertex_buffer),
+                        // Read only.
+                        Descriptor::storage(1, tiles_d3d11_buffer),
+                        // Read only.
+                        Descriptor::storage(2, alpha_tiles_buffer),
+                        // Write only.
+                        Descriptor::storage(3, fills_buffer),
+                        // Read and write.
+                        Descriptor::storage(4, fill_ranges_buffer),
+                    });
+
+                encoder->begin_compute_pass();
+
+                encoder->bind_compute_pipeline(fill_group_pipeline);
+
+                encoder->bind_descriptor_set(fill_group_descriptor_set);
+
+                std::array<int32_t, 4> ubo_data = {static_cast<int32_t>(alpha_tile_range.start),
+                                                   static_cast<int32_t>(alpha_tile_range.end),
+                                                   0,
+                                                   0};
+                encoder->push_constants(5, sizeof(ubo_data), ubo_data.data());
+
+                encoder->dispatch((batch_alpha_tile_count + FILL_GROUP_WORKGROUP_SIZE - 1) /
+                                      FILL_GROUP_WORKGROUP_SIZE,
+                                  1,
+                                  1);
+
+                encoder->end_compute_pass();
+            }
+        }
+
+        // A level's masks are clipped by the masks of its subclips, so levels are filled in order.
+        // Fill reads alpha tiles from the start of the bound buffer, so each dispatch covers the batch's alpha tiles
+        // up to the end of its level. Filling a tile again writes the same mask, so lower levels stay valid.
+        // Only the uniforms differ between levels, so they share the descriptor set.
+        // The set comes from the device cache, as the fills of the previous batch may still be in flight.
+        auto fill_descriptor_set = device->get_or_create_descriptor_set(
+            fill_descriptor_set_layout_,
+            {
+                // Read only.
+                Descriptor::storage(0, fills_buffer),
+                // Read only.
+                Descriptor::storage(1, tiles_d3d11_buffer),
+                // Read only.
+                Descriptor::storage(2, alpha_tiles_buffer),
+                Descriptor::image(3, mask_texture),
+                Descriptor::sampled(4, area_lut_texture, default_sampler),
+                // Read only.
+                Descriptor::storage(6, fill_ranges_buffer),
+            });
+
+        for (size_t level = 0; level < level_alpha_tile_ends.size(); level++) {
+            auto level_alpha_tile_end = level_alpha_tile_ends[level];
+
+            // This setup is a workaround for the annoying 64K limit of compute invocation in OpenGL.
+            uint32_t _alpha_tile_count = level_alpha_tile_end - alpha_tile_range.start;
+
+            encoder->begin_compute_pass();
+
+            encoder->bind_compute_pipeline(grouped ? fill_grouped_pipeline : fill_pipeline);
 
-    encoder->begin_compute_pass();
+            encoder->bind_descriptor_set(fill_descriptor_set);
 
-    encoder->bind_compute_pipeline(fill_pipeline);
+            std::array<int32_t, 4> ubo_data = {static_cast<int32_t>(alpha_tile_range.start),
+                                               static_cast<int32_t>(level_alpha_tile_end),
+                                               0,
+                                               0};
+            encoder->push_constants(5, sizeof(ubo_data), ubo_data.data());
 
-    encoder->bind_descriptor_set(fill_descriptor_set);
+            encoder->dispatch(std::min(_alpha_tile_count, 1u << 15u), (_alpha_tile_count + (1 << 15) - 1) >> 15, 1);
 
-    encoder->dispatch(std::min(_alpha_tile_count, 1u << 15u), (_alpha_tile_count + (1 << 15) - 1) >> 15, 1);
+            encoder->end_compute_pass();
+        }
 
-    encoder->end_compute_pass();
+        end_gpu_scope(encoder);
+    };
 
-    queue->submit(encoder, fence);
+    render_graph->add_pass("draw fills", reads, writes, callback);
 }
 
 void RendererD3D11::sort_tiles(uint64_t tiles_d3d11_buffer_id,
@@ -1010,32 +1613,189 @@ void RendererD3D11::sort_tiles(uint64_t tiles_d3d11_buffer_id,
 
     auto tile_count = framebuffer_tile_size().area();
 
-    auto encoder = device->create_command_encoder("sort tiles");
+    auto tiles = prepare_graph_->import_buffer(tiles_d3d11_buffer);
+    auto first_tile_map = prepare_graph_->import_buffer(first_tile_map_buffer);
 
-    // Update uniform buffer.
-    encoder->write_buffer(allocator->get_buffer(sort_ub_id), 0, sizeof(int32_t), &tile_count);
+    auto callback = [=](const std::shared_ptr<CommandEncoder> &encoder) {
+        // Update the descriptor set.
+        sort_descriptor_set->add_or_update({
+            // Read and write.
+            Descriptor::storage(0, tiles_d3d11_buffer),
+            // Read and write.
+            Descriptor::storage(1, first_tile_map_buffer),
+            // Read only.
+            Descriptor::storage(2, z_buffer),
+        });
 
-    // Update the descriptor set.
-    sort_descriptor_set->add_or_update({
-        // Read and write.
-        Descriptor::storage(0, tiles_d3d11_buffer),
-        // Read and write.
-        Descriptor::storage(1, first_tile_map_buffer),
-        // Read only.
-        Descriptor::storage(2, z_buffer),
-    });
+        begin_gpu_scope(encoder, "sort tiles");
+
+        encoder->begin_compute_pass();
+
+        encoder->bind_compute_pipeline(sort_pipeline);
+
+        encoder->bind_descriptor_set(sort_descriptor_set);
+
+        std::array<int32_t, 4> ubo_data = {(int32_t)tile_count, 0, 0, 0};
+        encoder->push_constants(3, sizeof(ubo_data), ubo_data.data());
+
+        encoder->dispatch((tile_count + SORT_WORKGROUP_SIZE - 1) / SORT_WORKGROUP_SIZE, 1, 1);
+
+        encoder->end_compute_pass();
+
+        end_gpu_scope(encoder);
+    };
+
+    prepare_graph_->add_pass("sort tiles",
+                             {tiles, first_tile_map, prepare_graph_->import_buffer(z_buffer)},
+                             {tiles, first_tile_map},
+                             callback);
+}
+
+void RendererD3D11::sort_tiles_by_keys(uint64_t tiles_d3d11_buffer_id,
+                                       uint64_t first_tile_map_buffer_id,
+                                       uint64_t z_buffer_id,
+                                       uint32_t batch_tile_count) {
+    auto tiles_d3d11_buffer = allocator->get_buffer(tiles_d3d11_buffer_id);
+    auto first_tile_map_buffer = allocator->get_buffer(first_tile_map_buffer_id);
+    auto z_buffer = allocator->get_buffer(z_buffer_id);
+
+    auto tile_count = framebuffer_tile_size().area();
+
+    // A tile is in one tile list at most, so the batch tile count bounds the key count.
+    // The actual key count is only known on GPU, so dispatches cover the bound and skip the rest.
+    uint32_t key_capacity = std::max(batch_tile_count, 1u);
+    uint32_t group_count = (key_capacity + RADIX_SORT_WORKGROUP_SIZE - 1) / RADIX_SORT_WORKGROUP_SIZE;
+
+    // Sort by tile index first, so that the passes over framebuffer tiles keep tiles in draw order.
+    uint32_t tile_index_pass_count = radix_sort_pass_count(batch_tile_count);
+    uint32_t pass_count = tile_index_pass_count + radix_sort_pass_count(tile_count);
+
+    // Keys are sorted back and forth between two buffers.
+    std::array<RenderGraphResource, 2> keys = {
+        prepare_graph_->create_buffer(key_capacity * sizeof(TileSortKeyD3D11),
+                                      BufferType::Storage,
+                                      "sort keys buffer 0"),
+        prepare_graph_->create_buffer(key_capacity * sizeof(TileSortKeyD3D11),
+                                      BufferType::Storage,
+                                      "sort keys buffer 1"),
+    };
+    auto sort_info =
+        prepare_graph_->create_buffer((SORT_INFO_HISTOGRAMS + RADIX_SORT_DIGIT_COUNT * group_count) * sizeof(uint32_t),
+                                      BufferType::Storage,
+                                      "sort info buffer");
 
-    encoder->begin_compute_pass();
+    auto tiles = prepare_graph_->import_buffer(tiles_d3d11_buffer);
+    auto first_tile_map = prepare_graph_->import_buffer(first_tile_map_buffer);
 
-    encoder->bind_compute_pipeline(sort_pipeline);
+    auto callback = [=](const std::shared_ptr<CommandEncoder> &encoder) {
+        auto sort_info_buffer = prepare_graph_->get_buffer(sort_info);
 
-    encoder->bind_descriptor_set(sort_descriptor_set);
+        // Reset the key count.
+        uint32_t key_count = 0;
+        encoder->write_buffer(sort_info_buffer, 0, sizeof(uint32_t), &key_count);
+
+        auto dispatch = [&](const std::shared_ptr<ComputePipeline> &pipeline,
+                            const std::shared_ptr<DescriptorSet> &descriptor_set,
+                            uint32_t uniform_binding,
+                            const std::array<int32_t, 4> &ubo_data,
+                            uint32_t dispatch_group_count) {
+            encoder->begin_compute_pass();
+
+            encoder->bind_compute_pipeline(pipeline);
+
+            encoder->bind_descriptor_set(descriptor_set);
+
+            encoder->push_constants(uniform_binding, sizeof(ubo_data), ubo_data.data());
+
+            encoder->dispatch(dispatch_group_count, 1, 1);
+
+            encoder->end_compute_pass();
+        };
+
+        begin_gpu_scope(encoder, "sort tiles");
+
+        // Generate keys, one invocation per framebuffer tile.
+        {
+            auto &descriptor_set = sort_keys_descriptor_sets[0];
+            descriptor_set->add_or_update({
+                // Read only.
+                Descriptor::storage(0, tiles_d3d11_buffer),
+                // Read and write.
+                Descriptor::storage(1, first_tile_map_buffer),
+                // Read only.
+                Descriptor::storage(2, z_buffer),
+                // Write only.
+                Descriptor::storage(3, prepare_graph_->get_buffer(keys[0])),
+                // Read and write.
+                Descriptor::storage(4, sort_info_buffer),
+            });
+
+            dispatch(sort_keys_pipeline,
+                     descriptor_set,
+                     5,
+                     {(int32_t)tile_count, SORT_KEYS_MODE_GENERATE, 0, 0},
+                     (tile_count + SORT_KEYS_WORKGROUP_SIZE - 1) / SORT_KEYS_WORKGROUP_SIZE);
+        }
+
+        // Passes sort back and forth, so there's a descriptor set per direction.
+        std::array<std::shared_ptr<DescriptorSet>, 2> radix_sort_descriptor_sets;
+        for (uint32_t i = 0; i < radix_sort_descriptor_sets.size(); i++) {
+            radix_sort_descriptor_sets[i] = device->get_or_create_descriptor_set(
+                radix_sort_descriptor_set_layout_,
+                {
+                    // Read only.
+                    Descriptor::storage(0, prepare_graph_->get_buffer(keys[i])),
+                    // Write only.
+                    Descriptor::storage(1, prepare_graph_->get_buffer(keys[(i + 1) % 2])),
+                    // Read and write.
+                    Descriptor::storage(2, sort_info_buffer),
+                });
+        }
+
+        for (uint32_t pass = 0; pass < pass_count; pass++) {
+            bool by_tile_index = pass < tile_index_pass_count;
+            auto digit_shift = (by_tile_index ? pass : pass - tile_index_pass_count) * RADIX_SORT_DIGIT_BITS;
+
+            for (int32_t mode : {RADIX_SORT_MODE_COUNT, RADIX_SORT_MODE_SCAN, RADIX_SORT_MODE_SCATTER}) {
+                // Histograms are scanned by a single workgroup.
+                dispatch(radix_sort_pipeline,
+                         radix_sort_descriptor_sets[pass % 2],
+                         3,
+                         {mode, by_tile_index ? 1 : 0, (int32_t)digit_shift, (int32_t)group_count},
+                         mode == RADIX_SORT_MODE_SCAN ? 1 : group_count);
+            }
+        }
+
+        // Rebuild the tile lists, one invocation per key.
+        {
+            auto &descriptor_set = sort_keys_descriptor_sets[1];
+            descriptor_set->add_or_update({
+                // Read and write.
+                Descriptor::storage(0, tiles_d3d11_buffer),
+                // Write only.
+                Descriptor::storage(1, first_tile_map_buffer),
+                // Unused.
+                Descriptor::storage(2, z_buffer),
+                // Read only.
+                Descriptor::storage(3, prepare_graph_->get_buffer(keys[pass_count % 2])),
+                // Read only.
+                Descriptor::storage(4, sort_info_buffer),
+            });
 
-    encoder->dispatch((tile_count + SORT_WORKGROUP_SIZE - 1) / SORT_WORKGROUP_SIZE, 1, 1);
+            dispatch(sort_keys_pipeline,
+                     descriptor_set,
+                     5,
+                     {(int32_t)tile_count, SORT_KEYS_MODE_LINK, 0, 0},
+                     (key_capacity + SORT_KEYS_WORKGROUP_SIZE - 1) / SORT_KEYS_WORKGROUP_SIZE);
+        }
 
-    encoder->end_compute_pass();
+        end_gpu_scope(encoder);
+    };
 
-    queue->submit(encoder, fence);
+    prepare_graph_->add_pass("sort tiles by keys",
+                             {tiles, first_tile_map, prepare_graph_->import_buffer(z_buffer)},
+                             {tiles, first_tile_map, keys[0], keys[1], sort_info},
+                             callback);
 }
 
 void RendererD3D11::free_tile_batch_buffers() {
@@ -1050,6 +1810,99 @@ void RendererD3D11::free_tile_batch_buffers() {
     tile_batch_info.clear();
 }
 
+bool RendererD3D11::set_up_radix_sort_pipelines() {
+    if (radix_sort_pipeline) {
+        return true;
+    }
+
+    {
+        std::vector<DescriptorLayout> layouts = {
+            DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{1, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{2, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{3, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{4, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout::push_constant(5, ShaderStage::Compute, 4 * sizeof(int32_t)),
+        };
+
+        sort_keys_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
+    }
+
+    {
+        std::vector<DescriptorLayout> layouts = {
+            DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{1, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{2, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout::push_constant(3, ShaderStage::Compute, 4 * sizeof(int32_t)),
+        };
+
+        radix_sort_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
+    }
+
+    sort_keys_pipeline = get_or_create_compute_pipeline(sort_keys_comp_shdbin,
+                                                        sizeof(sort_keys_comp_shdbin),
+                                                        "sort keys comp",
+                                                        sort_keys_descriptor_set_layout_,
+                                                        "sort keys pipeline");
+    radix_sort_pipeline = get_or_create_compute_pipeline(radix_sort_comp_shdbin,
+                                                         sizeof(radix_sort_comp_shdbin),
+                                                         "radix sort comp",
+                                                         radix_sort_descriptor_set_layout_,
+                                                         "radix sort pipeline");
+
+    if (!sort_keys_pipeline || !radix_sort_pipeline) {
+        Logger::error("Radix sort shaders are unavailable, falling back to linked list sorting!", "RendererD3D11");
+        radix_sort_pipeline = nullptr;
+        tile_sort_ = TileSortD3D11::LinkedList;
+        return false;
+    }
+
+    for (auto &descriptor_set : sort_keys_descriptor_sets) {
+        descriptor_set = device->create_descriptor_set(sort_keys_descriptor_set_layout_);
+    }
+
+    return true;
+}
+
+bool RendererD3D11::set_up_grouped_fill_pipelines() {
+    if (fill_grouped_pipeline) {
+        return true;
+    }
+
+    {
+        std::vector<DescriptorLayout> layouts = {
+            DescriptorLayout{0, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{1, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{2, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{3, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout{4, ShaderStage::Compute, DescriptorType::StorageBuffer},
+            DescriptorLayout::push_constant(5, ShaderStage::Compute, 4 * sizeof(int32_t)),
+        };
+
+        fill_group_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
+    }
+
+    fill_group_pipeline = get_or_create_compute_pipeline(fill_group_comp_shdbin,
+                                                         sizeof(fill_group_comp_shdbin),
+                                                         "fill group comp",
+                                                         fill_group_descriptor_set_layout_,
+                                                         "fill group pipeline");
+    fill_grouped_pipeline = get_or_create_compute_pipeline(fill_grouped_comp_shdbin,
+                                                           sizeof(fill_grouped_comp_shdbin),
+                                                           "fill grouped comp",
+                                                           fill_descriptor_set_layout_,
+                                                           "fill grouped pipeline");
+
+    if (!fill_group_pipeline || !fill_grouped_pipeline) {
+        Logger::error("Grouped fill shaders are unavailable, falling back to fill lists!", "RendererD3D11");
+        fill_grouped_pipeline = nullptr;
+        fill_variant_ = FillVariantD3D11::LinkedList;
+        return false;
+    }
+
+    return true;
+}
+
 TextureFormat RendererD3D11::mask_texture_format() const {
     // Unlike D3D9, we use RGBA8 instead of RGBA16F for the mask texture.
     return TextureFormat::Rgba8Unorm;
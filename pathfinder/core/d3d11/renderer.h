@@ -1,11 +1,13 @@
 #pragma once
 
+#include <array>
 #include <map>
 
 #include "../../gpu/compute_pipeline.h"
 #include "../../gpu/descriptor_set.h"
 #include "../renderer.h"
 #include "../scene.h"
+#include "cpu_stages.h"
 #include "gpu_data.h"
 
 #ifdef PATHFINDER_ENABLE_COMPUTE
@@ -23,6 +25,9 @@ struct TileBatchInfoD3D11 {
 
 struct FillBufferInfoD3D11 {
     uint64_t fill_vertex_buffer_id;
+
+    /// Fills written by binning.
+    uint32_t fill_count;
 };
 
 struct PropagateMetadataBufferIDsD3D11 {
@@ -43,7 +48,12 @@ struct SceneSourceBuffers {
     uint32_t point_indices_count = 0;
     uint32_t point_indices_capacity = 0;
 
-    /// Upload segments to buffers.
+    /// Make sure the buffers can hold the segments.
+    void reserve(const SegmentsD3D11 &segments, const std::shared_ptr<GpuMemoryAllocator> &allocator);
+
+    void release(const std::shared_ptr<GpuMemoryAllocator> &allocator);
+
+    /// Upload segments to buffers. Call reserve() first.
     void upload(SegmentsD3D11 &segments,
                 const std::shared_ptr<GpuMemoryAllocator> &allocator,
                 const std::shared_ptr<Device> &device,
@@ -54,6 +64,12 @@ struct SceneBuffers {
     SceneSourceBuffers draw;
     SceneSourceBuffers clip;
 
+    void reserve(const SegmentsD3D11 &draw_segments,
+                 const SegmentsD3D11 &clip_segments,
+                 const std::shared_ptr<GpuMemoryAllocator> &allocator);
+
+    void release(const std::shared_ptr<GpuMemoryAllocator> &allocator);
+
     /// Upload draw and clip segments to buffers.
     void upload(SegmentsD3D11 &draw_segments,
                 SegmentsD3D11 &clip_segments,
@@ -64,6 +80,9 @@ struct SceneBuffers {
 
 struct PropagateTilesInfoD3D11 {
     Range alpha_tile_range;
+
+    /// End of the alpha tiles allocated up to each clip level, in propagation order.
+    std::vector<uint64_t> level_alpha_tile_ends;
 };
 
 struct ClipBufferIDs {
@@ -84,9 +103,36 @@ struct TileUniformD3d11 {
     Vec2F color_texture_size;
 };
 
+/// Where the tile preparation stages (dice, bound, bin, propagate, fill, sort) are executed.
+/// The tile stage always runs on GPU.
+enum class ComputeBackendD3D11 {
+    Gpu,
+    /// Reference implementation on CPU. Mainly for profiling and validating the compute shaders.
+    Cpu,
+};
+
+/// How the sort stage orders the tiles of each framebuffer tile.
+enum class TileSortD3D11 {
+    /// Insertion sort of each tile list. Slows down when many paths overlap one tile.
+    LinkedList,
+    /// Parallel radix sort on (framebuffer tile, tile index) keys, then the tile lists are rebuilt.
+    Radix,
+};
+
+/// How the fill stage reads the fills of each alpha tile.
+enum class FillVariantD3D11 {
+    /// Each invocation walks the alpha tile's fill list.
+    LinkedList,
+    /// Fills are first grouped into a contiguous range per alpha tile.
+    /// The fill workgroup then loads them into shared memory together, instead of each invocation chasing the list.
+    Grouped,
+};
+
 class RendererD3D11 : public Renderer {
 public:
-    explicit RendererD3D11(const std::shared_ptr<Device> &device, const std::shared_ptr<Queue> &queue);
+    explicit RendererD3D11(const std::shared_ptr<RendererContext> &_context);
+
+    ~RendererD3D11() override;
 
     void set_up_pipelines() override;
 
@@ -96,15 +142,34 @@ public:
 
     void set_dest_texture(const std::shared_ptr<Texture> &new_texture) override;
 
+    void set_compute_backend(ComputeBackendD3D11 backend);
+
+    ComputeBackendD3D11 get_compute_backend() const;
+
+    void set_tile_sort(TileSortD3D11 tile_sort);
+
+    TileSortD3D11 get_tile_sort() const;
+
+    void set_fill_variant(FillVariantD3D11 fill_variant);
+
+    FillVariantD3D11 get_fill_variant() const;
+
+    /// Work counts of the last frame. Only collected by the CPU backend.
+    CpuStageStatsD3D11 get_cpu_stage_stats() const;
+
 private:
     /// RenderCommand::DrawTilesD3D11(draw_tile_batch)
-    void prepare_and_draw_tiles(DrawTileBatchD3D11 &batch);
+    void prepare_and_draw_tiles(DrawTileBatchD3D11 &batch, const SegmentsD3D11 &draw_segments);
 
     /**
      * Computes backdrops, performs clipping, and populates Z buffers on GPU.
      */
     void prepare_tiles(TileBatchDataD3D11 &batch);
 
+    /// Same as prepare_tiles(), but runs the stages on CPU.
+    /// The resulting mask is uploaded to the mask texture.
+    void prepare_tiles_on_cpu(TileBatchDataD3D11 &batch, const SegmentsD3D11 &segments);
+
     /**
      * Dice (flatten) segments into microlines. We might have to do this twice if our
      * first attempt runs out of space in the storage buffer.
@@ -140,7 +205,11 @@ private:
                                                       uint64_t tiles_d3d11_buffer_id,
                                                       uint64_t z_buffer_id);
 
-    PropagateTilesInfoD3D11 propagate_tiles(uint32_t column_count,
+    /**
+     * Propagates backdrops and allocates alpha tiles, one dispatch per clip level.
+     * @param column_ranges Backdrop columns of each level, in propagation order.
+     */
+    PropagateTilesInfoD3D11 propagate_tiles(const std::vector<Range> &column_ranges,
                                             uint64_t tiles_d3d11_buffer_id,
                                             uint64_t z_buffer_id,
                                             uint64_t first_tile_map_buffer_id,
@@ -158,6 +227,15 @@ private:
      */
     void sort_tiles(uint64_t tiles_d3d11_buffer_id, uint64_t first_tile_map_buffer_id, uint64_t z_buffer_id);
 
+    /**
+     * Same as sort_tiles(), but with a radix sort. Called by prepare_tiles().
+     * @param batch_tile_count Bounds the number of tiles in the tile lists.
+     */
+    void sort_tiles_by_keys(uint64_t tiles_d3d11_buffer_id,
+                            uint64_t first_tile_map_buffer_id,
+                            uint64_t z_buffer_id,
+                            uint32_t batch_tile_count);
+
     void draw_tiles(uint64_t tiles_d3d11_buffer_id,
                     uint64_t first_tile_map_buffer_id,
                     const std::shared_ptr<const RenderTargetId> &render_target_id,
@@ -188,6 +266,37 @@ private:
 
     void reallocate_alpha_tile_pages_if_necessary();
 
+    /// Execute the render graph and submit it.
+    /// Only needed before reading results back, as stages just add their passes to the graph.
+    /// If `wait` is false, the GPU keeps working on the commands while the CPU moves on.
+    void submit_render_graph(const std::string &label, bool wait);
+
+    /// Same as submit_render_graph(), but for the graph of the stages preparing tiles on GPU.
+    /// With a compute queue, the graph is submitted to it, and the next render graph submission waits for it.
+    void submit_prepare_graph(const std::string &label, bool wait);
+
+    /// With a compute queue, submit the batch prepared last and the passes drawing it, so that the graphics queue
+    /// draws it while the next batch is prepared. Nothing makes the graphics queue wait between batches, so the fill
+    /// and tile descriptor sets come from the device cache, which never rewrites a set. The sets of the prepare stages
+    /// are only rewritten after a later compute queue submission has been waited for.
+    void submit_prepared_batch();
+
+    /// Get a pipeline from the context, which compiles it if no other renderer of the context has.
+    /// @return Null if the shader is not available.
+    std::shared_ptr<ComputePipeline> get_or_create_compute_pipeline(const uint8_t *shdbin,
+                                                                     size_t shdbin_size,
+                                                                     const std::string &shader_label,
+                                                                     const std::shared_ptr<DescriptorSetLayout> &layout,
+                                                                     const std::string &label);
+
+    /// Create the radix sort pipelines on first use.
+    /// @return False if the shaders are not available, in which case tile sorting falls back to linked lists.
+    bool set_up_radix_sort_pipelines();
+
+    /// Create the grouped fill pipelines on first use.
+    /// @return False if the shaders are not available, in which case fills are read from linked lists.
+    bool set_up_grouped_fill_pipelines();
+
 private:
     // Unlike D3D9, we only need mask/dest textures instead of mask/dest framebuffers.
     std::shared_ptr<Texture> dest_texture;
@@ -195,15 +304,28 @@ private:
     std::shared_ptr<ComputePipeline> bound_pipeline, dice_pipeline, bin_pipeline, propagate_pipeline, sort_pipeline,
         fill_pipeline, tile_pipeline;
 
-    /// Uniform buffers.
-    uint64_t bin_ub_id, bound_ub_id, dice_ub0_id, dice_ub1_id, fill_ub_id, propagate_ub_id, sort_ub_id, tile_ub_id;
-
     std::shared_ptr<DescriptorSetLayout> bound_descriptor_set_layout_, dice_descriptor_set_layout_,
         bin_descriptor_set_layout_, propagate_descriptor_set_layout_, sort_descriptor_set_layout_,
         fill_descriptor_set_layout_, tile_descriptor_set_layout_;
 
-    std::shared_ptr<DescriptorSet> bound_descriptor_set, dice_descriptor_set, bin_descriptor_set,
-        propagate_descriptor_set, sort_descriptor_set, fill_descriptor_set, tile_descriptor_set;
+    /// Propagate, fill and tile descriptor sets are taken from the device cache instead, as a submission may use
+    /// several of them and the previous submission may still be in flight.
+    std::shared_ptr<DescriptorSet> bound_descriptor_set, dice_descriptor_set, bin_descriptor_set, sort_descriptor_set;
+
+    /// Created on first use, see set_up_radix_sort_pipelines().
+    std::shared_ptr<ComputePipeline> sort_keys_pipeline, radix_sort_pipeline;
+
+    std::shared_ptr<DescriptorSetLayout> sort_keys_descriptor_set_layout_, radix_sort_descriptor_set_layout_;
+
+    /// Key generation and linking. Radix sort descriptor sets are taken from the device cache.
+    std::array<std::shared_ptr<DescriptorSet>, 2> sort_keys_descriptor_sets;
+
+    /// Created on first use, see set_up_grouped_fill_pipelines().
+    /// The grouped fill pipeline shares the fill descriptor set layout.
+    std::shared_ptr<ComputePipeline> fill_group_pipeline, fill_grouped_pipeline;
+
+    /// Fill group descriptor sets are taken from the device cache, like the fill ones.
+    std::shared_ptr<DescriptorSetLayout> fill_group_descriptor_set_layout_;
 
     uint32_t allocated_microline_count = 0;
     uint32_t allocated_fill_count = 0;
@@ -211,6 +333,32 @@ private:
     SceneBuffers scene_buffers;
 
     std::map<uint32_t, TileBatchInfoD3D11> tile_batch_info;
+
+    ComputeBackendD3D11 compute_backend_ = ComputeBackendD3D11::Gpu;
+
+    TileSortD3D11 tile_sort_ = TileSortD3D11::LinkedList;
+
+    FillVariantD3D11 fill_variant_ = FillVariantD3D11::LinkedList;
+
+    std::unique_ptr<CpuStagesD3D11> cpu_stages_;
+
+    /// Outputs of the CPU stages. Cleared after each frame.
+    std::map<uint32_t, CpuTileBatchD3D11> cpu_tile_batches_;
+
+    CpuStageStatsD3D11 cpu_stage_stats_;
+
+    /// Null if the context has no compute queue.
+    std::shared_ptr<Queue> compute_queue_;
+
+    /// Passes of the next compute queue submission. Null if there's no compute queue.
+    std::shared_ptr<RenderGraph> compute_graph_;
+
+    /// Where the stages preparing tiles on GPU add their passes: the compute graph if there's a compute queue,
+    /// otherwise the render graph.
+    std::shared_ptr<RenderGraph> prepare_graph_;
+
+    /// Latest compute submission that the graphics queue hasn't waited for yet. Zero if there's none.
+    uint64_t pending_compute_submission_ = 0;
 };
 
 } // namespace Pathfinder
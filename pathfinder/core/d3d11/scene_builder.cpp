@@ -17,10 +17,8 @@ struct PreparedClipPath {
 // Forward declaration.
 std::shared_ptr<GlobalPathId> add_clip_path_to_batch(Scene &scene,
                                                      const std::shared_ptr<uint32_t> &clip_path_id,
-                                                     uint32_t clip_level,
                                                      const Transform2 &transform,
                                                      LastSceneInfo &last_scene,
-                                                     uint32_t &next_batch_id,
                                                      ClipBatchesD3D11 &clip_batches_d3d11);
 
 std::shared_ptr<BuiltDrawPath> prepare_draw_path_for_gpu_binning(Scene &scene,
@@ -61,20 +59,13 @@ PreparedClipPath prepare_clip_path_for_gpu_binning(Scene &scene,
                                                    uint32_t clip_path_id,
                                                    const Transform2 &transform,
                                                    LastSceneInfo &last_scene,
-                                                   size_t clip_level,
-                                                   uint32_t &next_batch_id,
                                                    ClipBatchesD3D11 &clip_batches_d3d11) {
     auto effective_view_box = scene.get_view_box();
     auto clip_path = scene.clip_paths[clip_path_id];
 
     // Add subclip path if necessary.
-    auto subclip_id = add_clip_path_to_batch(scene,
-                                             clip_path.clip_path,
-                                             clip_level + 1,
-                                             transform,
-                                             last_scene,
-                                             next_batch_id,
-                                             clip_batches_d3d11);
+    auto subclip_id =
+        add_clip_path_to_batch(scene, clip_path.clip_path, transform, last_scene, clip_batches_d3d11);
 
     auto path_bounds = transform * clip_path.outline.bounds;
 
@@ -91,44 +82,35 @@ PreparedClipPath prepare_clip_path_for_gpu_binning(Scene &scene,
 
 std::shared_ptr<GlobalPathId> add_clip_path_to_batch(Scene &scene,
                                                      const std::shared_ptr<uint32_t> &clip_path_id,
-                                                     uint32_t clip_level,
                                                      const Transform2 &transform,
                                                      LastSceneInfo &last_scene,
-                                                     uint32_t &next_batch_id,
                                                      ClipBatchesD3D11 &clip_batches_d3d11) {
     if (!clip_path_id) {
         return nullptr;
     }
 
+    auto &batch = clip_batches_d3d11.prepare_batch;
+
     auto &map = clip_batches_d3d11.clip_id_to_path_batch_index;
     if (map.find(*clip_path_id) != map.end()) {
-        auto clip_path_batch_index = map[*clip_path_id];
-        auto &batch = clip_batches_d3d11.prepare_batches[clip_level];
-        return std::make_shared<GlobalPathId>(GlobalPathId{batch.batch_id, clip_path_batch_index});
+        return std::make_shared<GlobalPathId>(GlobalPathId{batch.batch_id, map[*clip_path_id]});
     }
 
-    auto prepared_clip_path = prepare_clip_path_for_gpu_binning(scene,
-                                                                *clip_path_id,
-                                                                transform,
-                                                                last_scene,
-                                                                clip_level,
-                                                                next_batch_id,
-                                                                clip_batches_d3d11);
+    auto prepared_clip_path =
+        prepare_clip_path_for_gpu_binning(scene, *clip_path_id, transform, last_scene, clip_batches_d3d11);
 
     auto clip_path = prepared_clip_path.built_path;
     auto subclip_id = prepared_clip_path.subclip_id;
 
-    while (clip_level >= clip_batches_d3d11.prepare_batches.size()) {
-        auto clip_tile_batch_id = next_batch_id++;
-        clip_batches_d3d11.prepare_batches.emplace_back(clip_tile_batch_id, PathSource::Clip);
-    }
+    // The subclip has been added before this path, so its level is already known.
+    auto &clip_levels = batch.prepare_info.clip_levels;
+    uint32_t clip_level = subclip_id ? clip_levels[subclip_id->path_index] + 1 : 0;
 
-    auto clip_path_batch_index =
-        clip_batches_d3d11.prepare_batches[clip_level].push(clip_path, *clip_path_id, subclip_id, true, last_scene);
+    auto clip_path_batch_index = batch.push(clip_path, *clip_path_id, subclip_id, true, last_scene);
+    clip_levels.push_back(clip_level);
 
     map[*clip_path_id] = clip_path_batch_index;
 
-    auto &batch = clip_batches_d3d11.prepare_batches[clip_level];
     return std::make_shared<GlobalPathId>(GlobalPathId{batch.batch_id, clip_path_batch_index});
 }
 
@@ -183,13 +165,8 @@ std::vector<DrawTileBatchD3D11> build_tile_batches_for_draw_path_display_item(
         // Add clip path if necessary.
         std::shared_ptr<GlobalPathId> clip_path;
         if (clip_batches_d3d11) {
-            clip_path = add_clip_path_to_batch(scene,
-                                               draw_path->clip_path_id,
-                                               0,
-                                               transform,
-                                               last_scene,
-                                               next_batch_id,
-                                               *clip_batches_d3d11);
+            clip_path =
+                add_clip_path_to_batch(scene, draw_path->clip_path_id, transform, last_scene, *clip_batches_d3d11);
         }
 
         draw_tile_batch->tile_batch_data.push(draw_path->path,
@@ -212,7 +189,7 @@ void SceneBuilderD3D11::build(Scene *_scene, Renderer *renderer) {
     built_segments = BuiltSegments::from_scene(*scene);
 
     // Build paint data.
-    auto paint_metadata = scene->palette.build_paint_info(renderer);
+    auto paint_metadata = scene->palette.build_paint_info(renderer, scene->get_render_target_lifetimes());
 
     auto last_scene =
         LastSceneInfo{scene->id, scene->epoch, built_segments.draw_segment_ranges, built_segments.clip_segment_ranges};
@@ -234,6 +211,7 @@ void SceneBuilderD3D11::build_tile_batches(LastSceneInfo &last_scene,
 
     if (built_paths == nullptr) { // Always holds true.
         clip_batches_d3d11 = std::make_shared<ClipBatchesD3D11>();
+        clip_batches_d3d11->prepare_batch = TileBatchDataD3D11(next_batch_id++, PathSource::Clip);
     }
 
     // Prepare display items.
@@ -264,6 +242,10 @@ void SceneBuilderD3D11::build_tile_batches(LastSceneInfo &last_scene,
             } break;
         }
     }
+
+    if (clip_batches_d3d11) {
+        clip_batches_d3d11->prepare_batch.group_columns_by_clip_level();
+    }
 }
 
 void SceneBuilderD3D11::finish_building(LastSceneInfo &last_scene,
@@ -38,8 +38,9 @@ struct BuiltSegments {
 };
 
 struct ClipBatchesD3D11 {
-    // Will be submitted in reverse (LIFO) order.
-    std::vector<TileBatchDataD3D11> prepare_batches;
+    /// All clip paths of the scene, whatever their nesting level.
+    /// The nesting level of each path is kept in `prepare_info.clip_levels`.
+    TileBatchDataD3D11 prepare_batch;
     std::unordered_map<uint32_t, uint32_t> clip_id_to_path_batch_index;
 };
 
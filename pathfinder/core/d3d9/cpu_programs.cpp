@@ -0,0 +1,873 @@
+#include "cpu_programs.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "../../common/parallel.h"
+#include "../../gpu/cpu/device.h"
+#include "../../gpu/cpu/texture_access.h"
+#include "data/gpu_data.h"
+#include "renderer.h"
+
+#ifdef PATHFINDER_USE_CPU
+
+namespace Pathfinder {
+
+namespace {
+
+// Each mask texel holds four vertically adjacent pixels, so an alpha tile takes 16x4 texels.
+constexpr int32_t MASK_TILE_WIDTH = 16;
+constexpr int32_t MASK_TILE_HEIGHT = 4;
+
+// Alpha tiles per row of the mask texture, as hardcoded in the clip shaders.
+constexpr int32_t MASK_TILES_PER_ROW = 256;
+
+// Metadata blocks per row of the metadata texture, and texels per block.
+constexpr int32_t METADATA_BLOCKS_PER_ROW = 128;
+constexpr int32_t METADATA_BLOCK_SIZE = 10;
+
+// Rows of the render target rasterized by a thread at a time.
+constexpr int32_t TILE_BAND_HEIGHT = 16;
+
+// Flags and ops of tile.frag.
+constexpr int32_t TILE_CTRL_MASK_MASK = 0x3;
+constexpr int32_t TILE_CTRL_MASK_WINDING = 0x1;
+constexpr int32_t TILE_CTRL_MASK_0_SHIFT = 0;
+
+constexpr int32_t COMBINER_CTRL_COLOR_COMBINE_MASK = 0x3;
+constexpr int32_t COMBINER_CTRL_COLOR_COMBINE_SRC_IN = 0x1;
+constexpr int32_t COMBINER_CTRL_COLOR_COMBINE_DEST_IN = 0x2;
+
+constexpr int32_t COMBINER_CTRL_FILTER_MASK = 0xf;
+constexpr int32_t COMBINER_CTRL_FILTER_RADIAL_GRADIENT = 0x1;
+constexpr int32_t COMBINER_CTRL_FILTER_TEXT = 0x2;
+constexpr int32_t COMBINER_CTRL_FILTER_BLUR = 0x3;
+constexpr int32_t COMBINER_CTRL_FILTER_COLOR_MATRIX = 0x4;
+
+constexpr int32_t COMBINER_CTRL_COMPOSITE_MASK = 0xf;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_NORMAL = 0x0;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_MULTIPLY = 0x1;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_SCREEN = 0x2;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_OVERLAY = 0x3;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_DARKEN = 0x4;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_LIGHTEN = 0x5;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_COLOR_DODGE = 0x6;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_COLOR_BURN = 0x7;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_HARD_LIGHT = 0x8;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_SOFT_LIGHT = 0x9;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_DIFFERENCE = 0xa;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_EXCLUSION = 0xb;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_HUE = 0xc;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_SATURATION = 0xd;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_COLOR = 0xe;
+
+constexpr int32_t COMBINER_CTRL_COLOR_FILTER_SHIFT = 4;
+constexpr int32_t COMBINER_CTRL_COLOR_COMBINE_SHIFT = 8;
+constexpr int32_t COMBINER_CTRL_COMPOSITE_SHIFT = 10;
+
+constexpr float FRAC_6_PI = 1.9098593171027443f;
+constexpr float FRAC_PI_3 = 1.0471975511965976f;
+
+/// Vertex data isn't necessarily aligned for the instance type.
+template <typename T>
+T read_instance(const uint8_t *data, size_t stride, uint32_t index) {
+    T value;
+    memcpy(&value, data + stride * index, sizeof(T));
+    return value;
+}
+
+float get_lane(const F32x4 &v, int32_t lane) {
+    switch (lane) {
+        case 0:
+            return v.get<0>();
+        case 1:
+            return v.get<1>();
+        case 2:
+            return v.get<2>();
+        default:
+            return v.get<3>();
+    }
+}
+
+F32x4 with_alpha(const F32x4 &v, float alpha) {
+    return {v.get<0>(), v.get<1>(), v.get<2>(), alpha};
+}
+
+/// Texel fetch with clamping, which is what sampling a texel center with a clamping sampler gives.
+F32x4 fetch_clamped(TextureNull &texture, Vec2I coord) {
+    auto size = texture.get_size();
+    return load_texel(texture, {std::clamp(coord.x, 0, size.x - 1), std::clamp(coord.y, 0, size.y - 1)});
+}
+
+// Fill program
+// --------------------------------------------------
+
+/// Mirrors computeCoverage() of fill.frag. `from` and `to` are relative to the center of the first pixel of a texel.
+F32x4 compute_coverage(Vec2F from, Vec2F to, TextureNull &area_lut, const SamplerDescriptor &sampler) {
+    Vec2F left = from.x < to.x ? from : to, right = from.x < to.x ? to : from;
+
+    float window_x = std::clamp(from.x, -0.5f, 0.5f);
+    float window_y = std::clamp(to.x, -0.5f, 0.5f);
+
+    // The GPU multiplies whatever it sampled with zero for vertical segments. Skip the NaNs.
+    float dx = window_x - window_y;
+    if (dx == 0) {
+        return {};
+    }
+
+    float offset = (window_x + window_y) * 0.5f - left.x;
+
+    float t = offset / (right.x - left.x);
+
+    float y = left.y + (right.y - left.y) * t;
+    float d = (right.y - left.y) / (right.x - left.x);
+
+    return sample_texture(area_lut, sampler, {(y + 8.0f) / 16.0f, std::abs(d * dx) / 16.0f}) * F32x4::splat(dx);
+}
+
+/// Mirrors fill.vert and fill.frag. Fills are accumulated into the mask texture with additive blending.
+class FillProgram : public RenderProgramCpu {
+public:
+    void draw(const DrawCpu &draw) override {
+        auto uniform_data = draw.get_uniform(0);
+        auto area_lut = draw.get_texture(1);
+        if (uniform_data == nullptr || area_lut == nullptr || draw.vertex_buffer_count < 2) {
+            return;
+        }
+
+        FillUniformD3d9 uniform;
+        memcpy(&uniform, uniform_data, sizeof(FillUniformD3d9));
+
+        auto area_lut_sampler = draw.get_sampler(1);
+
+        // Group fills by alpha tile, keeping their order, so that each tile is accumulated by a single thread.
+        std::vector<Fill> fills(draw.instance_count);
+        memcpy(fills.data(), draw.vertex_data[1], sizeof(Fill) * fills.size());
+
+        uint32_t tile_count = 0;
+        for (const auto &fill : fills) {
+            tile_count = std::max(tile_count, fill.link + 1);
+        }
+
+        std::vector<uint32_t> tile_offsets(tile_count + 1, 0);
+        for (const auto &fill : fills) {
+            tile_offsets[fill.link + 1]++;
+        }
+
+        std::vector<uint32_t> tiles;
+        for (uint32_t i = 0; i < tile_count; i++) {
+            if (tile_offsets[i + 1] > 0) {
+                tiles.push_back(i);
+            }
+            tile_offsets[i + 1] += tile_offsets[i];
+        }
+
+        std::vector<Fill> sorted_fills(fills.size());
+        {
+            auto cursors = tile_offsets;
+            for (const auto &fill : fills) {
+                sorted_fills[cursors[fill.link]++] = fill;
+            }
+        }
+
+        auto tiles_per_row = (uint32_t)(uniform.framebuffer_size.x / uniform.tile_size.x);
+        auto target_size = draw.target->get_size();
+
+        parallel_for(tiles.size(), draw.thread_count, [&](uint32_t i) {
+            uint32_t tile_index = tiles[i];
+
+            auto tile_origin = Vec2I(tile_index % tiles_per_row * MASK_TILE_WIDTH,
+                                     tile_index / tiles_per_row * MASK_TILE_HEIGHT);
+            if (tile_origin.x + MASK_TILE_WIDTH > target_size.x || tile_origin.y + MASK_TILE_HEIGHT > target_size.y) {
+                return;
+            }
+
+            F32x4 texels[MASK_TILE_HEIGHT][MASK_TILE_WIDTH];
+            for (int32_t y = 0; y < MASK_TILE_HEIGHT; y++) {
+                for (int32_t x = 0; x < MASK_TILE_WIDTH; x++) {
+                    texels[y][x] = load_texel(*draw.target, tile_origin + Vec2I(x, y));
+                }
+            }
+
+            for (uint32_t f = tile_offsets[tile_index]; f < tile_offsets[tile_index + 1]; f++) {
+                auto &segment = sorted_fills[f].line_segment;
+
+                Vec2F from = Vec2F(segment.from_x, segment.from_y) / 256.0f;
+                Vec2F to = Vec2F(segment.to_x, segment.to_y) / 256.0f;
+
+                // The fill quad, compressed vertically like in fill.vert.
+                int32_t left = std::max((int32_t)std::floor(std::min(from.x, to.x)), 0);
+                int32_t right = std::min((int32_t)std::ceil(std::max(from.x, to.x)), MASK_TILE_WIDTH);
+                int32_t top = std::max((int32_t)std::floor(std::floor(std::min(from.y, to.y)) * 0.25f), 0);
+                int32_t bottom = MASK_TILE_HEIGHT;
+
+                for (int32_t y = top; y < bottom; y++) {
+                    for (int32_t x = left; x < right; x++) {
+                        auto offset = Vec2F(x + 0.5f, y * 4.0f + 0.5f);
+                        texels[y][x] += compute_coverage(from - offset, to - offset, *area_lut, area_lut_sampler);
+                    }
+                }
+            }
+
+            for (int32_t y = 0; y < MASK_TILE_HEIGHT; y++) {
+                for (int32_t x = 0; x < MASK_TILE_WIDTH; x++) {
+                    store_texel(*draw.target, tile_origin + Vec2I(x, y), texels[y][x]);
+                }
+            }
+        });
+    }
+};
+
+// Tile program
+// --------------------------------------------------
+
+/// Varyings of tile.vert, for one instance.
+struct TileInstance {
+    /// Covered pixels. Empty if the tile was culled.
+    RectI rect;
+
+    /// Screen coordinates of the tile corners at offsets (0, 0) and (1, 1).
+    Vec2F screen_from;
+    Vec2F screen_to;
+
+    /// Values at the (0, 0) corner.
+    Vec2F position;
+    Vec2F mask_tex_coord;
+
+    float backdrop = 0;
+    int32_t tile_ctrl = 0;
+    int32_t ctrl = 0;
+
+    F32x4 color_tex_matrix;
+    F32x4 color_tex_offsets;
+    F32x4 base_color;
+    F32x4 filter_params[5];
+
+    /// Premultiplied color of tiles whose color doesn't vary per pixel.
+    bool solid = false;
+    F32x4 solid_color;
+};
+
+/// Bindings of the tile pipeline, fetched once per draw.
+struct TileResources {
+    TileUniformD3d9 uniform;
+
+    TextureNull *color_texture;
+    SamplerDescriptor color_sampler;
+    TextureNull *mask_texture;
+    TextureNull *dest_texture;
+    SamplerDescriptor dest_sampler;
+    TextureNull *gamma_lut;
+    SamplerDescriptor gamma_lut_sampler;
+};
+
+// Filters
+
+float filter_text_sample_1_tap(float offset, const TileResources &res, Vec2F color_tex_coord) {
+    return sample_texture(*res.color_texture, res.color_sampler, color_tex_coord + Vec2F(offset, 0)).get<0>();
+}
+
+float filter_text_gamma_correct_channel(float bg_color, float fg_color, const TileResources &res) {
+    return sample_texture(*res.gamma_lut, res.gamma_lut_sampler, {fg_color, 1.0f - bg_color}).get<0>();
+}
+
+float dot(const float a[4], const float b[4]) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+}
+
+F32x4 filter_text(Vec2F color_tex_coord, const TileResources &res, const TileInstance &instance) {
+    auto &p0 = instance.filter_params[0];
+    auto &p1 = instance.filter_params[1];
+    auto &p2 = instance.filter_params[2];
+
+    float kernel[4] = {p0.get<0>(), p0.get<1>(), p0.get<2>(), p0.get<3>()};
+    float bg_color[3] = {p1.get<0>(), p1.get<1>(), p1.get<2>()};
+    float fg_color[3] = {p2.get<0>(), p2.get<1>(), p2.get<2>()};
+    bool gamma_correction_enabled = p2.get<3>() != 0;
+
+    float alpha[3];
+    if (kernel[3] == 0) {
+        float a = filter_text_sample_1_tap(0, res, color_tex_coord);
+        alpha[0] = alpha[1] = alpha[2] = a;
+    } else {
+        bool wide = kernel[0] > 0;
+        float one_pixel = 1.0f / res.uniform.color_texture_size.x;
+
+        // Taps -4 to 4.
+        float taps[9];
+        for (int32_t i = 0; i < 9; i++) {
+            bool outer = i == 0 || i == 8;
+            taps[i] = outer && !wide ? 0 : filter_text_sample_1_tap((i - 4) * one_pixel, res, color_tex_coord);
+        }
+
+        // filterTextConvolve7Tap() with the kernel mirrored around the center.
+        float mirrored_kernel[4] = {kernel[2], kernel[1], kernel[0], 0};
+        for (int32_t c = 0; c < 3; c++) {
+            float right[4] = {taps[c + 4], taps[c + 5], taps[c + 6], 0};
+            alpha[c] = dot(&taps[c], kernel) + dot(right, mirrored_kernel);
+        }
+    }
+
+    if (gamma_correction_enabled) {
+        for (int32_t c = 0; c < 3; c++) {
+            alpha[c] = filter_text_gamma_correct_channel(bg_color[c], alpha[c], res);
+        }
+    }
+
+    return {bg_color[0] + (fg_color[0] - bg_color[0]) * alpha[0],
+            bg_color[1] + (fg_color[1] - bg_color[1]) * alpha[1],
+            bg_color[2] + (fg_color[2] - bg_color[2]) * alpha[2],
+            1.0f};
+}
+
+F32x4 filter_radial_gradient(Vec2F color_tex_coord, const TileResources &res, const TileInstance &instance) {
+    auto &p0 = instance.filter_params[0];
+    auto &p1 = instance.filter_params[1];
+
+    Vec2F line_from = p0.xy(), line_vector = p0.zw();
+    Vec2F radii = p1.xy(), uv_origin = p1.zw();
+
+    Vec2F dp = color_tex_coord - line_from, dc = line_vector;
+    float dr = radii.y - radii.x;
+
+    float a = dc.x * dc.x + dc.y * dc.y - dr * dr;
+    float b = dp.x * dc.x + dp.y * dc.y + radii.x * dr;
+    float c = dp.x * dp.x + dp.y * dp.y - radii.x * radii.x;
+    float discrim = b * b - a * c;
+
+    if (discrim == 0) {
+        return {};
+    }
+
+    float ts_x = (std::sqrt(discrim) + b) / a;
+    float ts_y = (-std::sqrt(discrim) + b) / a;
+    if (ts_x > ts_y) {
+        std::swap(ts_x, ts_y);
+    }
+    float t = ts_x >= 0 ? ts_x : ts_y;
+
+    return sample_texture(*res.color_texture, res.color_sampler, uv_origin + Vec2F(t, 0));
+}
+
+F32x4 filter_blur(Vec2F color_tex_coord, const TileResources &res, const TileInstance &instance) {
+    auto &p0 = instance.filter_params[0];
+    auto &p1 = instance.filter_params[1];
+    auto &p2 = instance.filter_params[2];
+
+    Vec2F src_offset_scale = p0.xy() / res.uniform.color_texture_size;
+    auto support = (int32_t)p0.get<2>();
+    float gauss_coeff[3] = {p1.get<0>(), p1.get<1>(), p1.get<2>()};
+    float strength = p2.get<0>();
+
+    float gauss_sum = gauss_coeff[0];
+
+    F32x4 color = sample_texture(*res.color_texture, res.color_sampler, color_tex_coord) * F32x4::splat(gauss_coeff[0]);
+
+    auto advance = [&gauss_coeff] {
+        gauss_coeff[0] *= gauss_coeff[1];
+        gauss_coeff[1] *= gauss_coeff[2];
+    };
+
+    advance();
+
+    // Two texels per sample, using linear filtering. See filterBlur() of tile.frag.
+    for (int32_t i = 1; i <= support; i += 2) {
+        float gauss_partial_sum = gauss_coeff[0];
+        advance();
+        gauss_partial_sum += gauss_coeff[0];
+
+        Vec2F src_offset = src_offset_scale * (float(i) + gauss_coeff[0] / gauss_partial_sum);
+
+        color += (sample_texture(*res.color_texture, res.color_sampler, color_tex_coord - src_offset) +
+                  sample_texture(*res.color_texture, res.color_sampler, color_tex_coord + src_offset)) *
+                 F32x4::splat(gauss_partial_sum);
+
+        gauss_sum += 2.0f * gauss_partial_sum;
+        advance();
+    }
+
+    return color / F32x4::splat(gauss_sum) * F32x4::splat(strength);
+}
+
+F32x4 filter_color_matrix(Vec2F color_tex_coord, const TileResources &res, const TileInstance &instance) {
+    auto src_color = sample_texture(*res.color_texture, res.color_sampler, color_tex_coord);
+    auto &p = instance.filter_params;
+
+    // Columns of the matrix are the first four filter params.
+    return p[0] * F32x4::splat(src_color.get<0>()) + p[1] * F32x4::splat(src_color.get<1>()) +
+           p[2] * F32x4::splat(src_color.get<2>()) + p[3] * F32x4::splat(src_color.get<3>()) + p[4];
+}
+
+F32x4 filter_color(Vec2F color_tex_coord, const TileResources &res, const TileInstance &instance, int32_t filter) {
+    switch (filter) {
+        case COMBINER_CTRL_FILTER_RADIAL_GRADIENT:
+            return filter_radial_gradient(color_tex_coord, res, instance);
+        case COMBINER_CTRL_FILTER_BLUR:
+            return filter_blur(color_tex_coord, res, instance);
+        case COMBINER_CTRL_FILTER_TEXT:
+            return filter_text(color_tex_coord, res, instance);
+        case COMBINER_CTRL_FILTER_COLOR_MATRIX:
+            return filter_color_matrix(color_tex_coord, res, instance);
+        default:
+            return sample_texture(*res.color_texture, res.color_sampler, color_tex_coord);
+    }
+}
+
+F32x4 combine_color_0(const F32x4 &dest_color, const F32x4 &src_color, int32_t op) {
+    switch (op) {
+        case COMBINER_CTRL_COLOR_COMBINE_SRC_IN:
+            return with_alpha(src_color, src_color.get<3>() * dest_color.get<3>());
+        case COMBINER_CTRL_COLOR_COMBINE_DEST_IN:
+            return with_alpha(dest_color, src_color.get<3>() * dest_color.get<3>());
+        default:
+            return dest_color;
+    }
+}
+
+// Compositing
+
+float composite_screen(float dest, float src) {
+    return dest + src - dest * src;
+}
+
+float composite_hard_light(float dest, float src) {
+    return src <= 0.5f ? dest * 2.0f * src : composite_screen(dest, 2.0f * src - 1.0f);
+}
+
+float composite_color_dodge(float dest, float src) {
+    return dest == 0 ? 0 : (src == 1 ? 1 : dest / (1.0f - src));
+}
+
+float composite_soft_light(float dest, float src) {
+    float darkened_dest = dest <= 0.25f ? ((16.0f * dest - 12.0f) * dest + 4.0f) * dest : std::sqrt(dest);
+    float factor = src <= 0.5f ? dest * (1.0f - dest) : darkened_dest - dest;
+    return dest + (src * 2.0f - 1.0f) * factor;
+}
+
+/// The separable blend modes of compositeRGB(), per channel.
+float composite_channel(float dest, float src, int32_t op) {
+    switch (op) {
+        case COMBINER_CTRL_COMPOSITE_MULTIPLY:
+            return dest * src;
+        case COMBINER_CTRL_COMPOSITE_SCREEN:
+            return composite_screen(dest, src);
+        case COMBINER_CTRL_COMPOSITE_OVERLAY:
+            return composite_hard_light(src, dest);
+        case COMBINER_CTRL_COMPOSITE_DARKEN:
+            return std::min(dest, src);
+        case COMBINER_CTRL_COMPOSITE_LIGHTEN:
+            return std::max(dest, src);
+        case COMBINER_CTRL_COMPOSITE_COLOR_DODGE:
+            return composite_color_dodge(dest, src);
+        case COMBINER_CTRL_COMPOSITE_COLOR_BURN:
+            return 1.0f - composite_color_dodge(1.0f - dest, 1.0f - src);
+        case COMBINER_CTRL_COMPOSITE_HARD_LIGHT:
+            return composite_hard_light(dest, src);
+        case COMBINER_CTRL_COMPOSITE_SOFT_LIGHT:
+            return composite_soft_light(dest, src);
+        case COMBINER_CTRL_COMPOSITE_DIFFERENCE:
+            return std::abs(dest - src);
+        case COMBINER_CTRL_COMPOSITE_EXCLUSION:
+            return dest + src - 2.0f * dest * src;
+        default:
+            return src;
+    }
+}
+
+float composite_divide(float num, float denom) {
+    return denom != 0 ? num / denom : 0;
+}
+
+void composite_rgb_to_hsl(const float rgb[3], float hsl[3]) {
+    float v = std::max(std::max(rgb[0], rgb[1]), rgb[2]), x_min = std::min(std::min(rgb[0], rgb[1]), rgb[2]);
+    float c = v - x_min, l = (x_min + v) * 0.5f;
+
+    float terms[3];
+    if (rgb[0] == v) {
+        terms[0] = 0, terms[1] = rgb[1], terms[2] = rgb[2];
+    } else if (rgb[1] == v) {
+        terms[0] = 2, terms[1] = rgb[2], terms[2] = rgb[0];
+    } else {
+        terms[0] = 4, terms[1] = rgb[0], terms[2] = rgb[1];
+    }
+
+    hsl[0] = FRAC_PI_3 * composite_divide(terms[0] * c + terms[1] - terms[2], c);
+    hsl[1] = composite_divide(c, v);
+    hsl[2] = l;
+}
+
+void composite_hsl_to_rgb(const float hsl[3], float rgb[3]) {
+    float a = hsl[1] * std::min(hsl[2], 1.0f - hsl[2]);
+
+    const float ks_base[3] = {0, 8, 4};
+    for (int32_t i = 0; i < 3; i++) {
+        // GLSL mod() takes the sign of the divisor.
+        float k = ks_base[i] + hsl[0] * FRAC_6_PI;
+        k = k - 12.0f * std::floor(k / 12.0f);
+        rgb[i] = hsl[2] - std::clamp(std::min(k - 3.0f, 9.0f - k), -1.0f, 1.0f) * a;
+    }
+}
+
+F32x4 composite(const F32x4 &src_color, Vec2F frag_coord, const TileResources &res, int32_t op) {
+    if (op == COMBINER_CTRL_COMPOSITE_NORMAL) {
+        return src_color;
+    }
+
+    auto dest_color =
+        sample_texture(*res.dest_texture, res.dest_sampler, frag_coord / res.uniform.framebuffer_size);
+
+    float dest_rgb[3] = {dest_color.get<0>(), dest_color.get<1>(), dest_color.get<2>()};
+    float src_rgb[3] = {src_color.get<0>(), src_color.get<1>(), src_color.get<2>()};
+    float blended_rgb[3];
+
+    if (op >= COMBINER_CTRL_COMPOSITE_HUE) {
+        float dest_hsl[3], src_hsl[3], blended_hsl[3];
+        composite_rgb_to_hsl(dest_rgb, dest_hsl);
+        composite_rgb_to_hsl(src_rgb, src_hsl);
+
+        // Take hue, saturation or lightness from the source.
+        bool src_h = op == COMBINER_CTRL_COMPOSITE_HUE || op == COMBINER_CTRL_COMPOSITE_COLOR;
+        bool src_s = op == COMBINER_CTRL_COMPOSITE_SATURATION || op == COMBINER_CTRL_COMPOSITE_COLOR;
+        bool src_l = op > COMBINER_CTRL_COMPOSITE_COLOR;
+        blended_hsl[0] = src_h ? src_hsl[0] : dest_hsl[0];
+        blended_hsl[1] = src_s ? src_hsl[1] : dest_hsl[1];
+        blended_hsl[2] = src_l ? src_hsl[2] : dest_hsl[2];
+
+        composite_hsl_to_rgb(blended_hsl, blended_rgb);
+    } else {
+        for (int32_t i = 0; i < 3; i++) {
+            blended_rgb[i] = composite_channel(dest_rgb[i], src_rgb[i], op);
+        }
+    }
+
+    auto src_alpha = F32x4::splat(src_color.get<3>());
+    auto dest_alpha = F32x4::splat(dest_color.get<3>());
+    auto one = F32x4::splat(1);
+
+    auto blended = F32x4(blended_rgb[0], blended_rgb[1], blended_rgb[2], 0);
+    auto result = src_alpha * (one - dest_alpha) * src_color + src_alpha * dest_alpha * blended +
+                  (one - src_alpha) * dest_color;
+
+    return with_alpha(result, 1.0f);
+}
+
+float sample_mask(float mask_alpha, Vec2F mask_tex_coord, float backdrop, const TileResources &res, int32_t ctrl) {
+    if (ctrl == 0) {
+        return mask_alpha;
+    }
+
+    auto coord = Vec2I((int32_t)std::floor(mask_tex_coord.x), (int32_t)std::floor(mask_tex_coord.y));
+    auto texel = fetch_clamped(*res.mask_texture, {coord.x, coord.y / 4});
+
+    float coverage = get_lane(texel, coord.y % 4) + backdrop;
+
+    if ((ctrl & TILE_CTRL_MASK_WINDING) != 0) {
+        coverage = std::abs(coverage);
+    } else {
+        coverage = 1.0f - std::abs(1.0f - (coverage - 2.0f * std::floor(coverage * 0.5f)));
+    }
+
+    return std::min(mask_alpha, coverage);
+}
+
+/// Mirrors calculateColor() of tile.frag. Returns a premultiplied color.
+F32x4 calculate_color(const TileInstance &instance, Vec2F t, Vec2F frag_coord, const TileResources &res) {
+    auto tile_size = res.uniform.tile_size;
+
+    int32_t mask_ctrl_0 = (instance.tile_ctrl >> TILE_CTRL_MASK_0_SHIFT) & TILE_CTRL_MASK_MASK;
+    float mask_alpha =
+        sample_mask(1.0f, instance.mask_tex_coord + t * tile_size, instance.backdrop, res, mask_ctrl_0);
+
+    auto color = instance.base_color;
+
+    int32_t color_0_combine = (instance.ctrl >> COMBINER_CTRL_COLOR_COMBINE_SHIFT) & COMBINER_CTRL_COLOR_COMBINE_MASK;
+
+    if (color_0_combine != 0) {
+        int32_t color_0_filter = (instance.ctrl >> COMBINER_CTRL_COLOR_FILTER_SHIFT) & COMBINER_CTRL_FILTER_MASK;
+
+        // mat2(colorTexMatrix0) * position + colorTexOffsets.xy
+        auto position = instance.position + t * tile_size;
+        auto &m = instance.color_tex_matrix;
+        auto color_tex_coord = Vec2F(m.get<0>() * position.x + m.get<2>() * position.y,
+                                     m.get<1>() * position.x + m.get<3>() * position.y) +
+                               instance.color_tex_offsets.xy();
+
+        auto color_0 = filter_color(color_tex_coord, res, instance, color_0_filter);
+        color = combine_color_0(color, color_0, color_0_combine);
+    }
+
+    color = with_alpha(color, color.get<3>() * mask_alpha);
+
+    int32_t composite_op = (instance.ctrl >> COMBINER_CTRL_COMPOSITE_SHIFT) & COMBINER_CTRL_COMPOSITE_MASK;
+    color = composite(color, frag_coord, res, composite_op);
+
+    float alpha = color.get<3>();
+
+    return with_alpha(color * F32x4::splat(alpha), alpha);
+}
+
+/// Mirrors tile.vert and tile.frag. Tiles are blended over the target in instance order.
+///
+/// The tile transform is expected to be a scale and a translation, which is all the renderer uses.
+class TileProgram : public RenderProgramCpu {
+public:
+    void draw(const DrawCpu &draw) override {
+        auto metadata_texture = draw.get_texture(0);
+        auto z_buffer_texture = draw.get_texture(1);
+        auto uniform_data = draw.get_uniform(2);
+
+        TileResources res{};
+        res.color_texture = draw.get_texture(3);
+        res.color_sampler = draw.get_sampler(3);
+        res.mask_texture = draw.get_texture(4);
+        res.dest_texture = draw.get_texture(5);
+        res.dest_sampler = draw.get_sampler(5);
+        res.gamma_lut = draw.get_texture(6);
+        res.gamma_lut_sampler = draw.get_sampler(6);
+
+        if (metadata_texture == nullptr || z_buffer_texture == nullptr || uniform_data == nullptr ||
+            res.color_texture == nullptr || res.mask_texture == nullptr || res.dest_texture == nullptr ||
+            res.gamma_lut == nullptr || draw.vertex_buffer_count < 2) {
+            return;
+        }
+
+        memcpy(&res.uniform, uniform_data, sizeof(TileUniformD3d9));
+
+        auto z_sampler = draw.get_sampler(1);
+
+        auto target_rect = RectI({0, 0}, draw.target->get_size()).intersection(draw.viewport);
+
+        // Vertex stage.
+        std::vector<TileInstance> instances(draw.instance_count);
+
+        parallel_for(draw.instance_count, draw.thread_count, [&](uint32_t i) {
+            auto primitive = read_instance<TileObjectPrimitive>(draw.vertex_data[1], sizeof(TileObjectPrimitive), i);
+            auto &instance = instances[i];
+
+            auto tile_origin = Vec2F(primitive.tile_x, primitive.tile_y);
+
+            // Tile culling, with the same Z lookup as tile.vert.
+            auto z_uv = ((tile_origin + Vec2F(0.5f)) / res.uniform.z_buffer_size) * 255.0f;
+            auto z_value = sample_texture(*z_buffer_texture, z_sampler, z_uv);
+            int32_t packed_z = (int32_t)z_value.get<0>() | ((int32_t)z_value.get<1>() << 8) |
+                               ((int32_t)z_value.get<2>() << 16) | ((int32_t)z_value.get<3>() << 24);
+            if ((int32_t)primitive.path_id < packed_z) {
+                return;
+            }
+
+            uint8_t mask_tex_coord[4];
+            memcpy(mask_tex_coord, &primitive.alpha_tile_id.value, 4);
+
+            if (primitive.backdrop == 0 && mask_tex_coord[3] != 0) {
+                return;
+            }
+
+            auto mask_tile_coord = Vec2F(mask_tex_coord[0], mask_tex_coord[1] + 256 * mask_tex_coord[2]);
+
+            F32x4 metadata[9];
+            auto metadata_coord = Vec2I(primitive.metadata_id % METADATA_BLOCKS_PER_ROW * METADATA_BLOCK_SIZE,
+                                        primitive.metadata_id / METADATA_BLOCKS_PER_ROW);
+            for (int32_t e = 0; e < 9; e++) {
+                metadata[e] = fetch_clamped(*metadata_texture, metadata_coord + Vec2I(e, 0));
+            }
+
+            instance.position = tile_origin * res.uniform.tile_size;
+            instance.mask_tex_coord = mask_tile_coord * res.uniform.tile_size;
+            instance.backdrop = primitive.backdrop;
+            instance.tile_ctrl = (int8_t)primitive.ctrl;
+            instance.ctrl = (int32_t)metadata[8].get<0>();
+            instance.color_tex_matrix = metadata[0];
+            instance.color_tex_offsets = metadata[1];
+            instance.base_color = metadata[2];
+            for (int32_t p = 0; p < 5; p++) {
+                instance.filter_params[p] = metadata[3 + p];
+            }
+
+            instance.screen_from = to_screen(instance.position, res.uniform.transform, draw.viewport);
+            instance.screen_to =
+                to_screen(instance.position + res.uniform.tile_size, res.uniform.transform, draw.viewport);
+
+            // Pixels whose centers are inside the quad.
+            auto screen_min = instance.screen_from.min(instance.screen_to);
+            auto screen_max = instance.screen_from.max(instance.screen_to);
+            instance.rect = RectI((int32_t)std::ceil(screen_min.x - 0.5f),
+                                  (int32_t)std::ceil(screen_min.y - 0.5f),
+                                  (int32_t)std::ceil(screen_max.x - 0.5f),
+                                  (int32_t)std::ceil(screen_max.y - 0.5f))
+                                .intersection(target_rect);
+
+            // Solid tiles and tiles of a plain color only need shading once.
+            int32_t mask_ctrl_0 = (instance.tile_ctrl >> TILE_CTRL_MASK_0_SHIFT) & TILE_CTRL_MASK_MASK;
+            int32_t color_0_combine =
+                (instance.ctrl >> COMBINER_CTRL_COLOR_COMBINE_SHIFT) & COMBINER_CTRL_COLOR_COMBINE_MASK;
+            int32_t composite_op = (instance.ctrl >> COMBINER_CTRL_COMPOSITE_SHIFT) & COMBINER_CTRL_COMPOSITE_MASK;
+
+            if (mask_ctrl_0 == 0 && color_0_combine == 0 && composite_op == COMBINER_CTRL_COMPOSITE_NORMAL) {
+                instance.solid = true;
+                instance.solid_color = calculate_color(instance, {}, {}, res);
+            }
+        });
+
+        // Fragment stage. Threads take bands of rows and go through all tiles in order, so that blending stays
+        // in order without synchronization.
+        if (!target_rect.is_valid()) {
+            return;
+        }
+
+        uint32_t band_count = (target_rect.height() + TILE_BAND_HEIGHT - 1) / TILE_BAND_HEIGHT;
+
+        parallel_for(band_count, draw.thread_count, [&](uint32_t band) {
+            int32_t band_top = target_rect.top + band * TILE_BAND_HEIGHT;
+            auto band_rect = RectI(target_rect.left,
+                                   band_top,
+                                   target_rect.right,
+                                   std::min(band_top + TILE_BAND_HEIGHT, target_rect.bottom));
+
+            for (const auto &instance : instances) {
+                auto rect = instance.rect.intersection(band_rect);
+                if (rect.width() <= 0 || rect.height() <= 0) {
+                    continue;
+                }
+
+                auto screen_size = instance.screen_to - instance.screen_from;
+
+                // Opaque solid tiles replace what's below.
+                if (instance.solid && instance.solid_color.get<3>() == 1.0f) {
+                    for (int32_t y = rect.top; y < rect.bottom; y++) {
+                        for (int32_t x = rect.left; x < rect.right; x++) {
+                            store_texel(*draw.target, {x, y}, instance.solid_color);
+                        }
+                    }
+                    continue;
+                }
+
+                for (int32_t y = rect.top; y < rect.bottom; y++) {
+                    for (int32_t x = rect.left; x < rect.right; x++) {
+                        auto frag_coord = Vec2F(x + 0.5f, y + 0.5f);
+
+                        F32x4 color;
+                        if (instance.solid) {
+                            color = instance.solid_color;
+                        } else {
+                            auto t = (frag_coord - instance.screen_from) / screen_size;
+                            color = calculate_color(instance, t, frag_coord, res);
+                        }
+
+                        // BlendState::from_over().
+                        auto dest = load_texel(*draw.target, {x, y});
+                        store_texel(*draw.target, {x, y}, color + dest * F32x4::splat(1.0f - color.get<3>()));
+                    }
+                }
+            }
+        });
+    }
+
+private:
+    /// Position -> NDC -> screen coordinates, with NDC -1 at the first row.
+    static Vec2F to_screen(Vec2F position, const Mat4 &transform, const RectI &viewport) {
+        auto &m = transform.v;
+        auto ndc = Vec2F(m[0] * position.x + m[4] * position.y + m[12], m[1] * position.x + m[5] * position.y + m[13]);
+
+        return Vec2F(viewport.left, viewport.top) + (ndc + Vec2F(1.0f)) * 0.5f * viewport.size().to_f32();
+    }
+};
+
+// Clip programs
+// --------------------------------------------------
+
+Vec2I get_mask_tile_origin(int32_t tile_index) {
+    return {tile_index % MASK_TILES_PER_ROW * MASK_TILE_WIDTH, tile_index / MASK_TILES_PER_ROW * MASK_TILE_HEIGHT};
+}
+
+/// Mirrors tile_clip_copy.vert and tile_clip_copy.frag. Copies alpha tiles of the mask into the same place of
+/// the target. Each clip holds two instances, the destination and the source tile.
+class TileClipCopyProgram : public RenderProgramCpu {
+public:
+    void draw(const DrawCpu &draw) override {
+        auto src = draw.get_texture(1);
+        if (src == nullptr || draw.vertex_buffer_count < 2) {
+            return;
+        }
+
+        auto target_size = draw.target->get_size();
+
+        // Copies are cheap, and the same tile may show up more than once. Keep it on one thread.
+        for (uint32_t i = 0; i < draw.instance_count; i++) {
+            auto tile_index = read_instance<int32_t>(draw.vertex_data[1], sizeof(Clip) / 2, i);
+            if (tile_index < 0) {
+                continue;
+            }
+
+            auto origin = get_mask_tile_origin(tile_index);
+            if (origin.x + MASK_TILE_WIDTH > target_size.x || origin.y + MASK_TILE_HEIGHT > target_size.y) {
+                continue;
+            }
+
+            for (int32_t y = 0; y < MASK_TILE_HEIGHT; y++) {
+                for (int32_t x = 0; x < MASK_TILE_WIDTH; x++) {
+                    auto coord = origin + Vec2I(x, y);
+                    store_texel(*draw.target, coord, fetch_clamped(*src, coord));
+                }
+            }
+        }
+    }
+};
+
+/// Mirrors tile_clip_combine.vert and tile_clip_combine.frag. Intersects the coverage of two alpha tiles into the
+/// destination tile.
+class TileClipCombineProgram : public RenderProgramCpu {
+public:
+    void draw(const DrawCpu &draw) override {
+        auto src = draw.get_texture(1);
+        if (src == nullptr || draw.vertex_buffer_count < 2) {
+            return;
+        }
+
+        auto target_size = draw.target->get_size();
+
+        // Later clips of the same tile overwrite earlier ones, so keep the order.
+        for (uint32_t i = 0; i < draw.instance_count; i++) {
+            auto clip = read_instance<Clip>(draw.vertex_data[1], sizeof(Clip), i);
+
+            auto dest_tile_index = (int32_t)clip.dest_tile_id.value;
+            auto src_tile_index = (int32_t)clip.src_tile_id.value;
+            if (dest_tile_index < 0) {
+                continue;
+            }
+
+            auto dest_origin = get_mask_tile_origin(dest_tile_index);
+            auto src_origin = get_mask_tile_origin(src_tile_index);
+            if (dest_origin.x + MASK_TILE_WIDTH > target_size.x ||
+                dest_origin.y + MASK_TILE_HEIGHT > target_size.y) {
+                continue;
+            }
+
+            auto dest_backdrop = F32x4::splat((float)clip.dest_backdrop);
+            auto src_backdrop = F32x4::splat((float)clip.src_backdrop);
+
+            for (int32_t y = 0; y < MASK_TILE_HEIGHT; y++) {
+                for (int32_t x = 0; x < MASK_TILE_WIDTH; x++) {
+                    auto dest_coverage = (fetch_clamped(*src, dest_origin + Vec2I(x, y)) + dest_backdrop).abs();
+                    auto src_coverage = (fetch_clamped(*src, src_origin + Vec2I(x, y)) + src_backdrop).abs();
+
+                    store_texel(*draw.target, dest_origin + Vec2I(x, y), dest_coverage.min(src_coverage));
+                }
+            }
+        }
+    }
+};
+
+} // namespace
+
+void register_cpu_programs_d3d9(DeviceCpu &device) {
+    device.register_render_program("fill pipeline", std::make_shared<FillProgram>());
+    device.register_render_program("tile pipeline", std::make_shared<TileProgram>());
+    device.register_render_program("tile clip copy pipeline", std::make_shared<TileClipCopyProgram>());
+    device.register_render_program("tile clip combine pipeline", std::make_shared<TileClipCombineProgram>());
+}
+
+} // namespace Pathfinder
+
+#endif
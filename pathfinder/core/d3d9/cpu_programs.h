@@ -0,0 +1,17 @@
+#pragma once
+
+#ifdef PATHFINDER_USE_CPU
+
+namespace Pathfinder {
+
+class DeviceCpu;
+
+/// Register the CPU versions of the D3D9 shaders to a CPU device, so that it can run the hybrid pipeline.
+///
+/// Each program mirrors the vertex and fragment shaders of its pipeline in `shaders/d3d9`, down to their quirks,
+/// so that the output matches the GPU's within rounding. Alpha tiles and screen bands are spread over threads.
+void register_cpu_programs_d3d9(DeviceCpu &device);
+
+} // namespace Pathfinder
+
+#endif
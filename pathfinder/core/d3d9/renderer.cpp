@@ -8,6 +8,11 @@
 #include "../../gpu/device.h"
 #include "../../gpu/window.h"
 #include "../paint/palette.h"
+#include "cpu_programs.h"
+
+#ifdef PATHFINDER_USE_CPU
+    #include "../../gpu/cpu/device.h"
+#endif
 
 /* clang-format off */
 #include "../../shaders/generated/fill_frag_shdbin.h"
@@ -32,34 +37,39 @@ constexpr size_t CLIP_TILE_INSTANCE_SIZE = 16;
 // 65536
 constexpr size_t MAX_FILLS_PER_BATCH = 0x10000;
 
-constexpr uint32_t DEFAULT_TILE_BATCH_COUNT = 10;
+// Initial size of the per-frame instance region. Grows when a frame needs more.
+constexpr size_t INSTANCE_RING_BUFFER_BLOCK_SIZE = 1024 * 1024;
 
-RendererD3D9::RendererD3D9(const std::shared_ptr<Device> &_device, const std::shared_ptr<Queue> &_queue)
-    : Renderer(_device, _queue) {
-    mask_render_pass_clear =
-        device->create_render_pass(TextureFormat::Rgba16Float, AttachmentLoadOp::Clear, "mask render pass clear");
+RendererD3D9::RendererD3D9(const std::shared_ptr<RendererContext> &_context) : Renderer(_context) {
+    mask_render_pass_clear = context->get_or_create_render_pass(TextureFormat::Rgba16Float,
+                                                                AttachmentLoadOp::Clear,
+                                                                "mask render pass clear");
 
     mask_render_pass_load =
-        device->create_render_pass(TextureFormat::Rgba16Float, AttachmentLoadOp::Load, "mask render pass load");
+        context->get_or_create_render_pass(TextureFormat::Rgba16Float, AttachmentLoadOp::Load, "mask render pass load");
 
-    dest_render_pass_clear =
-        device->create_render_pass(TextureFormat::Rgba8Unorm, AttachmentLoadOp::Clear, "dest render pass clear");
+    dest_render_pass_clear = context->get_or_create_render_pass(TextureFormat::Rgba8Unorm,
+                                                                AttachmentLoadOp::Clear,
+                                                                "dest render pass clear");
 
     dest_render_pass_load =
-        device->create_render_pass(TextureFormat::Rgba8Unorm, AttachmentLoadOp::Load, "dest render pass load");
-
-    auto quad_vertex_data_size = sizeof(QUAD_VERTEX_POSITIONS);
+        context->get_or_create_render_pass(TextureFormat::Rgba8Unorm, AttachmentLoadOp::Load, "dest render pass load");
 
     // Quad vertex buffer. Shared by fills and tiles drawing.
-    quad_vertex_buffer_id = allocator->allocate_buffer(quad_vertex_data_size, BufferType::Vertex, "quad vertex buffer");
+    quad_vertex_buffer_id = context->get_or_create_static_buffer("quad vertex buffer",
+                                                                 BufferType::Vertex,
+                                                                 sizeof(QUAD_VERTEX_POSITIONS),
+                                                                 QUAD_VERTEX_POSITIONS);
 
-    auto encoder = device->create_command_encoder("upload quad vertex data");
-    encoder->write_buffer(allocator->get_buffer(quad_vertex_buffer_id),
-                          0,
-                          quad_vertex_data_size,
-                          QUAD_VERTEX_POSITIONS);
+    instance_ring_buffer = std::make_shared<RingBuffer>(
+        device, BufferType::Vertex, INSTANCE_RING_BUFFER_BLOCK_SIZE, "instance ring buffer");
+}
 
-    queue->submit(encoder, nullptr);
+RendererD3D9::~RendererD3D9() {
+    // Allocated by set_up_pipelines().
+    if (fill_pipeline) {
+        allocator->free_buffer_range(fill_ub_id);
+    }
 }
 
 void RendererD3D9::set_dest_texture(const std::shared_ptr<Texture> &texture) {
@@ -71,41 +81,6 @@ std::shared_ptr<Texture> RendererD3D9::get_dest_texture() {
     return dest_texture;
 }
 
-void RendererD3D9::update_tile_batch_storage(uint32_t new_tile_batch_count) {
-    if (new_tile_batch_count <= tile_batch_storage_count) {
-        return;
-    }
-
-    uint64_t old_tile_ub_id = tile_ub_id;
-
-    // Create a new uniform buffer.
-    tile_ub_id =
-        allocator->allocate_buffer(new_tile_batch_count * device->get_aligned_uniform_size(sizeof(TileUniformD3d9)),
-                                   BufferType::Uniform,
-                                   "tile uniform buffer");
-
-    for (uint32_t i = tile_batch_storage_count; i < new_tile_batch_count; i++) {
-        // Set descriptor set.
-        auto tile_descriptor_set = device->create_descriptor_set(tile_descriptor_set_layout_);
-        // We will update binding 2 (uniform) in draw_tiles() anyway,
-        // but let's initialize it with the current buffer here.
-        tile_descriptor_set->add_or_update({
-            Descriptor::uniform(2, allocator->get_buffer(tile_ub_id)),
-            // Unused binding.
-            Descriptor::sampled(5, allocator->get_texture(dummy_texture_id), get_default_sampler()),
-            // Unused binding.
-            Descriptor::sampled(6, allocator->get_texture(dummy_texture_id), get_default_sampler()),
-        });
-        tile_descriptor_sets.push_back(tile_descriptor_set);
-    }
-
-    if (tile_batch_storage_count > 0) {
-        allocator->free_buffer(old_tile_ub_id);
-    }
-
-    tile_batch_storage_count = new_tile_batch_count;
-}
-
 void RendererD3D9::set_up_pipelines() {
     // Fill pipeline.
     {
@@ -126,7 +101,8 @@ void RendererD3D9::set_up_pipelines() {
                 {1, 1, DataType::u32, stride, offsetof(Fill, link), VertexInputRate::Instance});
         }
 
-        fill_ub_id = allocator->allocate_buffer(sizeof(FillUniformD3d9), BufferType::Uniform, "fill uniform buffer");
+        fill_ub_id =
+            allocator->allocate_buffer_range(sizeof(FillUniformD3d9), BufferType::Uniform, "fill uniform buffer");
 
         {
             std::vector<DescriptorLayout> layouts = {
@@ -134,28 +110,30 @@ void RendererD3D9::set_up_pipelines() {
                 DescriptorLayout{1, ShaderStage::Fragment, DescriptorType::Sampler},
             };
 
-            fill_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+            fill_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
         }
 
         fill_descriptor_set = device->create_descriptor_set(fill_descriptor_set_layout_);
         fill_descriptor_set->add_or_update({
-            Descriptor::uniform(0, allocator->get_buffer(fill_ub_id)),
+            Descriptor::uniform(0, allocator->get_buffer_range(fill_ub_id)),
             Descriptor::sampled(1, allocator->get_texture(area_lut_texture_id), get_default_sampler()),
         });
 
-        auto fill_vert_shader = Shader::create_from_shdbin(fill_vert_shdbin, sizeof(fill_vert_shdbin));
-        auto fill_frag_shader = Shader::create_from_shdbin(fill_frag_shdbin, sizeof(fill_frag_shdbin));
+        fill_pipeline = context->get_or_create_render_pipeline("fill pipeline", [&] {
+            auto fill_vert_shader = Shader::create_from_shdbin(fill_vert_shdbin, sizeof(fill_vert_shdbin));
+            auto fill_frag_shader = Shader::create_from_shdbin(fill_frag_shdbin, sizeof(fill_frag_shdbin));
 
-        auto fill_vert_shader_module = device->create_shader_module(fill_vert_shader, "fill vert");
-        auto fill_frag_shader_module = device->create_shader_module(fill_frag_shader, "fill frag");
+            auto fill_vert_shader_module = device->create_shader_module(fill_vert_shader, "fill vert");
+            auto fill_frag_shader_module = device->create_shader_module(fill_frag_shader, "fill frag");
 
-        fill_pipeline = device->create_render_pipeline(fill_vert_shader_module,
-                                                       fill_frag_shader_module,
-                                                       attribute_descriptions,
-                                                       BlendState::from_equal(),
-                                                       fill_descriptor_set_layout_,
-                                                       mask_texture_format(),
-                                                       "fill pipeline");
+            return device->create_render_pipeline(fill_vert_shader_module,
+                                                  fill_frag_shader_module,
+                                                  attribute_descriptions,
+                                                  BlendState::from_equal(),
+                                                  fill_descriptor_set_layout_,
+                                                  mask_texture_format(),
+                                                  "fill pipeline");
+        });
     }
 
     // Tile pipeline.
@@ -185,43 +163,49 @@ void RendererD3D9::set_up_pipelines() {
             std::vector<DescriptorLayout> layouts = {
                 DescriptorLayout{0, ShaderStage::Vertex, DescriptorType::Sampler},
                 DescriptorLayout{1, ShaderStage::Vertex, DescriptorType::Sampler},
-                DescriptorLayout{2, ShaderStage::VertexAndFragment, DescriptorType::UniformBuffer},
+                DescriptorLayout::push_constant(2, ShaderStage::VertexAndFragment, sizeof(TileUniformD3d9)),
                 DescriptorLayout{3, ShaderStage::Fragment, DescriptorType::Sampler},
                 DescriptorLayout{4, ShaderStage::Fragment, DescriptorType::Sampler},
                 DescriptorLayout{5, ShaderStage::Fragment, DescriptorType::Sampler},
                 DescriptorLayout{6, ShaderStage::Fragment, DescriptorType::Sampler},
             };
 
-            tile_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+            tile_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
         }
 
-        update_tile_batch_storage(DEFAULT_TILE_BATCH_COUNT);
-
-        auto tile_vert_shader = Shader::create_from_shdbin(tile_vert_shdbin, sizeof(tile_vert_shdbin));
-        auto tile_frag_shader = Shader::create_from_shdbin(tile_frag_shdbin, sizeof(tile_frag_shdbin));
+        tile_pipeline = context->get_or_create_render_pipeline("tile pipeline", [&] {
+            auto tile_vert_shader = Shader::create_from_shdbin(tile_vert_shdbin, sizeof(tile_vert_shdbin));
+            auto tile_frag_shader = Shader::create_from_shdbin(tile_frag_shdbin, sizeof(tile_frag_shdbin));
 
-        auto tile_vert_shader_module = device->create_shader_module(tile_vert_shader, "tile vert");
-        auto tile_frag_shader_module = device->create_shader_module(tile_frag_shader, "tile frag");
+            auto tile_vert_shader_module = device->create_shader_module(tile_vert_shader, "tile vert");
+            auto tile_frag_shader_module = device->create_shader_module(tile_frag_shader, "tile frag");
 
-        tile_pipeline = device->create_render_pipeline(tile_vert_shader_module,
-                                                       tile_frag_shader_module,
-                                                       attribute_descriptions,
-                                                       BlendState::from_over(),
-                                                       tile_descriptor_set_layout_,
-                                                       TextureFormat::Rgba8Unorm,
-                                                       "tile pipeline");
+            return device->create_render_pipeline(tile_vert_shader_module,
+                                                  tile_frag_shader_module,
+                                                  attribute_descriptions,
+                                                  BlendState::from_over(),
+                                                  tile_descriptor_set_layout_,
+                                                  TextureFormat::Rgba8Unorm,
+                                                  "tile pipeline");
+        });
     }
 
     create_tile_clip_copy_pipeline();
 
     create_tile_clip_combine_pipeline();
+
+#ifdef PATHFINDER_USE_CPU
+    // The software device runs the pipelines with CPU versions of the shaders.
+    if (device->get_backend_type() == BackendType::Cpu) {
+        register_cpu_programs_d3d9(*static_cast<DeviceCpu *>(device.get()));
+    }
+#endif
 }
 
 TextureFormat RendererD3D9::mask_texture_format() const {
     return TextureFormat::Rgba16Float;
 }
 
-// todo: should handle descriptor set caching during multiple draws per frame (because bound mask texture changes)
 void RendererD3D9::reallocate_alpha_tile_pages_if_necessary() {
     // Make sure at least one page is allocated even when there's no alpha tile.
     // Because we use `*mask_storage.framebuffer_id` in several places.
@@ -265,29 +249,31 @@ void RendererD3D9::create_tile_clip_copy_pipeline() {
             DescriptorLayout{1, ShaderStage::Fragment, DescriptorType::Sampler},
         };
 
-        tile_clip_copy_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        tile_clip_copy_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
     // Create descriptor set.
     tile_clip_copy_descriptor_set = device->create_descriptor_set(tile_clip_copy_descriptor_set_layout_);
     tile_clip_copy_descriptor_set->add_or_update({
-        Descriptor::uniform(0, allocator->get_buffer(fill_ub_id)),
+        Descriptor::uniform(0, allocator->get_buffer_range(fill_ub_id)),
     });
 
-    auto vert_shader = Shader::create_from_shdbin(tile_clip_copy_vert_shdbin, sizeof(tile_clip_copy_vert_shdbin));
-    auto frag_shader = Shader::create_from_shdbin(tile_clip_copy_frag_shdbin, sizeof(tile_clip_copy_frag_shdbin));
-
-    auto vert_shader_module = device->create_shader_module(vert_shader, "tile clip copy vert");
-    auto frag_shader_module = device->create_shader_module(frag_shader, "tile clip copy frag");
-
-    // We have to disable blend for tile clip copy.
-    tile_clip_copy_pipeline = device->create_render_pipeline(vert_shader_module,
-                                                             frag_shader_module,
-                                                             attribute_descriptions,
-                                                             {false},
-                                                             tile_clip_copy_descriptor_set_layout_,
-                                                             mask_texture_format(),
-                                                             "tile clip copy pipeline");
+    tile_clip_copy_pipeline = context->get_or_create_render_pipeline("tile clip copy pipeline", [&] {
+        auto vert_shader = Shader::create_from_shdbin(tile_clip_copy_vert_shdbin, sizeof(tile_clip_copy_vert_shdbin));
+        auto frag_shader = Shader::create_from_shdbin(tile_clip_copy_frag_shdbin, sizeof(tile_clip_copy_frag_shdbin));
+
+        auto vert_shader_module = device->create_shader_module(vert_shader, "tile clip copy vert");
+        auto frag_shader_module = device->create_shader_module(frag_shader, "tile clip copy frag");
+
+        // We have to disable blend for tile clip copy.
+        return device->create_render_pipeline(vert_shader_module,
+                                              frag_shader_module,
+                                              attribute_descriptions,
+                                              {false},
+                                              tile_clip_copy_descriptor_set_layout_,
+                                              mask_texture_format(),
+                                              "tile clip copy pipeline");
+    });
 }
 
 void RendererD3D9::create_tile_clip_combine_pipeline() {
@@ -314,29 +300,33 @@ void RendererD3D9::create_tile_clip_combine_pipeline() {
             DescriptorLayout{1, ShaderStage::Fragment, DescriptorType::Sampler},
         };
 
-        tile_clip_combine_descriptor_set_layout_ = device->create_descriptor_set_layout(layouts);
+        tile_clip_combine_descriptor_set_layout_ = context->get_or_create_descriptor_set_layout(layouts);
     }
 
     // Create descriptor set.
     tile_clip_combine_descriptor_set = device->create_descriptor_set(tile_clip_combine_descriptor_set_layout_);
     tile_clip_combine_descriptor_set->add_or_update({
-        Descriptor::uniform(0, allocator->get_buffer(fill_ub_id)),
+        Descriptor::uniform(0, allocator->get_buffer_range(fill_ub_id)),
     });
 
-    auto vert_shader = Shader::create_from_shdbin(tile_clip_combine_vert_shdbin, sizeof(tile_clip_combine_vert_shdbin));
-    auto frag_shader = Shader::create_from_shdbin(tile_clip_combine_frag_shdbin, sizeof(tile_clip_combine_frag_shdbin));
-
-    auto vert_shader_module = device->create_shader_module(vert_shader, "tile clip combine vert");
-    auto frag_shader_module = device->create_shader_module(frag_shader, "tile clip combine frag");
-
-    // We have to disable blend for tile clip combine.
-    tile_clip_combine_pipeline = device->create_render_pipeline(vert_shader_module,
-                                                                frag_shader_module,
-                                                                attribute_descriptions,
-                                                                {false},
-                                                                tile_clip_combine_descriptor_set_layout_,
-                                                                mask_texture_format(),
-                                                                "tile clip combine pipeline");
+    tile_clip_combine_pipeline = context->get_or_create_render_pipeline("tile clip combine pipeline", [&] {
+        auto vert_shader =
+            Shader::create_from_shdbin(tile_clip_combine_vert_shdbin, sizeof(tile_clip_combine_vert_shdbin));
+        auto frag_shader =
+            Shader::create_from_shdbin(tile_clip_combine_frag_shdbin, sizeof(tile_clip_combine_frag_shdbin));
+
+        auto vert_shader_module = device->create_shader_module(vert_shader, "tile clip combine vert");
+        auto frag_shader_module = device->create_shader_module(frag_shader, "tile clip combine frag");
+
+        // We have to disable blend for tile clip combine.
+        return device->create_render_pipeline(vert_shader_module,
+                                              frag_shader_module,
+                                              attribute_descriptions,
+                                              {false},
+                                              tile_clip_combine_descriptor_set_layout_,
+                                              mask_texture_format(),
+                                              "tile clip combine pipeline");
+    });
 }
 
 void RendererD3D9::draw(const std::shared_ptr<SceneBuilder> &_scene_builder, bool _clear_dst_texture) {
@@ -359,248 +349,209 @@ void RendererD3D9::draw(const std::shared_ptr<SceneBuilder> &_scene_builder, boo
     uint32_t current_frame_index = device->get_current_frame_index();
     if (current_frame_index != last_frame_index) {
         allocator->begin_frame();
-        tile_batch_idx = 0;
+        instance_ring_buffer->begin_frame(current_frame_index);
         last_frame_index = current_frame_index;
     }
 
-    auto encoder = device->create_command_encoder("upload & draw fills, tiles");
-
-    uint64_t *fill_vertex_buffer_id = nullptr;
+    if (gpu_profiler) {
+        gpu_profiler->begin_frame();
+    }
 
     // No fills to draw.
     if (!scene_builder->pending_fills.empty()) {
         // Upload fills to buffer.
-        fill_vertex_buffer_id = new uint64_t;
-        *fill_vertex_buffer_id = upload_fills(scene_builder->pending_fills, encoder);
+        auto fill_vertex_buffer = upload_fills(scene_builder->pending_fills);
 
         // We can do fill drawing as soon as the fill vertex buffer is ready.
-        draw_fills(*fill_vertex_buffer_id, scene_builder->pending_fills.size(), encoder);
-    }
-
-    upload_and_draw_tiles(scene_builder->tile_batches, encoder);
-
-    queue->submit(encoder, nullptr);
-
-    // Clean up.
-    if (fill_vertex_buffer_id) {
-        allocator->free_buffer(*fill_vertex_buffer_id);
+        draw_fills(fill_vertex_buffer, scene_builder->pending_fills.size());
     }
 
-    for (auto tile_vertex_buffer_id : tile_vertex_buffer_ids) {
-        allocator->free_buffer(tile_vertex_buffer_id);
-    }
-    tile_vertex_buffer_ids.clear();
+    upload_and_draw_tiles(scene_builder->tile_batches);
 
-    for (auto z_buffer_texture_id : z_buffer_texture_ids) {
-        allocator->free_texture(z_buffer_texture_id);
-    }
-    z_buffer_texture_ids.clear();
+    // Instance data lives in the ring buffer and is reclaimed when the frame comes around again.
+    // Transient textures are released by the render graph.
+    auto encoder = device->create_command_encoder("upload & draw fills, tiles");
 
-    for (auto clip_buffer_info : clip_buffer_infos) {
-        allocator->free_buffer(clip_buffer_info.clip_buffer_id);
-    }
-    clip_buffer_infos.clear();
+    render_graph->execute(encoder, gpu_profiler.get());
 
-    if (temp_mask_texture_id) {
-        allocator->free_texture(*temp_mask_texture_id);
-        temp_mask_texture_id = nullptr;
-    }
+    queue->submit(encoder, nullptr);
 }
 
-uint64_t RendererD3D9::upload_fills(const std::vector<Fill> &fills,
-                                    const std::shared_ptr<CommandEncoder> &encoder) const {
+StagingAllocation RendererD3D9::upload_fills(const std::vector<Fill> &fills) const {
     auto byte_size = sizeof(Fill) * fills.size();
 
-    auto fill_vertex_buffer_id = allocator->allocate_buffer(byte_size, BufferType::Vertex, "fill vertex buffer");
-
-    allocator->get_buffer(fill_vertex_buffer_id)->upload_via_mapping(byte_size, 0, fills.data());
-
-    return fill_vertex_buffer_id;
+    return instance_ring_buffer->upload(byte_size, fills.data());
 }
 
-uint64_t RendererD3D9::upload_z_buffer(const DenseTileMap<uint32_t> &z_buffer_map,
-                                       const std::shared_ptr<CommandEncoder> &encoder) const {
+RenderGraphResource RendererD3D9::upload_z_buffer(const DenseTileMap<uint32_t> &z_buffer_map) const {
     // Prepare the Z buffer texture.
     // Its size is always the same as the dst framebuffer size.
     // Its size should depend on the batch's dst framebuffer, but it's easier to cache it this way.
-    auto z_buffer_texture_id =
-        allocator->allocate_texture(z_buffer_map.rect.size(), TextureFormat::Rgba8Unorm, "z buffer texture");
+    auto z_buffer_texture =
+        render_graph->create_texture(z_buffer_map.rect.size(), TextureFormat::Rgba8Unorm, "z buffer texture");
 
-    auto z_buffer_texture = allocator->get_texture(z_buffer_texture_id);
-    encoder->write_texture(z_buffer_texture, {}, z_buffer_map.data.data());
+    // The batch data outlives the render graph execution in draw().
+    const auto *z_buffer_data = z_buffer_map.data.data();
 
-    return z_buffer_texture_id;
+    render_graph->add_pass("upload z buffer",
+                           {},
+                           {z_buffer_texture},
+                           [this, z_buffer_texture, z_buffer_data](const std::shared_ptr<CommandEncoder> &encoder) {
+                               encoder->write_texture(render_graph->get_texture(z_buffer_texture), {}, z_buffer_data);
+                           });
+
+    return z_buffer_texture;
 }
 
-uint64_t RendererD3D9::upload_tiles(const std::vector<TileObjectPrimitive> &tiles,
-                                    const std::shared_ptr<CommandEncoder> &encoder) const {
+StagingAllocation RendererD3D9::upload_tiles(const std::vector<TileObjectPrimitive> &tiles) const {
     auto byte_size = sizeof(TileObjectPrimitive) * tiles.size();
 
-    auto tile_vertex_buffer_id = allocator->allocate_buffer(byte_size, BufferType::Vertex, "tile vertex buffer");
-
-    allocator->get_buffer(tile_vertex_buffer_id)->upload_via_mapping(byte_size, 0, tiles.data());
-
-    return tile_vertex_buffer_id;
+    return instance_ring_buffer->upload(byte_size, tiles.data());
 }
 
-void RendererD3D9::upload_and_draw_tiles(const std::vector<DrawTileBatchD3D9> &tile_batches,
-                                         const std::shared_ptr<CommandEncoder> &encoder) {
+void RendererD3D9::upload_and_draw_tiles(const std::vector<DrawTileBatchD3D9> &tile_batches) {
     if (tile_batches.empty()) {
         if (clear_dest_texture) {
-            encoder->begin_render_pass(dest_render_pass_clear, dest_texture, ColorF());
-            encoder->end_render_pass();
+            render_graph->add_render_pass("clear dest texture",
+                                          dest_render_pass_clear,
+                                          render_graph->import_texture(dest_texture),
+                                          nullptr,
+                                          {},
+                                          nullptr);
             clear_dest_texture = false;
         }
         return;
     }
 
-    if (tile_batch_idx + tile_batches.size() > tile_batch_storage_count) {
-        update_tile_batch_storage(tile_batch_idx + tile_batches.size());
-    }
-
-    // One draw call for each batch.
+    // Clips of different batches write to the mask tiles of their own paths, so they can be applied
+    // for all batches at once, before any tiles are drawn. This saves a pair of mask passes per clipped batch.
+    std::vector<Clip> clips;
     for (const auto &batch : tile_batches) {
-        uint32_t tile_count = batch.tiles.size();
-
-        // Apply clip paths.
-        if (!batch.clips.empty() && tile_count > 0) {
-            auto clip_buffer_info = upload_clip_tiles(batch.clips, encoder);
-            clip_tiles(clip_buffer_info, encoder);
-
-            clip_buffer_infos.push_back(clip_buffer_info);
+        if (!batch.tiles.empty()) {
+            clips.insert(clips.end(), batch.clips.begin(), batch.clips.end());
         }
+    }
 
-        uint64_t tile_vertex_buffer_id = 0;
-        uint64_t z_buffer_texture_id = 0;
-
-        if (tile_count > 0) {
-            tile_vertex_buffer_id = upload_tiles(batch.tiles, encoder);
-            tile_vertex_buffer_ids.push_back(tile_vertex_buffer_id);
+    if (!clips.empty()) {
+        auto clip_buffer_info = upload_clip_tiles(clips);
+        clip_tiles(clip_buffer_info);
+    }
 
-            z_buffer_texture_id = upload_z_buffer(batch.z_buffer_data, encoder);
-            z_buffer_texture_ids.push_back(z_buffer_texture_id);
+    // One draw call for each batch.
+    for (const auto &batch : tile_batches) {
+        StagingAllocation tile_vertex_buffer;
+        if (!batch.tiles.empty()) {
+            tile_vertex_buffer = upload_tiles(batch.tiles);
         }
 
-        draw_tiles(tile_vertex_buffer_id,
-                   tile_count,
+        draw_tiles(tile_vertex_buffer,
+                   batch.tiles.size(),
                    batch.render_target_id,
                    batch.color_texture_info,
-                   z_buffer_texture_id,
-                   encoder,
-                   tile_descriptor_sets[tile_batch_idx],
-                   tile_batch_idx * device->get_aligned_uniform_size(sizeof(TileUniformD3d9)));
-
-        tile_batch_idx++;
+                   batch.z_buffer_data);
     }
 }
 
-void RendererD3D9::draw_fills(uint64_t fill_vertex_buffer_id,
-                              uint32_t fills_count,
-                              const std::shared_ptr<CommandEncoder> &encoder) const {
+void RendererD3D9::draw_fills(const StagingAllocation &fill_vertex_buffer, uint32_t fills_count) const {
     FillUniformD3d9 fill_uniform;
     fill_uniform.tile_size = {TILE_WIDTH, TILE_HEIGHT};
     fill_uniform.framebuffer_size = {MASK_FRAMEBUFFER_WIDTH,
                                      (float)(MASK_FRAMEBUFFER_HEIGHT * mask_storage.allocated_page_count)};
 
-    allocator->get_buffer(fill_ub_id)->upload_via_mapping(sizeof(FillUniformD3d9), 0, &fill_uniform);
-
-    encoder->begin_render_pass(mask_render_pass_clear, allocator->get_texture(*mask_storage.texture_id), ColorF());
-
-    encoder->set_viewport({{0, 0}, fill_uniform.framebuffer_size.to_i32()});
-
-    encoder->bind_render_pipeline(fill_pipeline);
+    auto fill_ub_range = allocator->get_buffer_range(fill_ub_id);
+    fill_ub_range.buffer->upload_via_mapping(sizeof(FillUniformD3d9), fill_ub_range.offset, &fill_uniform);
 
-    encoder->bind_vertex_buffers(
-        {{allocator->get_buffer(quad_vertex_buffer_id), 0}, {allocator->get_buffer(fill_vertex_buffer_id), 0}});
+    auto quad_vertex_buffer = allocator->get_buffer(quad_vertex_buffer_id);
 
-    encoder->bind_descriptor_set(fill_descriptor_set);
+    render_graph->add_render_pass(
+        "draw fills",
+        mask_render_pass_clear,
+        render_graph->import_texture(allocator->get_texture(*mask_storage.texture_id)),
+        fill_pipeline,
+        {},
+        [this, quad_vertex_buffer, fill_vertex_buffer, fills_count](const std::shared_ptr<CommandEncoder> &encoder) {
+            encoder->bind_vertex_buffers(
+                {{quad_vertex_buffer, 0}, {fill_vertex_buffer.buffer, fill_vertex_buffer.offset}});
 
-    encoder->draw_instanced(6, fills_count);
+            encoder->bind_descriptor_set(fill_descriptor_set);
 
-    encoder->end_render_pass();
+            encoder->draw_instanced(6, fills_count);
+        });
 }
 
 // Uploads clip tiles from CPU to GPU.
-ClipBufferInfo RendererD3D9::upload_clip_tiles(const std::vector<Clip> &clips,
-                                               const std::shared_ptr<CommandEncoder> &encoder) const {
+ClipBufferInfo RendererD3D9::upload_clip_tiles(const std::vector<Clip> &clips) const {
     uint32_t clip_count = clips.size();
 
     auto byte_size = sizeof(Clip) * clip_count;
 
-    auto clip_buffer_id = allocator->allocate_buffer(byte_size, BufferType::Vertex, "clip buffer");
-
-    allocator->get_buffer(clip_buffer_id)->upload_via_mapping(byte_size, 0, clips.data());
-
-    return {clip_buffer_id, clip_count};
+    return {instance_ring_buffer->upload(byte_size, clips.data()), clip_count};
 }
 
-void RendererD3D9::clip_tiles(const ClipBufferInfo &clip_buffer_info, const std::shared_ptr<CommandEncoder> &encoder) {
-    // A temporary mask framebuffer for clipping.
-    if (!temp_mask_texture_id) {
-        temp_mask_texture_id = std::make_shared<uint64_t>();
-        *temp_mask_texture_id = allocator->allocate_texture(
-            Vec2I(MASK_FRAMEBUFFER_WIDTH, MASK_FRAMEBUFFER_HEIGHT * mask_storage.allocated_page_count),
-            TextureFormat::Rgba16Float,
-            "temp mask texture");
-    }
+void RendererD3D9::clip_tiles(const ClipBufferInfo &clip_buffer_info) {
+    auto mask_texture = allocator->get_texture(*mask_storage.texture_id);
+    auto mask = render_graph->import_texture(mask_texture);
 
-    auto temp_mask_texture = allocator->get_texture(*temp_mask_texture_id);
+    // A temporary mask framebuffer for clipping.
+    auto temp_mask = render_graph->create_texture(
+        Vec2I(MASK_FRAMEBUFFER_WIDTH, MASK_FRAMEBUFFER_HEIGHT * mask_storage.allocated_page_count),
+        TextureFormat::Rgba16Float,
+        "temp mask texture");
 
-    auto clip_vertex_buffer = allocator->get_buffer(clip_buffer_info.clip_buffer_id);
+    auto quad_vertex_buffer = allocator->get_buffer(quad_vertex_buffer_id);
+    auto clip_vertex_buffer = clip_buffer_info.clip_buffer;
+    auto clip_count = clip_buffer_info.clip_count;
 
     tile_clip_copy_descriptor_set->add_or_update({
-        Descriptor::sampled(1, allocator->get_texture(*mask_storage.texture_id), get_default_sampler()),
+        Descriptor::sampled(1, mask_texture, get_default_sampler()),
     });
 
     // Copy out tiles.
     // TODO(pcwalton): Don't do this on GL4.
-    {
-        encoder->begin_render_pass(mask_render_pass_clear, temp_mask_texture, ColorF());
-
-        encoder->set_viewport({{0, 0}, temp_mask_texture->get_size()});
-
-        encoder->bind_render_pipeline(tile_clip_copy_pipeline);
-
-        encoder->bind_vertex_buffers({{allocator->get_buffer(quad_vertex_buffer_id), 0}, {clip_vertex_buffer, 0}});
-
-        encoder->bind_descriptor_set(tile_clip_copy_descriptor_set);
-
-        // Each clip introduces two instances.
-        encoder->draw_instanced(6, clip_buffer_info.clip_count * 2);
-
-        encoder->end_render_pass();
-    }
+    render_graph->add_render_pass(
+        "clip tiles",
+        mask_render_pass_clear,
+        temp_mask,
+        tile_clip_copy_pipeline,
+        {mask},
+        [this, quad_vertex_buffer, clip_vertex_buffer, clip_count](const std::shared_ptr<CommandEncoder> &encoder) {
+            encoder->bind_vertex_buffers(
+                {{quad_vertex_buffer, 0}, {clip_vertex_buffer.buffer, clip_vertex_buffer.offset}});
+
+            encoder->bind_descriptor_set(tile_clip_copy_descriptor_set);
+
+            // Each clip introduces two instances.
+            encoder->draw_instanced(6, clip_count * 2);
+        });
 
     // Combine clip tiles.
-    {
-        tile_clip_combine_descriptor_set->add_or_update({
-            Descriptor::sampled(1, temp_mask_texture, get_default_sampler()),
+    render_graph->add_render_pass(
+        "clip tiles",
+        mask_render_pass_load,
+        mask,
+        tile_clip_combine_pipeline,
+        {temp_mask},
+        [this, temp_mask, quad_vertex_buffer, clip_vertex_buffer, clip_count](
+            const std::shared_ptr<CommandEncoder> &encoder) {
+            // The temp mask texture is only allocated while the graph is executed.
+            tile_clip_combine_descriptor_set->add_or_update({
+                Descriptor::sampled(1, render_graph->get_texture(temp_mask), get_default_sampler()),
+            });
+
+            encoder->bind_vertex_buffers(
+                {{quad_vertex_buffer, 0}, {clip_vertex_buffer.buffer, clip_vertex_buffer.offset}});
+
+            encoder->bind_descriptor_set(tile_clip_combine_descriptor_set);
+
+            encoder->draw_instanced(6, clip_count);
         });
-
-        encoder->begin_render_pass(mask_render_pass_load, allocator->get_texture(*mask_storage.texture_id), ColorF());
-
-        encoder->set_viewport({{0, 0}, temp_mask_texture->get_size()});
-
-        encoder->bind_render_pipeline(tile_clip_combine_pipeline);
-
-        encoder->bind_vertex_buffers({{allocator->get_buffer(quad_vertex_buffer_id), 0}, {clip_vertex_buffer, 0}});
-
-        encoder->bind_descriptor_set(tile_clip_combine_descriptor_set);
-
-        encoder->draw_instanced(6, clip_buffer_info.clip_count);
-
-        encoder->end_render_pass();
-    }
 }
 
-void RendererD3D9::draw_tiles(uint64_t tile_vertex_buffer_id,
+void RendererD3D9::draw_tiles(const StagingAllocation &tile_vertex_buffer,
                               uint32_t tiles_count,
                               const std::shared_ptr<const RenderTargetId> &render_target_id,
                               const std::shared_ptr<const TileBatchTextureInfo> &color_texture_info,
-                              uint64_t z_buffer_texture_id,
-                              const std::shared_ptr<CommandEncoder> &encoder,
-                              const std::shared_ptr<DescriptorSet> &tile_descriptor_set,
-                              uint64_t tile_uniform_offset) {
+                              const DenseTileMap<uint32_t> &z_buffer_map) {
     std::shared_ptr<Texture> target_texture;
     std::shared_ptr<RenderPass> render_pass;
 
@@ -623,23 +574,23 @@ void RendererD3D9::draw_tiles(uint64_t tile_vertex_buffer_id,
         target_texture = render_target.texture;
     }
 
-    Vec2F target_texture_size = target_texture->get_size().to_f32();
+    auto target = render_graph->import_texture(target_texture);
 
     if (tiles_count == 0) {
-        encoder->begin_render_pass(render_pass, target_texture, ColorF());
-        encoder->end_render_pass();
+        render_graph->add_render_pass("draw tiles", render_pass, target, tile_pipeline, {}, nullptr);
         return;
     }
 
-    auto z_buffer_texture = allocator->get_texture(z_buffer_texture_id);
+    Vec2F target_texture_size = target_texture->get_size().to_f32();
+
     auto color_texture = allocator->get_texture(dummy_texture_id);
 
     auto default_sampler = get_default_sampler();
     auto color_texture_sampler = default_sampler;
 
-    // Update uniform buffers.
+    // Pushed along with the draw.
+    TileUniformD3d9 tile_uniform;
     {
-        TileUniformD3d9 tile_uniform;
         tile_uniform.tile_size = {TILE_WIDTH, TILE_HEIGHT};
         tile_uniform.texture_metadata_size = {TEXTURE_METADATA_TEXTURE_WIDTH, TEXTURE_METADATA_TEXTURE_HEIGHT};
         tile_uniform.mask_texture_size = {MASK_FRAMEBUFFER_WIDTH,
@@ -652,7 +603,7 @@ void RendererD3D9::draw_tiles(uint64_t tile_vertex_buffer_id,
         tile_uniform.transform = model_mat;
 
         tile_uniform.framebuffer_size = target_texture_size.to_f32();
-        tile_uniform.z_buffer_size = z_buffer_texture->get_size().to_f32();
+        tile_uniform.z_buffer_size = z_buffer_map.rect.size().to_f32();
 
         if (color_texture_info) {
             if (color_texture_info->raw_texture.expired()) {
@@ -673,36 +624,51 @@ void RendererD3D9::draw_tiles(uint64_t tile_vertex_buffer_id,
         }
 
         tile_uniform.color_texture_size = color_texture->get_size().to_f32();
-
-        // We don't need to preserve the data until the upload commands are implemented because
-        // these uniform buffers are host-visible/coherent.
-        allocator->get_buffer(tile_ub_id)
-            ->upload_via_mapping(sizeof(TileUniformD3d9), tile_uniform_offset, &tile_uniform);
     }
 
-    // Update descriptor set.
-    tile_descriptor_set->add_or_update({
-        Descriptor::sampled(0, allocator->get_texture(metadata_texture_id), default_sampler),
-        Descriptor::sampled(1, z_buffer_texture, default_sampler),
-        Descriptor::uniform(2, allocator->get_buffer(tile_ub_id), tile_uniform_offset, sizeof(TileUniformD3d9)),
-        Descriptor::sampled(3, color_texture, color_texture_sampler),
-        Descriptor::sampled(4, allocator->get_texture(*mask_storage.texture_id), get_default_sampler()),
-    });
-
-    encoder->begin_render_pass(render_pass, target_texture, ColorF());
+    auto z_buffer_texture = upload_z_buffer(z_buffer_map);
 
-    encoder->set_viewport({{0, 0}, target_texture_size.to_i32()});
+    auto metadata_texture = allocator->get_texture(metadata_texture_id);
+    auto mask_texture = allocator->get_texture(*mask_storage.texture_id);
 
-    encoder->bind_render_pipeline(tile_pipeline);
-
-    encoder->bind_vertex_buffers(
-        {{allocator->get_buffer(quad_vertex_buffer_id), 0}, {allocator->get_buffer(tile_vertex_buffer_id), 0}});
-
-    encoder->bind_descriptor_set(tile_descriptor_set);
-
-    encoder->draw_instanced(6, tiles_count);
+    // The color texture may be a render target drawn earlier in the frame.
+    std::vector<RenderGraphResource> reads = {
+        z_buffer_texture,
+        render_graph->import_texture(color_texture),
+        render_graph->import_texture(metadata_texture),
+        render_graph->import_texture(mask_texture),
+    };
 
-    encoder->end_render_pass();
+    render_graph->add_render_pass(
+        "draw tiles",
+        render_pass,
+        target,
+        tile_pipeline,
+        reads,
+        [=](const std::shared_ptr<CommandEncoder> &encoder) {
+            // Batches binding the same resources share a cached descriptor set, also across frames.
+            auto tile_descriptor_set = device->get_or_create_descriptor_set(
+                tile_descriptor_set_layout_,
+                {
+                    Descriptor::sampled(0, metadata_texture, default_sampler),
+                    Descriptor::sampled(1, render_graph->get_texture(z_buffer_texture), default_sampler),
+                    Descriptor::sampled(3, color_texture, color_texture_sampler),
+                    Descriptor::sampled(4, mask_texture, default_sampler),
+                    // Unused binding.
+                    Descriptor::sampled(5, allocator->get_texture(dummy_texture_id), default_sampler),
+                    // Unused binding.
+                    Descriptor::sampled(6, allocator->get_texture(dummy_texture_id), default_sampler),
+                });
+
+            encoder->bind_vertex_buffers({{allocator->get_buffer(quad_vertex_buffer_id), 0},
+                                          {tile_vertex_buffer.buffer, tile_vertex_buffer.offset}});
+
+            encoder->bind_descriptor_set(tile_descriptor_set);
+
+            encoder->push_constants(2, sizeof(TileUniformD3d9), &tile_uniform);
+
+            encoder->draw_instanced(6, tiles_count);
+        });
 }
 
 } // namespace Pathfinder
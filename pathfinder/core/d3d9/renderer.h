@@ -8,13 +8,14 @@
 #include "../../gpu/render_pass.h"
 #include "../../gpu/render_pipeline.h"
 #include "../../gpu/texture.h"
+#include "../../gpu_mem/ring_buffer.h"
 #include "../renderer.h"
 #include "object_builder.h"
 
 namespace Pathfinder {
 
 struct ClipBufferInfo {
-    uint64_t clip_buffer_id;
+    StagingAllocation clip_buffer;
     uint32_t clip_count;
 };
 
@@ -45,7 +46,10 @@ public:
 
 private:
     /// Vertex buffers.
-    uint64_t quad_vertex_buffer_id; // Static
+    uint64_t quad_vertex_buffer_id; // Static, owned by the context.
+
+    /// Fill, tile and clip instances of the current frame.
+    std::shared_ptr<RingBuffer> instance_ring_buffer;
 
     /// Pipelines.
     std::shared_ptr<RenderPipeline> fill_pipeline, tile_pipeline;
@@ -58,22 +62,11 @@ private:
     std::shared_ptr<DescriptorSet> fill_descriptor_set;
     std::shared_ptr<DescriptorSet> tile_clip_copy_descriptor_set, tile_clip_combine_descriptor_set; // For clip paths.
 
-    std::vector<std::shared_ptr<DescriptorSet>> tile_descriptor_sets;
-
-    /// Uniform buffers.
-    uint64_t fill_ub_id, tile_ub_id;
-
-    uint32_t tile_batch_storage_count = 0;
-    uint32_t tile_batch_idx = 0;
+    /// Uniform buffer. Tile uniforms are pushed with each draw instead.
+    uint64_t fill_ub_id;
 
     uint32_t last_frame_index = std::numeric_limits<uint32_t>::max();
 
-    // Temp
-    std::vector<uint64_t> tile_vertex_buffer_ids;
-    std::vector<uint64_t> z_buffer_texture_ids;
-    std::vector<ClipBufferInfo> clip_buffer_infos;
-    std::shared_ptr<uint64_t> temp_mask_texture_id;
-
     /// Where the final rendering output goes.
     /// This is not managed by the memory allocator.
     std::shared_ptr<Texture> dest_texture;
@@ -82,7 +75,9 @@ private:
     std::shared_ptr<RenderPass> dest_render_pass_clear, dest_render_pass_load;
 
 public:
-    explicit RendererD3D9(const std::shared_ptr<Device> &_device, const std::shared_ptr<Queue> &_queue);
+    explicit RendererD3D9(const std::shared_ptr<RendererContext> &_context);
+
+    ~RendererD3D9() override;
 
     void set_up_pipelines() override;
 
@@ -102,41 +97,32 @@ private:
 
     void create_tile_clip_combine_pipeline();
 
-    void upload_and_draw_tiles(const std::vector<DrawTileBatchD3D9> &tile_batches,
-                               const std::shared_ptr<CommandEncoder> &encoder);
+    void upload_and_draw_tiles(const std::vector<DrawTileBatchD3D9> &tile_batches);
 
     /// Upload fills data to GPU.
-    uint64_t upload_fills(const std::vector<Fill> &fills, const std::shared_ptr<CommandEncoder> &encoder) const;
+    StagingAllocation upload_fills(const std::vector<Fill> &fills) const;
 
-    ClipBufferInfo upload_clip_tiles(const std::vector<Clip> &clips,
-                                     const std::shared_ptr<CommandEncoder> &encoder) const;
+    ClipBufferInfo upload_clip_tiles(const std::vector<Clip> &clips) const;
 
     /// Apply clip paths.
-    void clip_tiles(const ClipBufferInfo &clip_buffer_info, const std::shared_ptr<CommandEncoder> &encoder);
+    void clip_tiles(const ClipBufferInfo &clip_buffer_info);
 
-    uint64_t upload_z_buffer(const DenseTileMap<uint32_t> &z_buffer_map,
-                             const std::shared_ptr<CommandEncoder> &encoder) const;
+    /// The Z buffer is a transient texture of the render graph.
+    RenderGraphResource upload_z_buffer(const DenseTileMap<uint32_t> &z_buffer_map) const;
 
     /// Upload tiles data to GPU.
-    uint64_t upload_tiles(const std::vector<TileObjectPrimitive> &tiles,
-                          const std::shared_ptr<CommandEncoder> &encoder) const;
+    StagingAllocation upload_tiles(const std::vector<TileObjectPrimitive> &tiles) const;
 
     /// Draw tiles.
-    void draw_tiles(uint64_t tile_vertex_buffer_id,
+    /// The render graph merges the render passes of consecutive batches drawing to the same target.
+    void draw_tiles(const StagingAllocation &tile_vertex_buffer,
                     uint32_t tile_count,
                     const std::shared_ptr<const RenderTargetId> &render_target_id,
                     const std::shared_ptr<const TileBatchTextureInfo> &color_texture_info,
-                    uint64_t z_buffer_texture_id,
-                    const std::shared_ptr<CommandEncoder> &encoder,
-                    const std::shared_ptr<DescriptorSet> &tile_descriptor_set,
-                    uint64_t tile_uniform_offset);
+                    const DenseTileMap<uint32_t> &z_buffer_map);
 
     /// Draw the mask texture. Use Renderer::buffered_fills.
-    void draw_fills(uint64_t fill_vertex_buffer_id,
-                    uint32_t fills_count,
-                    const std::shared_ptr<CommandEncoder> &encoder) const;
-
-    void update_tile_batch_storage(uint32_t new_tile_batch_count);
+    void draw_fills(const StagingAllocation &fill_vertex_buffer, uint32_t fills_count) const;
 };
 
 } // namespace Pathfinder
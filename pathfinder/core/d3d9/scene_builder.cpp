@@ -98,7 +98,7 @@ void SceneBuilderD3D9::build(Scene *_scene, Renderer *renderer) {
     scene = _scene;
 
     // Build paint data.
-    auto paint_metadata = scene->palette.build_paint_info(renderer);
+    auto paint_metadata = scene->palette.build_paint_info(renderer, scene->get_render_target_lifetimes());
 
     // Most important step.
     // Build draw paths into built draw paths.
@@ -1,5 +1,8 @@
 #include "palette.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "../../common/math/basic.h"
 #include "../d3d9/tiler.h"
 #include "../renderer.h"
@@ -117,13 +120,19 @@ RenderTargetDesc Palette::get_render_target(RenderTargetId render_target_id) con
     return render_targets_desc[render_target_id.render_target];
 }
 
-std::vector<PaintMetadata> Palette::build_paint_info(Renderer *renderer) {
+uint32_t Palette::get_render_target_count() const {
+    return render_targets_desc.size();
+}
+
+std::vector<PaintMetadata> Palette::build_paint_info(Renderer *renderer,
+                                                     const std::vector<Range> &render_target_lifetimes) {
     auto paint_texture_manager = std::make_shared<PaintTextureManager>();
 
     std::vector<TextureLocation> transient_paint_locations;
 
     // Assign render target locations.
-    auto render_target_metadata = assign_render_target_locations(paint_texture_manager, transient_paint_locations);
+    auto render_target_metadata =
+        assign_render_target_locations(paint_texture_manager, render_target_lifetimes, transient_paint_locations);
 
     PaintLocationsInfo paint_locations_info =
         assign_paint_locations(paint_texture_manager, render_target_metadata, transient_paint_locations);
@@ -211,13 +220,57 @@ std::vector<TextureMetadataEntry> Palette::create_texture_metadata(const std::ve
 
 std::vector<TextureLocation> Palette::assign_render_target_locations(
     const std::shared_ptr<PaintTextureManager> &texture_manager,
+    const std::vector<Range> &render_target_lifetimes,
     std::vector<TextureLocation> &transient_paint_locations) {
-    std::vector<TextureLocation> render_target_metadata;
+    std::vector<TextureLocation> render_target_metadata(render_targets_desc.size());
+
+    // Render targets without a known lifetime are kept alive through the whole frame.
+    auto get_lifetime = [&](uint32_t index) {
+        if (index < render_target_lifetimes.size()) {
+            return render_target_lifetimes[index];
+        }
+        return Range(0, std::numeric_limits<unsigned long long>::max());
+    };
+
+    // Visit render targets in the order they are first drawn to.
+    std::vector<uint32_t> order(render_targets_desc.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return get_lifetime(a).start < get_lifetime(b).start;
+    });
+
+    struct AliasedPage {
+        TextureLocation location;
+        /// Lifetime end of the last render target using the page.
+        unsigned long long end;
+    };
 
-    for (const auto &desc : render_targets_desc) {
-        auto location = texture_manager->allocator.allocate_image(desc.size);
-        render_target_metadata.push_back(location);
-        transient_paint_locations.push_back(location);
+    std::vector<AliasedPage> aliased_pages;
+
+    for (auto index : order) {
+        const auto &desc = render_targets_desc[index];
+        auto lifetime = get_lifetime(index);
+
+        // Render targets are cleared before being drawn to, so a page can be taken over once its last
+        // render target has been read for the last time. Only pages of the same size are reused,
+        // as sampling clamps to the page edges.
+        AliasedPage *reused_page = nullptr;
+        for (auto &page : aliased_pages) {
+            if (page.location.rect.size() == desc.size && page.end <= lifetime.start) {
+                reused_page = &page;
+                break;
+            }
+        }
+
+        if (reused_page) {
+            reused_page->end = lifetime.end;
+            render_target_metadata[index] = reused_page->location;
+        } else {
+            auto location = texture_manager->allocator.allocate_image(desc.size);
+            aliased_pages.push_back({location, lifetime.end});
+            render_target_metadata[index] = location;
+            transient_paint_locations.push_back(location);
+        }
     }
 
     return render_target_metadata;
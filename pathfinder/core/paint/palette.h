@@ -60,8 +60,12 @@ public:
 
     RenderTargetDesc get_render_target(RenderTargetId render_target_id) const;
 
+    uint32_t get_render_target_count() const;
+
     /// Important step.
-    std::vector<PaintMetadata> build_paint_info(Renderer *renderer);
+    /// Render targets of the same size share a texture page if their lifetimes don't overlap.
+    /// See Scene::get_render_target_lifetimes.
+    std::vector<PaintMetadata> build_paint_info(Renderer *renderer, const std::vector<Range> &render_target_lifetimes);
 
     /// Append another palette to this append_palette, merging paints and render targets.
     MergedPaletteInfo append_palette(const Palette &palette, const Transform2 &transform);
@@ -87,6 +91,7 @@ private:
 
     std::vector<TextureLocation> assign_render_target_locations(
         const std::shared_ptr<PaintTextureManager> &texture_manager,
+        const std::vector<Range> &render_target_lifetimes,
         std::vector<TextureLocation> &transient_paint_locations);
 
     PaintLocationsInfo assign_paint_locations(const std::shared_ptr<PaintTextureManager> &texture_manager,
@@ -0,0 +1,399 @@
+#include "render_graph.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "../common/logger.h"
+
+namespace Pathfinder {
+
+static bool contains(const std::vector<RenderGraphResource> &resources, RenderGraphResource resource) {
+    return std::find(resources.begin(), resources.end(), resource) != resources.end();
+}
+
+RenderGraph::RenderGraph(const std::shared_ptr<GpuMemoryAllocator> &allocator) : allocator_(allocator) {}
+
+RenderGraphResource RenderGraph::import_buffer(const std::shared_ptr<Buffer> &buffer) {
+    auto it = imported_resources_.find(buffer.get());
+    if (it != imported_resources_.end()) {
+        return it->second;
+    }
+
+    Resource resource;
+    resource.buffer = buffer;
+
+    auto handle = (RenderGraphResource)resources_.size();
+    resources_.push_back(resource);
+    imported_resources_[buffer.get()] = handle;
+
+    return handle;
+}
+
+RenderGraphResource RenderGraph::import_texture(const std::shared_ptr<Texture> &texture) {
+    auto it = imported_resources_.find(texture.get());
+    if (it != imported_resources_.end()) {
+        return it->second;
+    }
+
+    Resource resource;
+    resource.is_texture = true;
+    resource.texture = texture;
+
+    auto handle = (RenderGraphResource)resources_.size();
+    resources_.push_back(resource);
+    imported_resources_[texture.get()] = handle;
+
+    return handle;
+}
+
+RenderGraphResource RenderGraph::create_buffer(size_t size, BufferType type, const std::string &label) {
+    Resource resource;
+    resource.is_transient = true;
+    resource.buffer_descriptor = BufferDescriptor{type, size, MemoryProperty::DeviceLocal};
+    resource.label = label;
+
+    resources_.push_back(resource);
+
+    return (RenderGraphResource)(resources_.size() - 1);
+}
+
+RenderGraphResource RenderGraph::create_texture(Vec2I size, TextureFormat format, const std::string &label) {
+    Resource resource;
+    resource.is_texture = true;
+    resource.is_transient = true;
+    resource.texture_descriptor = TextureDescriptor{size, format};
+    resource.label = label;
+
+    resources_.push_back(resource);
+
+    return (RenderGraphResource)(resources_.size() - 1);
+}
+
+std::shared_ptr<Buffer> RenderGraph::get_buffer(RenderGraphResource resource) const {
+    if (resource >= resources_.size() || resources_[resource].is_texture) {
+        Logger::error("Invalid render graph buffer!", "RenderGraph");
+        return nullptr;
+    }
+    return resources_[resource].buffer;
+}
+
+std::shared_ptr<Texture> RenderGraph::get_texture(RenderGraphResource resource) const {
+    if (resource >= resources_.size() || !resources_[resource].is_texture) {
+        Logger::error("Invalid render graph texture!", "RenderGraph");
+        return nullptr;
+    }
+    return resources_[resource].texture;
+}
+
+void RenderGraph::add_pass(const std::string &label,
+                           std::vector<RenderGraphResource> reads,
+                           std::vector<RenderGraphResource> writes,
+                           RenderGraphCallback callback) {
+    Pass pass;
+    pass.label = label;
+    pass.reads = std::move(reads);
+    pass.writes = std::move(writes);
+    pass.callback = std::move(callback);
+
+    passes_.push_back(std::move(pass));
+}
+
+void RenderGraph::add_render_pass(const std::string &label,
+                                  const std::shared_ptr<RenderPass> &render_pass,
+                                  RenderGraphResource target,
+                                  const std::shared_ptr<RenderPipeline> &pipeline,
+                                  std::vector<RenderGraphResource> reads,
+                                  RenderGraphCallback callback) {
+    if (target >= resources_.size() || !resources_[target].is_texture) {
+        Logger::error("Render pass target is not a render graph texture!", "RenderGraph");
+        return;
+    }
+
+    Pass pass;
+    pass.label = label;
+    pass.reads = std::move(reads);
+    pass.writes = {target};
+    pass.callback = std::move(callback);
+    pass.render_pass = render_pass;
+    pass.pipeline = pipeline;
+    pass.target = target;
+
+    // Loading the target depends on whatever was drawn to it before.
+    if (render_pass->get_attachment_load_op() == AttachmentLoadOp::Load) {
+        pass.reads.push_back(target);
+    }
+
+    passes_.push_back(std::move(pass));
+}
+
+std::vector<bool> RenderGraph::find_live_passes() const {
+    std::vector<bool> live(passes_.size(), false);
+
+    // Transient resources read by live passes.
+    std::vector<bool> needed(resources_.size(), false);
+
+    for (size_t pass_index = passes_.size(); pass_index-- > 0;) {
+        const auto &pass = passes_[pass_index];
+
+        bool is_live = pass.writes.empty();
+        for (auto resource : pass.writes) {
+            if (!resources_[resource].is_transient || needed[resource]) {
+                is_live = true;
+            }
+        }
+
+        if (!is_live) {
+            continue;
+        }
+
+        live[pass_index] = true;
+
+        for (auto resource : pass.reads) {
+            needed[resource] = true;
+        }
+    }
+
+    return live;
+}
+
+bool RenderGraph::depends_on(const Pass &pass, const Step &step) const {
+    for (auto step_pass_index : step.passes) {
+        const auto &step_pass = passes_[step_pass_index];
+
+        for (auto resource : pass.reads) {
+            if (contains(step_pass.writes, resource)) {
+                return true;
+            }
+        }
+
+        for (auto resource : pass.writes) {
+            if (contains(step_pass.reads, resource) || contains(step_pass.writes, resource)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+std::vector<RenderGraph::Step> RenderGraph::schedule(const std::vector<bool> &live) const {
+    std::vector<Step> steps;
+
+    for (size_t pass_index = 0; pass_index < passes_.size(); pass_index++) {
+        if (!live[pass_index]) {
+            continue;
+        }
+
+        const auto &pass = passes_[pass_index];
+        bool render_pass_open = !steps.empty() && steps.back().is_render;
+
+        if (pass.render_pass) {
+            // Keep drawing into the open render pass if it has the same target and nothing needs to be cleared.
+            // On tiled GPUs, every new render pass loads and stores the whole target.
+            if (render_pass_open && passes_[steps.back().passes.back()].target == pass.target &&
+                pass.render_pass->get_attachment_load_op() == AttachmentLoadOp::Load) {
+                steps.back().passes.push_back(pass_index);
+            } else {
+                steps.push_back({{pass_index}, true});
+            }
+        } else {
+            // Move independent passes ahead of the open render pass, so that following render passes can continue it.
+            if (render_pass_open && !depends_on(pass, steps.back())) {
+                steps.insert(steps.end() - 1, {{pass_index}, false});
+            } else {
+                steps.push_back({{pass_index}, false});
+            }
+        }
+    }
+
+    return steps;
+}
+
+std::vector<RenderGraph::PhysicalResource> RenderGraph::allocate_transient_resources(const std::vector<Step> &steps) {
+    // Lifetimes of the transient resources, in steps.
+    std::vector<size_t> first_steps(resources_.size(), steps.size());
+    std::vector<size_t> last_steps(resources_.size(), 0);
+
+    for (size_t step_index = 0; step_index < steps.size(); step_index++) {
+        for (auto pass_index : steps[step_index].passes) {
+            const auto &pass = passes_[pass_index];
+
+            for (const auto *resources : {&pass.reads, &pass.writes}) {
+                for (auto resource : *resources) {
+                    first_steps[resource] = std::min(first_steps[resource], step_index);
+                    last_steps[resource] = std::max(last_steps[resource], step_index);
+                }
+            }
+        }
+    }
+
+    std::vector<RenderGraphResource> transient_resources;
+    for (RenderGraphResource resource = 0; resource < resources_.size(); resource++) {
+        if (resources_[resource].is_transient && first_steps[resource] < steps.size()) {
+            transient_resources.push_back(resource);
+        }
+    }
+
+    std::stable_sort(transient_resources.begin(),
+                     transient_resources.end(),
+                     [&](RenderGraphResource a, RenderGraphResource b) { return first_steps[a] < first_steps[b]; });
+
+    std::vector<PhysicalResource> physical_resources;
+
+    for (auto resource_index : transient_resources) {
+        auto &resource = resources_[resource_index];
+
+        // Reuse an object whose resources are no longer alive.
+        PhysicalResource *physical = nullptr;
+
+        for (auto &candidate : physical_resources) {
+            if (candidate.is_texture != resource.is_texture || candidate.last_step >= first_steps[resource_index]) {
+                continue;
+            }
+
+            if (resource.is_texture) {
+                auto texture = allocator_->get_texture(candidate.id);
+                if (texture->get_size() == resource.texture_descriptor.size &&
+                    texture->get_format() == resource.texture_descriptor.format) {
+                    physical = &candidate;
+                    break;
+                }
+            } else {
+                auto buffer = allocator_->get_buffer(candidate.id);
+                if (buffer->get_type() == resource.buffer_descriptor.type &&
+                    buffer->get_size() >= resource.buffer_descriptor.size) {
+                    physical = &candidate;
+                    break;
+                }
+            }
+        }
+
+        if (physical == nullptr) {
+            PhysicalResource new_physical;
+            new_physical.is_texture = resource.is_texture;
+
+            if (resource.is_texture) {
+                new_physical.id = allocator_->allocate_texture(resource.texture_descriptor.size,
+                                                               resource.texture_descriptor.format,
+                                                               resource.label);
+            } else {
+                new_physical.id = allocator_->allocate_buffer(resource.buffer_descriptor.size,
+                                                              resource.buffer_descriptor.type,
+                                                              resource.label,
+                                                              BufferUsage::GpuOnly);
+            }
+
+            physical_resources.push_back(new_physical);
+            physical = &physical_resources.back();
+        }
+
+        physical->last_step = last_steps[resource_index];
+
+        if (resource.is_texture) {
+            resource.texture = allocator_->get_texture(physical->id);
+        } else {
+            resource.buffer = allocator_->get_buffer(physical->id);
+        }
+    }
+
+    return physical_resources;
+}
+
+void RenderGraph::execute(const std::shared_ptr<CommandEncoder> &encoder, GpuProfiler *profiler) {
+    auto steps = schedule(find_live_passes());
+
+    auto physical_resources = allocate_transient_resources(steps);
+
+    auto get_object = [&](RenderGraphResource resource) -> const void * {
+        auto &r = resources_[resource];
+        return r.is_texture ? (const void *)r.texture.get() : (const void *)r.buffer.get();
+    };
+
+    // Objects accessed since the last barrier. Aliased transient resources share an object,
+    // so reusing one waits for the previous accesses as well.
+    std::unordered_set<const void *> written_objects, read_objects;
+
+    for (const auto &step : steps) {
+        std::vector<const void *> step_reads, step_writes;
+        for (auto pass_index : step.passes) {
+            for (auto resource : passes_[pass_index].reads) {
+                step_reads.push_back(get_object(resource));
+            }
+            for (auto resource : passes_[pass_index].writes) {
+                step_writes.push_back(get_object(resource));
+            }
+        }
+
+        bool needs_barrier = false;
+        for (auto object : step_reads) {
+            needs_barrier = needs_barrier || written_objects.count(object) > 0;
+        }
+        for (auto object : step_writes) {
+            needs_barrier = needs_barrier || written_objects.count(object) > 0 || read_objects.count(object) > 0;
+        }
+
+        if (needs_barrier) {
+            encoder->memory_barrier();
+            written_objects.clear();
+            read_objects.clear();
+        }
+
+        read_objects.insert(step_reads.begin(), step_reads.end());
+        written_objects.insert(step_writes.begin(), step_writes.end());
+
+        if (!step.is_render) {
+            auto &pass = passes_[step.passes.front()];
+            if (pass.callback) {
+                pass.callback(encoder);
+            }
+            continue;
+        }
+
+        auto &first_pass = passes_[step.passes.front()];
+        auto target_texture = resources_[first_pass.target].texture;
+
+        if (profiler) {
+            profiler->begin_scope(encoder, first_pass.label);
+        }
+
+        encoder->begin_render_pass(first_pass.render_pass, target_texture, ColorF());
+
+        encoder->set_viewport({{0, 0}, target_texture->get_size()});
+
+        RenderPipeline *bound_pipeline = nullptr;
+
+        for (auto pass_index : step.passes) {
+            auto &pass = passes_[pass_index];
+
+            if (pass.pipeline && pass.pipeline.get() != bound_pipeline) {
+                encoder->bind_render_pipeline(pass.pipeline);
+                bound_pipeline = pass.pipeline.get();
+            }
+
+            if (pass.callback) {
+                pass.callback(encoder);
+            }
+        }
+
+        encoder->end_render_pass();
+
+        if (profiler) {
+            profiler->end_scope(encoder);
+        }
+    }
+
+    // The allocator keeps freed objects alive until the GPU is done with this frame.
+    for (auto &physical : physical_resources) {
+        if (physical.is_texture) {
+            allocator_->free_texture(physical.id);
+        } else {
+            allocator_->free_buffer(physical.id);
+        }
+    }
+
+    passes_.clear();
+    resources_.clear();
+    imported_resources_.clear();
+}
+
+} // namespace Pathfinder
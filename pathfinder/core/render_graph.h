@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../gpu/command_encoder.h"
+#include "../gpu/profiler.h"
+#include "../gpu_mem/allocator.h"
+
+namespace Pathfinder {
+
+/// Handle of a buffer or texture accessed by render graph passes.
+using RenderGraphResource = uint32_t;
+
+using RenderGraphCallback = std::function<void(const std::shared_ptr<CommandEncoder> &encoder)>;
+
+/// Passes declaring the resources they read and write, encoded together on execution.
+///
+/// When executed, the graph culls passes whose results are never used, merges render passes drawing
+/// to the same target, places memory barriers between dependent passes, and allocates transient
+/// resources for their lifetime only, aliasing the ones that aren't alive at the same time.
+///
+/// Passes are dropped after execution, so the graph is rebuilt for each submission.
+/// Callbacks run during execution, so anything they capture has to stay valid until then.
+class RenderGraph {
+public:
+    explicit RenderGraph(const std::shared_ptr<GpuMemoryAllocator> &allocator);
+
+    /// Use a resource that lives outside of the graph. Passes writing imported resources are never culled.
+    RenderGraphResource import_buffer(const std::shared_ptr<Buffer> &buffer);
+
+    RenderGraphResource import_texture(const std::shared_ptr<Texture> &texture);
+
+    /// Declare a resource that only lives while the graph is executed.
+    /// Its contents are undefined until a pass writes it.
+    RenderGraphResource create_buffer(size_t size, BufferType type, const std::string &label);
+
+    RenderGraphResource create_texture(Vec2I size, TextureFormat format, const std::string &label);
+
+    /// Transient resources are only available inside pass callbacks.
+    std::shared_ptr<Buffer> get_buffer(RenderGraphResource resource) const;
+
+    std::shared_ptr<Texture> get_texture(RenderGraphResource resource) const;
+
+    /// Add a pass recording commands outside of a render pass, like compute passes and data transfers.
+    /// A pass without writes is assumed to have other side effects and is never culled.
+    void add_pass(const std::string &label,
+                  std::vector<RenderGraphResource> reads,
+                  std::vector<RenderGraphResource> writes,
+                  RenderGraphCallback callback);
+
+    /// Add a pass drawing to `target`.
+    ///
+    /// The graph begins the render pass, sets a viewport covering the target and binds the pipeline,
+    /// so the callback only binds resources and draws. A pass loading its target continues the render pass
+    /// of the previous one if that draws to the same target. Independent passes recorded in between
+    /// are moved ahead, so they don't break the render pass.
+    void add_render_pass(const std::string &label,
+                         const std::shared_ptr<RenderPass> &render_pass,
+                         RenderGraphResource target,
+                         const std::shared_ptr<RenderPipeline> &pipeline,
+                         std::vector<RenderGraphResource> reads,
+                         RenderGraphCallback callback);
+
+    bool is_empty() const {
+        return passes_.empty();
+    }
+
+    /// Encode the live passes, then release the transient resources.
+    /// @param profiler If not null, render passes are measured and labeled after their first graph pass.
+    void execute(const std::shared_ptr<CommandEncoder> &encoder, GpuProfiler *profiler = nullptr);
+
+private:
+    struct Resource {
+        bool is_texture = false;
+        bool is_transient = false;
+
+        /// Set for the whole lifetime of imported resources, and during execution for transient ones.
+        std::shared_ptr<Buffer> buffer;
+        std::shared_ptr<Texture> texture;
+
+        /// Transient resources only.
+        BufferDescriptor buffer_descriptor;
+        TextureDescriptor texture_descriptor;
+        std::string label;
+    };
+
+    struct Pass {
+        std::string label;
+        std::vector<RenderGraphResource> reads;
+        std::vector<RenderGraphResource> writes;
+        RenderGraphCallback callback;
+
+        /// Render passes only.
+        std::shared_ptr<RenderPass> render_pass;
+        std::shared_ptr<RenderPipeline> pipeline;
+        RenderGraphResource target = 0;
+    };
+
+    /// Passes encoded in one go: a single non-render pass, or render passes sharing a render pass instance.
+    struct Step {
+        std::vector<size_t> passes;
+        bool is_render = false;
+    };
+
+    /// Allocator object backing one or more transient resources.
+    struct PhysicalResource {
+        uint64_t id = 0;
+        bool is_texture = false;
+        size_t last_step = 0;
+    };
+
+    std::vector<bool> find_live_passes() const;
+
+    std::vector<Step> schedule(const std::vector<bool> &live) const;
+
+    std::vector<PhysicalResource> allocate_transient_resources(const std::vector<Step> &steps);
+
+    bool depends_on(const Pass &pass, const Step &step) const;
+
+    std::shared_ptr<GpuMemoryAllocator> allocator_;
+
+    std::vector<Resource> resources_;
+
+    std::vector<Pass> passes_;
+
+    /// Imported resources by object, so that importing one again gives the same handle.
+    std::unordered_map<const void *, RenderGraphResource> imported_resources_;
+};
+
+} // namespace Pathfinder
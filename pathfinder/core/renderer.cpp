@@ -4,44 +4,36 @@
 
 #include <array>
 
-#include "../common/io.h"
-#include "../shaders/generated/area_lut_png.h"
 #include "paint/palette.h"
 
 namespace Pathfinder {
 
-Renderer::Renderer(const std::shared_ptr<Device> &_device, const std::shared_ptr<Queue> &_queue)
-    : device(_device), queue(_queue) {
-    allocator = std::make_shared<GpuMemoryAllocator>(device);
+Renderer::Renderer(const std::shared_ptr<RendererContext> &_context)
+    : context(_context), device(_context->device), queue(_context->queue), allocator(_context->allocator) {
+    render_graph = std::make_shared<RenderGraph>(allocator);
 
-    // Area-Lut texture.
-    auto image_buffer = ImageBuffer::from_memory({std::begin(area_lut_png), std::end(area_lut_png)}, false);
+    pressure_callback_id_ = allocator->add_pressure_callback([this](size_t) { evict_unused_pattern_texture_pages(); });
 
-    area_lut_texture_id =
-        allocator->allocate_texture(image_buffer->get_size(), TextureFormat::Rgba8Unorm, "area-lut texture");
-
-    // Dummy texture.
-    dummy_texture_id = allocator->allocate_texture({1, 1}, TextureFormat::Rgba8Unorm, "dummy texture");
-
-    metadata_texture_id = allocator->allocate_texture({TEXTURE_METADATA_TEXTURE_WIDTH, TEXTURE_METADATA_TEXTURE_HEIGHT},
-                                                      TextureFormat::Rgba16Float,
-                                                      "metadata texture");
+    area_lut_texture_id = context->area_lut_texture_id;
+    dummy_texture_id = context->dummy_texture_id;
+    metadata_texture_id = context->metadata_texture_id;
 
     fence = device->create_fence("renderer fence");
-
-    auto encoder = device->create_command_encoder("upload common renderer data");
-
-    encoder->write_texture(allocator->get_texture(area_lut_texture_id), {}, image_buffer->get_data());
-
-    queue->submit(encoder, nullptr);
 }
 
 Renderer::~Renderer() {
+    allocator->remove_pressure_callback(pressure_callback_id_);
+
+    // The allocator outlives this renderer when the context is shared.
     for (const auto &texture_page : pattern_texture_pages) {
         if (texture_page != nullptr) {
             allocator->free_texture(texture_page->texture_id_);
         }
     }
+
+    if (mask_storage.texture_id) {
+        allocator->free_texture(*mask_storage.texture_id);
+    }
 }
 
 void Renderer::allocate_pattern_texture_page(uint64_t page_id, Vec2I texture_size) {
@@ -109,59 +101,79 @@ void Renderer::upload_texel_data(std::vector<ColorU> &texels,
     texture_page->must_preserve_contents_ = true;
 }
 
+void Renderer::evict_unused_pattern_texture_pages() {
+    for (auto &texture_page : pattern_texture_pages) {
+        if (texture_page != nullptr && !texture_page->in_use_) {
+            allocator->free_texture(texture_page->texture_id_);
+            texture_page = nullptr;
+        }
+    }
+}
+
 void Renderer::reset() {
     render_target_locations.clear();
+
+    // Pages are allocated again by the next scene that needs them.
+    for (auto &texture_page : pattern_texture_pages) {
+        if (texture_page != nullptr) {
+            texture_page->in_use_ = false;
+        }
+    }
+
     allocator->purge_if_needed();
 }
 
 std::shared_ptr<Sampler> Renderer::get_or_create_sampler(TextureSamplingFlags sampling_flags) {
-    SamplerDescriptor descriptor{};
+    return context->get_or_create_sampler(sampling_flags);
+}
 
-    if (sampling_flags.contains(TextureSamplingFlags::REPEAT_U)) {
-        descriptor.address_mode_u = SamplerAddressMode::Repeat;
-    } else {
-        descriptor.address_mode_u = SamplerAddressMode::ClampToEdge;
-    }
-    if (sampling_flags.contains(TextureSamplingFlags::REPEAT_V)) {
-        descriptor.address_mode_v = SamplerAddressMode::Repeat;
-    } else {
-        descriptor.address_mode_v = SamplerAddressMode::ClampToEdge;
-    }
-    if (sampling_flags.contains(TextureSamplingFlags::NEAREST_MAG)) {
-        descriptor.mag_filter = SamplerFilter::Nearest;
-    } else {
-        descriptor.mag_filter = SamplerFilter::Linear;
-    }
-    if (sampling_flags.contains(TextureSamplingFlags::NEAREST_MIN)) {
-        descriptor.min_filter = SamplerFilter::Nearest;
-    } else {
-        descriptor.min_filter = SamplerFilter::Linear;
+std::shared_ptr<Sampler> Renderer::get_default_sampler() {
+    return context->get_default_sampler();
+}
+
+void Renderer::set_gpu_profiling_enabled(bool enabled) {
+    if (!enabled) {
+        gpu_profiler = nullptr;
+        return;
     }
 
-    for (auto &s : samplers) {
-        if (s->get_descriptor() == descriptor) {
-            return s;
-        }
+    if (gpu_profiler) {
+        return;
     }
 
-    auto new_sampler = device->create_sampler(descriptor);
-    samplers.push_back(new_sampler);
+    gpu_profiler = std::make_shared<GpuProfiler>(device);
 
-    return new_sampler;
+    if (!gpu_profiler->is_supported()) {
+        Logger::warn("Timestamp queries are not supported by the device, GPU profiling is disabled.");
+        gpu_profiler = nullptr;
+    }
 }
 
-std::shared_ptr<Sampler> Renderer::get_default_sampler() {
-    TextureSamplingFlags flags;
+void Renderer::set_memory_budget(size_t budget) {
+    allocator->set_memory_budget(budget);
+}
 
-    // Note: It has to be CLAMP_TO_EDGE. Artifacts will show for both REPEAT and MIRRORED_REPEAT.
-    flags.value = 0;
+GpuMemoryStats Renderer::get_memory_stats() const {
+    return allocator->get_stats();
+}
 
-    // Raspberry PI only supports NEAREST for NPOT textures.
-#if defined(__linux__) && defined(__ARM_ARCH)
-    flags.value |= TextureSamplingFlags::NEAREST_MIN | TextureSamplingFlags::NEAREST_MAG;
-#endif
+std::vector<GpuTiming> Renderer::get_gpu_timings() const {
+    if (!gpu_profiler) {
+        return {};
+    }
+    return gpu_profiler->get_timings();
+}
 
-    return get_or_create_sampler(flags);
+void Renderer::begin_gpu_scope(const std::shared_ptr<CommandEncoder> &encoder, const std::string &label) const {
+    if (gpu_profiler) {
+        gpu_profiler->begin_scope(encoder, label);
+    }
+}
+
+void Renderer::end_gpu_scope(const std::shared_ptr<CommandEncoder> &encoder) const {
+    if (gpu_profiler) {
+        gpu_profiler->end_scope(encoder);
+    }
 }
 
 void Renderer::upload_texture_metadata(const std::vector<TextureMetadataEntry> &metadata,
@@ -3,9 +3,12 @@
 #include <cstdint>
 
 #include "../gpu/device.h"
+#include "../gpu/profiler.h"
 #include "../gpu/queue.h"
 #include "../gpu_mem/allocator.h"
 #include "data/data.h"
+#include "render_graph.h"
+#include "renderer_context.h"
 #include "scene_builder.h"
 
 namespace Pathfinder {
@@ -36,6 +39,8 @@ public:
     uint64_t texture_id_;
     /// Should preserve framebuffer content.
     bool must_preserve_contents_;
+    /// Allocated for the current scene. Pages left over from earlier scenes can be evicted under memory pressure.
+    bool in_use_ = true;
 };
 
 struct MaskStorage {
@@ -57,7 +62,8 @@ enum class RenderMode {
 /// All GPU operations happen in the renderer.
 class Renderer {
 public:
-    Renderer(const std::shared_ptr<Device> &_device, const std::shared_ptr<Queue> &_queue);
+    /// Static resources and pipelines are taken from the context, and shared with other renderers using it.
+    explicit Renderer(const std::shared_ptr<RendererContext> &_context);
 
     virtual ~Renderer();
 
@@ -92,6 +98,22 @@ public:
 
     std::shared_ptr<Sampler> get_default_sampler();
 
+    /// Measure GPU time of the render passes and compute stages with timestamp queries.
+    /// Has no effect if the device doesn't support timestamp queries.
+    void set_gpu_profiling_enabled(bool enabled);
+
+    /// GPU time per stage. Lags a few frames behind, as results are read back asynchronously.
+    std::vector<GpuTiming> get_gpu_timings() const;
+
+    /// Limit the GPU memory held by all renderers of the context. Zero means no limit.
+    /// See GpuMemoryAllocator::set_memory_budget.
+    void set_memory_budget(size_t budget);
+
+    /// Stats of the allocator shared by all renderers of the context.
+    GpuMemoryStats get_memory_stats() const;
+
+    std::shared_ptr<RendererContext> context;
+
     std::shared_ptr<Device> device;
 
     std::shared_ptr<Queue> queue;
@@ -101,6 +123,16 @@ public:
 protected:
     virtual TextureFormat mask_texture_format() const = 0;
 
+    void begin_gpu_scope(const std::shared_ptr<CommandEncoder> &encoder, const std::string &label) const;
+
+    void end_gpu_scope(const std::shared_ptr<CommandEncoder> &encoder) const;
+
+    /// Free pattern texture pages not used by the current scene.
+    void evict_unused_pattern_texture_pages();
+
+    /// Null if profiling is disabled.
+    std::shared_ptr<GpuProfiler> gpu_profiler;
+
     /// If we should clear the dest framebuffer or texture.
     bool clear_dest_texture = true;
 
@@ -110,22 +142,23 @@ protected:
     MaskStorage mask_storage;
 
     // Basic data.
+    /// Shared by all renderers of the context.
     std::shared_ptr<GpuMemoryAllocator> allocator;
 
-    // Read-only static core resources.
-    // -----------------------------------------------
-    /// Uniform buffer containing some constants. Shared by D3D9 and D3D10.
-    uint64_t common_sizes_ub_id;
+    /// Passes of the current submission. Transient resources are allocated from the allocator.
+    std::shared_ptr<RenderGraph> render_graph;
 
+    uint64_t pressure_callback_id_;
+
+    // Static core resources, owned by the context.
+    // -----------------------------------------------
     /// Pre-Defined texture used to draw the mask texture. Shared by D3D9 and D3D10.
     uint64_t area_lut_texture_id;
 
     /// For unused texture binding point.
     uint64_t dummy_texture_id;
-    // -----------------------------------------------
 
-    // Read-write static core resources.
-    // -----------------------------------------------
+    /// Rewritten by each draw.
     uint64_t metadata_texture_id;
     // -----------------------------------------------
 
@@ -134,8 +167,6 @@ protected:
     std::vector<TextureLocation> render_target_locations;
     std::vector<std::shared_ptr<PatternTexturePage>> pattern_texture_pages;
     // -----------------------------------------------
-
-    std::vector<std::shared_ptr<Sampler>> samplers;
 };
 
 } // namespace Pathfinder
@@ -0,0 +1,178 @@
+#include "renderer_context.h"
+
+#include "../common/io.h"
+#include "../shaders/generated/area_lut_png.h"
+#include "paint/palette.h"
+
+namespace Pathfinder {
+
+RendererContext::RendererContext(const std::shared_ptr<Device> &_device,
+                                 const std::shared_ptr<Queue> &_queue,
+                                 const std::shared_ptr<Queue> &_compute_queue)
+    : device(_device), queue(_queue), compute_queue(_compute_queue) {
+    allocator = std::make_shared<GpuMemoryAllocator>(device);
+
+    // Area-Lut texture.
+    auto image_buffer = ImageBuffer::from_memory({std::begin(area_lut_png), std::end(area_lut_png)}, false);
+
+    area_lut_texture_id =
+        allocator->allocate_texture(image_buffer->get_size(), TextureFormat::Rgba8Unorm, "area-lut texture");
+
+    // Dummy texture.
+    dummy_texture_id = allocator->allocate_texture({1, 1}, TextureFormat::Rgba8Unorm, "dummy texture");
+
+    metadata_texture_id = allocator->allocate_texture({TEXTURE_METADATA_TEXTURE_WIDTH, TEXTURE_METADATA_TEXTURE_HEIGHT},
+                                                      TextureFormat::Rgba16Float,
+                                                      "metadata texture");
+
+    auto encoder = device->create_command_encoder("upload common renderer data");
+
+    encoder->write_texture(allocator->get_texture(area_lut_texture_id), {}, image_buffer->get_data());
+
+    queue->submit(encoder, nullptr);
+}
+
+RendererContext::~RendererContext() {
+    allocator->free_texture(area_lut_texture_id);
+    allocator->free_texture(dummy_texture_id);
+    allocator->free_texture(metadata_texture_id);
+
+    for (const auto &it : static_buffers) {
+        allocator->free_buffer(it.second);
+    }
+}
+
+std::shared_ptr<Sampler> RendererContext::get_or_create_sampler(TextureSamplingFlags sampling_flags) {
+    SamplerDescriptor descriptor{};
+
+    if (sampling_flags.contains(TextureSamplingFlags::REPEAT_U)) {
+        descriptor.address_mode_u = SamplerAddressMode::Repeat;
+    } else {
+        descriptor.address_mode_u = SamplerAddressMode::ClampToEdge;
+    }
+    if (sampling_flags.contains(TextureSamplingFlags::REPEAT_V)) {
+        descriptor.address_mode_v = SamplerAddressMode::Repeat;
+    } else {
+        descriptor.address_mode_v = SamplerAddressMode::ClampToEdge;
+    }
+    if (sampling_flags.contains(TextureSamplingFlags::NEAREST_MAG)) {
+        descriptor.mag_filter = SamplerFilter::Nearest;
+    } else {
+        descriptor.mag_filter = SamplerFilter::Linear;
+    }
+    if (sampling_flags.contains(TextureSamplingFlags::NEAREST_MIN)) {
+        descriptor.min_filter = SamplerFilter::Nearest;
+    } else {
+        descriptor.min_filter = SamplerFilter::Linear;
+    }
+
+    for (auto &s : samplers) {
+        if (s->get_descriptor() == descriptor) {
+            return s;
+        }
+    }
+
+    auto new_sampler = device->create_sampler(descriptor);
+    samplers.push_back(new_sampler);
+
+    return new_sampler;
+}
+
+std::shared_ptr<Sampler> RendererContext::get_default_sampler() {
+    TextureSamplingFlags flags;
+
+    // Note: It has to be CLAMP_TO_EDGE. Artifacts will show for both REPEAT and MIRRORED_REPEAT.
+    flags.value = 0;
+
+    // Raspberry PI only supports NEAREST for NPOT textures.
+#if defined(__linux__) && defined(__ARM_ARCH)
+    flags.value |= TextureSamplingFlags::NEAREST_MIN | TextureSamplingFlags::NEAREST_MAG;
+#endif
+
+    return get_or_create_sampler(flags);
+}
+
+std::shared_ptr<DescriptorSetLayout> RendererContext::get_or_create_descriptor_set_layout(
+    const std::vector<DescriptorLayout> &layouts) {
+    // Same ordering as the layout keeps its descriptors in.
+    std::map<uint32_t, DescriptorLayout> layouts_by_binding;
+    for (const auto &l : layouts) {
+        layouts_by_binding[l.binding] = l;
+    }
+
+    for (auto &layout : descriptor_set_layouts) {
+        if (layout->get_descriptor_layouts() == layouts_by_binding) {
+            return layout;
+        }
+    }
+
+    auto new_layout = device->create_descriptor_set_layout(layouts);
+    descriptor_set_layouts.push_back(new_layout);
+
+    return new_layout;
+}
+
+std::shared_ptr<RenderPass> RendererContext::get_or_create_render_pass(TextureFormat format,
+                                                                       AttachmentLoadOp load_op,
+                                                                       const std::string &label) {
+    auto &render_pass = render_passes[label];
+    if (!render_pass) {
+        render_pass = device->create_render_pass(format, load_op, label);
+    }
+    return render_pass;
+}
+
+std::shared_ptr<RenderPipeline> RendererContext::get_or_create_render_pipeline(
+    const std::string &label,
+    const std::function<std::shared_ptr<RenderPipeline>()> &create) {
+    auto it = render_pipelines.find(label);
+    if (it != render_pipelines.end()) {
+        return it->second;
+    }
+
+    auto pipeline = create();
+    if (pipeline) {
+        render_pipelines[label] = pipeline;
+    }
+
+    return pipeline;
+}
+
+std::shared_ptr<ComputePipeline> RendererContext::get_or_create_compute_pipeline(
+    const std::string &label,
+    const std::function<std::shared_ptr<ComputePipeline>()> &create) {
+    auto it = compute_pipelines.find(label);
+    if (it != compute_pipelines.end()) {
+        return it->second;
+    }
+
+    auto pipeline = create();
+    if (pipeline) {
+        compute_pipelines[label] = pipeline;
+    }
+
+    return pipeline;
+}
+
+uint64_t RendererContext::get_or_create_static_buffer(const std::string &label,
+                                                      BufferType type,
+                                                      size_t size,
+                                                      const void *data) {
+    auto it = static_buffers.find(label);
+    if (it != static_buffers.end()) {
+        return it->second;
+    }
+
+    auto buffer_id = allocator->allocate_buffer(size, type, label, BufferUsage::Static);
+
+    auto encoder = device->create_command_encoder("upload " + label);
+    encoder->write_buffer(allocator->get_buffer(buffer_id), 0, size, data);
+
+    queue->submit(encoder, nullptr);
+
+    static_buffers[label] = buffer_id;
+
+    return buffer_id;
+}
+
+} // namespace Pathfinder
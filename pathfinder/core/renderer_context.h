@@ -0,0 +1,96 @@
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../gpu/compute_pipeline.h"
+#include "../gpu/descriptor_set.h"
+#include "../gpu/device.h"
+#include "../gpu/queue.h"
+#include "../gpu/render_pass.h"
+#include "../gpu/render_pipeline.h"
+#include "../gpu_mem/allocator.h"
+#include "paint/effects.h"
+
+namespace Pathfinder {
+
+/// Device objects that don't depend on the scene, shared by all renderers created with the context.
+///
+/// Creating a canvas for an existing context skips decoding the area LUT, compiling pipelines and
+/// allocating the static textures. Renderers also share the memory allocator, so pooled memory freed by one canvas
+/// can be reused by another, and the memory budget applies to all of them.
+///
+/// Renderers sharing a context must draw on the same thread, one after the other: the metadata texture
+/// is shared as well, and each draw uploads its own metadata before using it.
+class RendererContext {
+public:
+    /// @param _compute_queue Optional queue from WindowBuilder::create_compute_queue(). The GPU-driven renderer
+    /// prepares tiles on it while the tiles of the previous batch are drawn on `_queue`.
+    RendererContext(const std::shared_ptr<Device> &_device,
+                    const std::shared_ptr<Queue> &_queue,
+                    const std::shared_ptr<Queue> &_compute_queue = nullptr);
+
+    ~RendererContext();
+
+    std::shared_ptr<Sampler> get_or_create_sampler(TextureSamplingFlags sampling_flags);
+
+    std::shared_ptr<Sampler> get_default_sampler();
+
+    /// Layouts with the same descriptors are shared.
+    std::shared_ptr<DescriptorSetLayout> get_or_create_descriptor_set_layout(
+        const std::vector<DescriptorLayout> &layouts);
+
+    /// Render passes are identified by label.
+    std::shared_ptr<RenderPass> get_or_create_render_pass(TextureFormat format,
+                                                          AttachmentLoadOp load_op,
+                                                          const std::string &label);
+
+    /// Pipelines are identified by label. `create` is only called for the first request of a label,
+    /// so shader modules should be created inside it. Null results aren't cached.
+    std::shared_ptr<RenderPipeline> get_or_create_render_pipeline(
+        const std::string &label,
+        const std::function<std::shared_ptr<RenderPipeline>()> &create);
+
+    std::shared_ptr<ComputePipeline> get_or_create_compute_pipeline(
+        const std::string &label,
+        const std::function<std::shared_ptr<ComputePipeline>()> &create);
+
+    /// Get a static buffer identified by label, uploading `data` when it's created.
+    /// @return Allocator ID of the buffer. It's freed with the context.
+    uint64_t get_or_create_static_buffer(const std::string &label, BufferType type, size_t size, const void *data);
+
+    std::shared_ptr<Device> device;
+
+    std::shared_ptr<Queue> queue;
+
+    /// Null if there's no separate compute queue.
+    std::shared_ptr<Queue> compute_queue;
+
+    std::shared_ptr<GpuMemoryAllocator> allocator;
+
+    /// Pre-Defined texture used to draw the mask texture.
+    uint64_t area_lut_texture_id;
+
+    /// For unused texture binding point.
+    uint64_t dummy_texture_id;
+
+    uint64_t metadata_texture_id;
+
+private:
+    std::vector<std::shared_ptr<Sampler>> samplers;
+
+    std::vector<std::shared_ptr<DescriptorSetLayout>> descriptor_set_layouts;
+
+    std::map<std::string, std::shared_ptr<RenderPass>> render_passes;
+
+    std::map<std::string, std::shared_ptr<RenderPipeline>> render_pipelines;
+
+    std::map<std::string, std::shared_ptr<ComputePipeline>> compute_pipelines;
+
+    std::map<std::string, uint64_t> static_buffers;
+};
+
+} // namespace Pathfinder
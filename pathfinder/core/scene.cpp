@@ -1,5 +1,8 @@
 #include "scene.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "d3d11/scene_builder.h"
 #include "d3d9/scene_builder.h"
 #include "renderer.h"
@@ -163,6 +166,73 @@ void Scene::pop_render_target() {
     display_list.push_back(item);
 }
 
+std::vector<Range> Scene::get_render_target_lifetimes() const {
+    // Render targets that are never pushed are kept alive through the whole frame.
+    std::vector<Range> lifetimes(palette.get_render_target_count(),
+                                 Range(0, std::numeric_limits<unsigned long long>::max()));
+    std::vector<bool> pushed(lifetimes.size(), false);
+
+    // Render target read by each paint, or -1.
+    std::unordered_map<uint32_t, int64_t> paint_render_targets;
+
+    auto get_paint_render_target = [&](uint32_t paint_id) {
+        auto it = paint_render_targets.find(paint_id);
+        if (it != paint_render_targets.end()) {
+            return it->second;
+        }
+
+        int64_t render_target = -1;
+
+        auto overlay = palette.get_paint(paint_id).get_overlay();
+        if (overlay && std::holds_alternative<Pattern>(overlay->contents)) {
+            const auto &pattern = std::get<Pattern>(overlay->contents);
+            if (pattern.source.type == PatternSource::Type::RenderTarget) {
+                render_target = pattern.source.render_target_id.render_target;
+            }
+        }
+
+        paint_render_targets[paint_id] = render_target;
+        return render_target;
+    };
+
+    std::vector<uint32_t> render_target_stack;
+
+    for (uint32_t item_index = 0; item_index < display_list.size(); item_index++) {
+        const auto &display_item = display_list[item_index];
+
+        switch (display_item.type) {
+            case DisplayItem::Type::PushRenderTarget: {
+                auto index = display_item.render_target_id.render_target;
+                if (index < lifetimes.size()) {
+                    lifetimes[index] = Range(item_index, item_index + 1);
+                    pushed[index] = true;
+                }
+                render_target_stack.push_back(index);
+            } break;
+            case DisplayItem::Type::PopRenderTarget: {
+                if (render_target_stack.empty()) {
+                    break;
+                }
+                auto index = render_target_stack.back();
+                render_target_stack.pop_back();
+                if (index < lifetimes.size() && pushed[index]) {
+                    lifetimes[index].end = std::max(lifetimes[index].end, (unsigned long long)item_index + 1);
+                }
+            } break;
+            case DisplayItem::Type::DrawPaths: {
+                for (auto path_index = display_item.range.start; path_index < display_item.range.end; path_index++) {
+                    auto index = get_paint_render_target(draw_paths[path_index].paint);
+                    if (index >= 0 && (size_t)index < lifetimes.size() && pushed[index]) {
+                        lifetimes[index].end = std::max(lifetimes[index].end, (unsigned long long)item_index + 1);
+                    }
+                }
+            } break;
+        }
+    }
+
+    return lifetimes;
+}
+
 RectF Scene::get_view_box() const {
     return view_box;
 }
@@ -94,6 +94,10 @@ public:
     /// targets remain on the stack, drawing goes to the main output.
     void pop_render_target();
 
+    /// Range of display items each render target is in use for, indexed by render target.
+    /// It spans from the push of the render target to its pop or the last draw path reading it, whichever is later.
+    std::vector<Range> get_render_target_lifetimes() const;
+
     /**
      * Add all elements in a scene to this one.
      * This includes draw paths, clip paths, render targets, and paints.
@@ -124,6 +124,9 @@ enum class DescriptorType {
     Sampler,
     StorageBuffer,
     Image,
+    /// A few bytes set with CommandEncoder::push_constants() instead of a bound resource.
+    /// Shaders read them as a uniform block at the binding.
+    PushConstant,
 };
 
 enum class MemoryProperty {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 
 #include "base.h"
@@ -52,4 +53,11 @@ protected:
     std::string label_;
 };
 
+/// A range of a buffer, which may be shared with other ranges.
+struct BufferRange {
+    std::shared_ptr<Buffer> buffer;
+    size_t offset = 0;
+    size_t size = 0;
+};
+
 } // namespace Pathfinder
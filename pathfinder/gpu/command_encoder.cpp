@@ -12,8 +12,8 @@ void CommandEncoder::begin_render_pass(const std::shared_ptr<RenderPass> &render
                                        const ColorF clear_color) {
     std::shared_ptr<Framebuffer> framebuffer;
     if (texture) {
-        framebuffer =
-            device_.lock()->create_framebuffer(render_pass, texture, render_pass->get_label() + " - framebuffer");
+        framebuffer = device_.lock()->get_or_create_framebuffer(
+            render_pass, texture, render_pass->get_label() + " - framebuffer");
     } else if (device_.lock()->get_backend_type() == BackendType::Opengl) {
         // GL only.
         framebuffer = device_.lock()->create_framebuffer(render_pass, nullptr, "screen framebuffer");
@@ -21,6 +21,7 @@ void CommandEncoder::begin_render_pass(const std::shared_ptr<RenderPass> &render
         throw std::runtime_error("Invalid texture when beginning a render pass");
     }
 
+    // Keep the framebuffer alive until the commands are finished, even if the device drops it from its cache.
     framebuffers_.push_back(framebuffer);
 
     Command cmd{};
@@ -202,6 +203,34 @@ void CommandEncoder::end_compute_pass() {
     commands_.push_back(cmd);
 }
 
+void CommandEncoder::push_constants(uint32_t binding, uint32_t data_size, const void *data) {
+    if (data_size == 0 || data == nullptr) {
+        Logger::error("Tried to push invalid constants!");
+        return;
+    }
+
+    if (data_size > MAX_PUSH_CONSTANT_SIZE) {
+        Logger::error("Tried to push more constants than fit into the push constant space!");
+        return;
+    }
+
+    // Backends may bind the data as uniform buffer ranges, which have to be aligned.
+    auto data_offset = push_constant_data_.size();
+    auto aligned_size = device_.lock()->get_aligned_uniform_size(data_size);
+    push_constant_data_.resize(data_offset + aligned_size);
+    memcpy(push_constant_data_.data() + data_offset, data, data_size);
+
+    Command cmd{};
+    cmd.type = CommandType::PushConstants;
+
+    auto &args = cmd.args.push_constants;
+    args.binding = binding;
+    args.data_size = data_size;
+    args.data_offset = (uint32_t)data_offset;
+
+    commands_.push_back(cmd);
+}
+
 void CommandEncoder::write_buffer(const std::shared_ptr<Buffer> &buffer,
                                   uint32_t offset,
                                   uint32_t data_size,
@@ -256,7 +285,7 @@ void CommandEncoder::read_buffer(const std::shared_ptr<Buffer> &buffer,
     auto allocation = device->allocate_staging(data_size);
 
     Command cmd{};
-    cmd.type = CommandType::WriteBuffer;
+    cmd.type = CommandType::ReadBuffer;
 
     auto &args = cmd.args.read_buffer;
     args.buffer = buffer.get();
@@ -354,6 +383,48 @@ void CommandEncoder::read_texture(const std::shared_ptr<Texture> &texture, RectI
     track_temporary_resource(allocation.buffer);
 }
 
+void CommandEncoder::memory_barrier() {
+    Command cmd{};
+    cmd.type = CommandType::MemoryBarrier;
+
+    commands_.push_back(cmd);
+}
+
+void CommandEncoder::reset_query_set(const std::shared_ptr<QuerySet> &query_set,
+                                     uint32_t first_query,
+                                     uint32_t query_count) {
+    if (first_query + query_count > query_set->get_count()) {
+        Logger::error("Tried to reset queries out of the query set range!");
+        return;
+    }
+
+    Command cmd{};
+    cmd.type = CommandType::ResetQuerySet;
+
+    auto &args = cmd.args.reset_query_set;
+    args.query_set = query_set.get();
+    args.first_query = first_query;
+    args.query_count = query_count;
+
+    commands_.push_back(cmd);
+}
+
+void CommandEncoder::write_timestamp(const std::shared_ptr<QuerySet> &query_set, uint32_t query_index) {
+    if (query_index >= query_set->get_count()) {
+        Logger::error("Tried to write a timestamp out of the query set range!");
+        return;
+    }
+
+    Command cmd{};
+    cmd.type = CommandType::WriteTimestamp;
+
+    auto &args = cmd.args.write_timestamp;
+    args.query_set = query_set.get();
+    args.query_index = query_index;
+
+    commands_.push_back(cmd);
+}
+
 void CommandEncoder::invoke_callbacks() {
     for (auto &callback : callbacks_) {
         callback();
@@ -363,6 +434,20 @@ void CommandEncoder::invoke_callbacks() {
     temp_buffers_.clear();
 }
 
+void CommandEncoder::reset() {
+    commands_.clear();
+    push_constant_data_.clear();
+    callbacks_.clear();
+    temp_buffers_.clear();
+    framebuffers_.clear();
+
+    prepared_ = false;
+    submitted_ = false;
+
+    render_pipeline_ = nullptr;
+    compute_pipeline_ = nullptr;
+}
+
 bool CommandEncoder::is_empty() const {
     return commands_.empty();
 }
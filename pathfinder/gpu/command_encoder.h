@@ -5,6 +5,7 @@
 #include <functional>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "../common/color.h"
 #include "../common/math/rect.h"
@@ -12,6 +13,7 @@
 #include "compute_pipeline.h"
 #include "descriptor_set.h"
 #include "framebuffer.h"
+#include "query_set.h"
 #include "render_pass.h"
 #include "render_pipeline.h"
 
@@ -42,6 +44,10 @@ enum class CommandType {
     DispatchIndirect,
     EndComputePass,
 
+    // SHADER CONSTANTS
+
+    PushConstants,
+
     // DATA TRANSFER
 
     WriteBuffer,
@@ -49,6 +55,15 @@ enum class CommandType {
     WriteTexture,
     ReadTexture,
 
+    // SYNCHRONIZATION
+
+    MemoryBarrier,
+
+    // QUERY
+
+    ResetQuerySet,
+    WriteTimestamp,
+
     Max,
 };
 
@@ -113,6 +128,12 @@ struct Command {
             uint32_t group_size_y;
             uint32_t group_size_z;
         } dispatch;
+        struct {
+            uint32_t binding;
+            uint32_t data_size;
+            /// Into the push constant data of the encoder.
+            uint32_t data_offset;
+        } push_constants;
         struct {
             Buffer *buffer;
             uint32_t offset;
@@ -149,15 +170,28 @@ struct Command {
             Buffer *staging_buffer;
             uint32_t staging_offset;
         } read_texture;
+        struct {
+            QuerySet *query_set;
+            uint32_t first_query;
+            uint32_t query_count;
+        } reset_query_set;
+        struct {
+            QuerySet *query_set;
+            uint32_t query_index;
+        } write_timestamp;
     } args;
 };
 
 /// Don't do any modifications to command arguments until the buffer is submitted.
 /// Maybe this command buffer will not be executed at all.
 /// Or maybe a later generated command buffer will be executed first.
+///
+/// Encoders are pooled by the device and reset before being handed out again.
 class CommandEncoder {
+    friend class Device;
     friend class QueueVk;
     friend class QueueGl;
+    friend class QueueNull;
     friend class SwapChainGl;
     friend class SwapChainVk;
 
@@ -207,6 +241,13 @@ public:
 
     void end_compute_pass();
 
+    // SHADER CONSTANTS
+
+    /// Set the data of a push constant binding for the following draws or dispatches of the pass.
+    /// Unlike a uniform buffer update, this needs no copy on the GPU and no descriptor set per value.
+    /// The data has to cover the whole uniform block. Has to be called inside a pass, after binding the pipeline.
+    void push_constants(uint32_t binding, uint32_t data_size, const void *data);
+
     // DATA TRANSFER
 
     /**
@@ -221,12 +262,31 @@ public:
                               uint32_t data_size,
                               const void *data);
 
+    /// Upload to the start of a buffer range.
+    void write_buffer(const BufferRange &range, uint32_t data_size, const void *data) {
+        write_buffer(range.buffer, range.offset, data_size, data);
+    }
+
     void read_buffer(const std::shared_ptr<Buffer> &buffer, uint32_t offset, uint32_t data_size, void *data);
 
     void write_texture(const std::shared_ptr<Texture> &texture, RectI region, const void *data);
 
     void read_texture(const std::shared_ptr<Texture> &texture, RectI region, void *data);
 
+    // SYNCHRONIZATION
+
+    /// Make the memory writes of all previous commands visible to all following commands.
+    /// Not allowed inside a render pass.
+    void memory_barrier();
+
+    // QUERY
+
+    /// Queries have to be reset before being written again. Not allowed inside a render pass.
+    void reset_query_set(const std::shared_ptr<QuerySet> &query_set, uint32_t first_query, uint32_t query_count);
+
+    /// Write a GPU timestamp once all previous commands have been executed.
+    void write_timestamp(const std::shared_ptr<QuerySet> &query_set, uint32_t query_index);
+
     void invoke_callbacks();
 
     bool is_empty() const;
@@ -238,6 +298,10 @@ protected:
     /// @return If valid for submission.
     virtual bool prepare() = 0;
 
+    /// Drop recorded commands and tracked resources so that the encoder can be reused.
+    /// Storage capacity is kept, so recording doesn't allocate once an encoder has warmed up.
+    virtual void reset();
+
     void add_callback(const std::function<void()> &callback) {
         callbacks_.push_back(callback);
     }
@@ -246,10 +310,18 @@ protected:
         temp_buffers_.push_back(buffer);
     }
 
+    const uint8_t *get_push_constant_data(const Command &cmd) const {
+        return push_constant_data_.data() + cmd.args.push_constants.data_offset;
+    }
+
     /// Debug label.
     std::string label_;
 
-    std::deque<Command> commands_;
+    /// Commands are stored contiguously with their arguments inline.
+    std::vector<Command> commands_;
+
+    /// Data of all push constant commands, each starting at an offset aligned for uniform buffers.
+    std::vector<uint8_t> push_constant_data_;
 
     /// Prepared for submission.
     bool prepared_ = false;
@@ -0,0 +1,116 @@
+#include "command_encoder.h"
+
+#include "../../common/logger.h"
+#include "../null/buffer.h"
+#include "../null/objects.h"
+#include "device.h"
+#include "texture_access.h"
+
+namespace Pathfinder {
+
+TextureNull *DrawCpu::get_texture(uint32_t binding) const {
+    auto &descriptors = descriptor_set->get_descriptors();
+    auto it = descriptors.find(binding);
+    if (it == descriptors.end()) {
+        return nullptr;
+    }
+    return static_cast<TextureNull *>(it->second.texture.get());
+}
+
+SamplerDescriptor DrawCpu::get_sampler(uint32_t binding) const {
+    auto &descriptors = descriptor_set->get_descriptors();
+    auto it = descriptors.find(binding);
+    if (it == descriptors.end() || it->second.sampler == nullptr) {
+        return {};
+    }
+    return it->second.sampler->get_descriptor();
+}
+
+const uint8_t *DrawCpu::get_uniform(uint32_t binding) const {
+    if (push_constants) {
+        auto pushed = push_constants->find(binding);
+        if (pushed != push_constants->end()) {
+            return pushed->second;
+        }
+    }
+
+    auto &descriptors = descriptor_set->get_descriptors();
+    auto it = descriptors.find(binding);
+    if (it == descriptors.end() || it->second.buffer == nullptr) {
+        return nullptr;
+    }
+    return static_cast<BufferNull *>(it->second.buffer.get())->get_data() + it->second.buffer_offset;
+}
+
+void CommandEncoderCpu::execute_begin_render_pass(RenderPass *render_pass,
+                                                  Framebuffer *framebuffer,
+                                                  ColorF clear_color) {
+    auto texture = static_cast<TextureNull *>(framebuffer->get_texture().get());
+    if (texture == nullptr) {
+        return;
+    }
+
+    if (render_pass->get_attachment_load_op() == AttachmentLoadOp::Clear) {
+        clear_texture(*texture, clear_color);
+    }
+}
+
+void CommandEncoderCpu::execute_draw(const Command &cmd, const DrawStateNull &state) {
+    auto device = std::static_pointer_cast<DeviceCpu>(device_.lock());
+    auto texture = static_cast<TextureNull *>(state.framebuffer->get_texture().get());
+    if (device == nullptr || texture == nullptr || state.descriptor_set == nullptr) {
+        return;
+    }
+
+    auto program = device->get_render_program(state.pipeline->get_label());
+    if (program == nullptr) {
+        Logger::warn("No render program for pipeline " + state.pipeline->get_label() + ", skipping its draws.",
+                     "CommandEncoderCpu");
+        return;
+    }
+
+    DrawCpu draw;
+
+    switch (cmd.type) {
+        case CommandType::Draw: {
+            draw.first_vertex = cmd.args.draw.first_vertex;
+            draw.vertex_count = cmd.args.draw.vertex_count;
+        } break;
+        case CommandType::DrawInstanced: {
+            draw.vertex_count = cmd.args.draw_instanced.vertex_count;
+            draw.instance_count = cmd.args.draw_instanced.instance_count;
+        } break;
+        default: {
+            Logger::warn("Indexed and indirect draws aren't supported, skipping.", "CommandEncoderCpu");
+            return;
+        }
+    }
+
+    draw.target = texture;
+    draw.descriptor_set = state.descriptor_set;
+    draw.push_constants = &state.push_constants;
+    draw.viewport = state.viewport;
+    draw.thread_count = device->get_thread_count();
+
+    draw.vertex_buffer_count = state.vertex_buffer_count;
+    for (uint32_t i = 0; i < state.vertex_buffer_count; i++) {
+        auto buffer = static_cast<BufferNull *>(state.vertex_buffers[i]);
+        draw.vertex_data[i] = buffer->get_data() + state.vertex_buffer_offsets[i];
+    }
+
+    // Memory is allocated on first access, which isn't thread-safe. Do it before programs spread over threads.
+    texture->get_data();
+    for (const auto &it : state.descriptor_set->get_descriptors()) {
+        auto &descriptor = it.second;
+        if (descriptor.texture) {
+            static_cast<TextureNull *>(descriptor.texture.get())->get_data();
+        }
+        if (descriptor.buffer) {
+            static_cast<BufferNull *>(descriptor.buffer.get())->get_data();
+        }
+    }
+
+    program->draw(draw);
+}
+
+} // namespace Pathfinder
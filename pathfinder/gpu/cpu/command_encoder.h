@@ -0,0 +1,19 @@
+#pragma once
+
+#include "../null/command_encoder.h"
+
+namespace Pathfinder {
+
+/// Executes draws with the render programs registered to the device, on top of what the null encoder does.
+class CommandEncoderCpu : public CommandEncoderNull {
+    friend class DeviceCpu;
+
+private:
+    explicit CommandEncoderCpu(const std::shared_ptr<NullDeviceStats> &stats) : CommandEncoderNull(stats) {}
+
+    void execute_begin_render_pass(RenderPass *render_pass, Framebuffer *framebuffer, ColorF clear_color) override;
+
+    void execute_draw(const Command &cmd, const DrawStateNull &state) override;
+};
+
+} // namespace Pathfinder
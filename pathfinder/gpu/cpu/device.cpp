@@ -0,0 +1,36 @@
+#include "device.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "command_encoder.h"
+
+namespace Pathfinder {
+
+DeviceCpu::DeviceCpu(int frames_in_flight, uint32_t thread_count) : DeviceNull(frames_in_flight) {
+    backend_type = BackendType::Cpu;
+
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    thread_count_ = thread_count;
+}
+
+std::shared_ptr<CommandEncoder> DeviceCpu::allocate_command_encoder() {
+    return std::shared_ptr<CommandEncoderCpu>(new CommandEncoderCpu(stats_));
+}
+
+void DeviceCpu::register_render_program(const std::string &pipeline_label,
+                                        const std::shared_ptr<RenderProgramCpu> &program) {
+    render_programs_[pipeline_label] = program;
+}
+
+std::shared_ptr<RenderProgramCpu> DeviceCpu::get_render_program(const std::string &pipeline_label) const {
+    auto it = render_programs_.find(pipeline_label);
+    if (it == render_programs_.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+} // namespace Pathfinder
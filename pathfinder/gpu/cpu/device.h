@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "../null/device.h"
+#include "render_program.h"
+
+namespace Pathfinder {
+
+/// A software device. It behaves like the null device, except that draws are executed on the CPU by the render
+/// programs registered for their pipelines, so render targets hold real images that can be read back.
+///
+/// Renderers register a program for each of their pipelines when they find this backend.
+/// Draws of pipelines without a program are skipped with a warning.
+class DeviceCpu : public DeviceNull {
+public:
+    /// Zero threads means one per hardware thread.
+    explicit DeviceCpu(int frames_in_flight, uint32_t thread_count = 0);
+
+    std::shared_ptr<CommandEncoder> allocate_command_encoder() override;
+
+    void register_render_program(const std::string &pipeline_label, const std::shared_ptr<RenderProgramCpu> &program);
+
+    /// Returns nullptr if no program is registered for the pipeline.
+    std::shared_ptr<RenderProgramCpu> get_render_program(const std::string &pipeline_label) const;
+
+    uint32_t get_thread_count() const {
+        return thread_count_;
+    }
+
+private:
+    uint32_t thread_count_;
+
+    std::unordered_map<std::string, std::shared_ptr<RenderProgramCpu>> render_programs_;
+};
+
+} // namespace Pathfinder
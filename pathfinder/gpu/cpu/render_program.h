@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+
+#include "../command_encoder.h"
+#include "../descriptor_set.h"
+#include "../null/texture.h"
+
+namespace Pathfinder {
+
+/// Everything a draw reads and writes on the CPU device. Memory of all bound resources is allocated beforehand,
+/// so programs may access it from several threads.
+struct DrawCpu {
+    TextureNull *target = nullptr;
+    DescriptorSet *descriptor_set = nullptr;
+
+    /// Data pushed for the draw, by binding.
+    const std::map<uint32_t, const uint8_t *> *push_constants = nullptr;
+
+    /// Bound vertex buffers, offsets applied.
+    uint32_t vertex_buffer_count = 0;
+    std::array<const uint8_t *, MAX_VERTEX_BUFFER_BINDINGS> vertex_data{};
+
+    RectI viewport;
+
+    uint32_t first_vertex = 0;
+    uint32_t vertex_count = 0;
+    uint32_t instance_count = 1;
+
+    /// Upper bound of threads a program should use.
+    uint32_t thread_count = 1;
+
+    /// Returns nullptr if nothing is bound at the binding.
+    TextureNull *get_texture(uint32_t binding) const;
+
+    SamplerDescriptor get_sampler(uint32_t binding) const;
+
+    /// Pushed constants, or the bound uniform buffer.
+    /// Returns nullptr if there's neither at the binding.
+    const uint8_t *get_uniform(uint32_t binding) const;
+};
+
+/// Runs the draws of one render pipeline on the CPU, in place of its shaders.
+/// Programs are registered to DeviceCpu by pipeline label.
+class RenderProgramCpu {
+public:
+    virtual ~RenderProgramCpu() = default;
+
+    virtual void draw(const DrawCpu &draw) = 0;
+};
+
+} // namespace Pathfinder
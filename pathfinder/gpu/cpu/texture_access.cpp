@@ -0,0 +1,146 @@
+#include "texture_access.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <umHalf.h>
+
+namespace Pathfinder {
+
+namespace {
+
+inline float unorm8_to_f32(uint8_t value) {
+    return value * (1.0f / 255.0f);
+}
+
+inline uint8_t f32_to_unorm8(float value) {
+    return (uint8_t)(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+inline int32_t apply_address_mode(int32_t i, int32_t size, SamplerAddressMode mode) {
+    switch (mode) {
+        case SamplerAddressMode::Repeat: {
+            i %= size;
+            return i < 0 ? i + size : i;
+        }
+        case SamplerAddressMode::MirroredRepeat: {
+            int32_t period = size * 2;
+            i %= period;
+            i = i < 0 ? i + period : i;
+            return i < size ? i : period - 1 - i;
+        }
+        default:
+            return std::clamp(i, 0, size - 1);
+    }
+}
+
+} // namespace
+
+F32x4 load_texel(TextureNull &texture, Vec2I coord) {
+    auto format = texture.get_format();
+    size_t index = (size_t)coord.y * texture.get_size().x + coord.x;
+    auto texel = texture.get_data() + index * get_pixel_size(format);
+
+    switch (format) {
+        case TextureFormat::R8:
+            return {unorm8_to_f32(texel[0]), 0, 0, 1};
+        case TextureFormat::Rg8:
+            return {unorm8_to_f32(texel[0]), unorm8_to_f32(texel[1]), 0, 1};
+        case TextureFormat::Bgra8Unorm:
+        case TextureFormat::Bgra8Srgb:
+            return {unorm8_to_f32(texel[2]), unorm8_to_f32(texel[1]), unorm8_to_f32(texel[0]), unorm8_to_f32(texel[3])};
+        case TextureFormat::Rgba16Float: {
+            auto halves = (const half *)texel;
+            return {halves[0], halves[1], halves[2], halves[3]};
+        }
+        default:
+            return {unorm8_to_f32(texel[0]), unorm8_to_f32(texel[1]), unorm8_to_f32(texel[2]), unorm8_to_f32(texel[3])};
+    }
+}
+
+void store_texel(TextureNull &texture, Vec2I coord, const F32x4 &color) {
+    auto format = texture.get_format();
+    size_t index = (size_t)coord.y * texture.get_size().x + coord.x;
+    auto texel = texture.get_data() + index * get_pixel_size(format);
+
+    switch (format) {
+        case TextureFormat::R8: {
+            texel[0] = f32_to_unorm8(color.get<0>());
+        } break;
+        case TextureFormat::Rg8: {
+            texel[0] = f32_to_unorm8(color.get<0>());
+            texel[1] = f32_to_unorm8(color.get<1>());
+        } break;
+        case TextureFormat::Bgra8Unorm:
+        case TextureFormat::Bgra8Srgb: {
+            texel[0] = f32_to_unorm8(color.get<2>());
+            texel[1] = f32_to_unorm8(color.get<1>());
+            texel[2] = f32_to_unorm8(color.get<0>());
+            texel[3] = f32_to_unorm8(color.get<3>());
+        } break;
+        case TextureFormat::Rgba16Float: {
+            auto halves = (half *)texel;
+            halves[0] = color.get<0>();
+            halves[1] = color.get<1>();
+            halves[2] = color.get<2>();
+            halves[3] = color.get<3>();
+        } break;
+        default: {
+            texel[0] = f32_to_unorm8(color.get<0>());
+            texel[1] = f32_to_unorm8(color.get<1>());
+            texel[2] = f32_to_unorm8(color.get<2>());
+            texel[3] = f32_to_unorm8(color.get<3>());
+        } break;
+    }
+}
+
+F32x4 sample_texture(TextureNull &texture, const SamplerDescriptor &sampler, Vec2F uv) {
+    auto size = texture.get_size();
+
+    // Magnification and minification can't be told apart without derivatives, so the filters have to agree.
+    if (sampler.mag_filter == SamplerFilter::Nearest) {
+        auto coord = Vec2I((int32_t)std::floor(uv.x * size.x), (int32_t)std::floor(uv.y * size.y));
+        coord.x = apply_address_mode(coord.x, size.x, sampler.address_mode_u);
+        coord.y = apply_address_mode(coord.y, size.y, sampler.address_mode_v);
+        return load_texel(texture, coord);
+    }
+
+    float x = uv.x * size.x - 0.5f;
+    float y = uv.y * size.y - 0.5f;
+
+    float x_floor = std::floor(x), y_floor = std::floor(y);
+    float fx = x - x_floor, fy = y - y_floor;
+
+    int32_t x0 = apply_address_mode((int32_t)x_floor, size.x, sampler.address_mode_u);
+    int32_t x1 = apply_address_mode((int32_t)x_floor + 1, size.x, sampler.address_mode_u);
+    int32_t y0 = apply_address_mode((int32_t)y_floor, size.y, sampler.address_mode_v);
+    int32_t y1 = apply_address_mode((int32_t)y_floor + 1, size.y, sampler.address_mode_v);
+
+    auto top_left = load_texel(texture, {x0, y0});
+    auto top_right = load_texel(texture, {x1, y0});
+    auto bottom_left = load_texel(texture, {x0, y1});
+    auto bottom_right = load_texel(texture, {x1, y1});
+
+    auto top = top_left + (top_right - top_left) * F32x4::splat(fx);
+    auto bottom = bottom_left + (bottom_right - bottom_left) * F32x4::splat(fx);
+
+    return top + (bottom - top) * F32x4::splat(fy);
+}
+
+void clear_texture(TextureNull &texture, const ColorF &color) {
+    auto size = texture.get_size();
+    if (size.area() == 0) {
+        return;
+    }
+
+    // Encode the color once, then keep doubling the filled part.
+    store_texel(texture, {0, 0}, F32x4(color.r_, color.g_, color.b_, color.a_));
+
+    auto data = texture.get_data();
+    size_t byte_size = (size_t)size.area() * get_pixel_size(texture.get_format());
+    for (size_t filled = get_pixel_size(texture.get_format()); filled < byte_size; filled *= 2) {
+        memcpy(data + filled, data, std::min(filled, byte_size - filled));
+    }
+}
+
+} // namespace Pathfinder
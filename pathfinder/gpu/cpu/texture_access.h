@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../../common/color.h"
+#include "../../common/f32x4.h"
+#include "../../common/math/vec2.h"
+#include "../null/texture.h"
+
+namespace Pathfinder {
+
+/// Texel access for textures in host memory. Colors are converted to and from normalized RGBA floats the way
+/// a GPU does it.
+
+/// The texel must be inside the texture.
+F32x4 load_texel(TextureNull &texture, Vec2I coord);
+
+/// The texel must be inside the texture. Values are clamped for unorm formats.
+void store_texel(TextureNull &texture, Vec2I coord, const F32x4 &color);
+
+/// Sample with the filter and address modes of the sampler. Texel centers are at half-integer coordinates.
+F32x4 sample_texture(TextureNull &texture, const SamplerDescriptor &sampler, Vec2F uv);
+
+void clear_texture(TextureNull &texture, const ColorF &color);
+
+} // namespace Pathfinder
@@ -11,15 +11,30 @@
 
 namespace Pathfinder {
 
+/// Guaranteed push constant space on Vulkan.
+constexpr uint32_t MAX_PUSH_CONSTANT_SIZE = 128;
+
 struct DescriptorLayout {
     uint32_t binding{};
     ShaderStage stage{};
     DescriptorType type{};
+
+    /// Size of the uniform block, for push constants only.
+    uint32_t size{};
+
+    bool operator==(const DescriptorLayout& other) const {
+        return binding == other.binding && stage == other.stage && type == other.type && size == other.size;
+    }
+
+    static DescriptorLayout push_constant(uint32_t binding, ShaderStage stage, uint32_t size) {
+        return DescriptorLayout{binding, stage, DescriptorType::PushConstant, size};
+    }
 };
 
 class DescriptorSetLayout {
     friend class DeviceGl;
     friend class DeviceMtl;
+    friend class DeviceNull;
 
 public:
     virtual ~DescriptorSetLayout() = default;
@@ -91,6 +106,10 @@ struct Descriptor {
         return desc;
     }
 
+    static Descriptor uniform(uint32_t binding, const BufferRange& range) {
+        return uniform(binding, range.buffer, range.offset, range.size);
+    }
+
     static Descriptor sampled(uint32_t binding,
                               const std::shared_ptr<Texture>& texture = nullptr,
                               const std::shared_ptr<Sampler>& sampler = nullptr) {
@@ -139,6 +158,7 @@ struct Descriptor {
 class DescriptorSet {
     friend class DeviceGl;
     friend class DeviceMtl;
+    friend class DeviceNull;
 
 public:
     virtual ~DescriptorSet() = default;
@@ -0,0 +1,88 @@
+#include "descriptor_set_cache.h"
+
+#include <functional>
+
+namespace Pathfinder {
+
+static void hash_combine(size_t &seed, size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+static size_t hash_descriptor(const Descriptor &descriptor) {
+    size_t seed = 0;
+    hash_combine(seed, descriptor.binding);
+    hash_combine(seed, (size_t)descriptor.type);
+    hash_combine(seed, std::hash<Buffer *>()(descriptor.buffer.get()));
+    hash_combine(seed, descriptor.buffer_offset);
+    hash_combine(seed, descriptor.buffer_range);
+    hash_combine(seed, std::hash<Texture *>()(descriptor.texture.get()));
+    hash_combine(seed, std::hash<Sampler *>()(descriptor.sampler.get()));
+    return seed;
+}
+
+static bool matches(const DescriptorSet &descriptor_set, const std::vector<Descriptor> &descriptors) {
+    const auto &set_descriptors = descriptor_set.get_descriptors();
+
+    if (set_descriptors.size() != descriptors.size()) {
+        return false;
+    }
+
+    for (const auto &descriptor : descriptors) {
+        auto it = set_descriptors.find(descriptor.binding);
+        if (it == set_descriptors.end() || it->second != descriptor) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t DescriptorSetCache::hash(const DescriptorSetLayout *layout, const std::vector<Descriptor> &descriptors) {
+    // Descriptors are summed up, so the order they are given in doesn't matter.
+    size_t descriptor_sum = 0;
+    for (const auto &descriptor : descriptors) {
+        descriptor_sum += hash_descriptor(descriptor);
+    }
+
+    size_t seed = std::hash<const DescriptorSetLayout *>()(layout);
+    hash_combine(seed, descriptor_sum);
+    return seed;
+}
+
+std::shared_ptr<DescriptorSet> DescriptorSetCache::find(const std::shared_ptr<DescriptorSetLayout> &layout,
+                                                        const std::vector<Descriptor> &descriptors,
+                                                        uint32_t frame_index) {
+    auto range = entries_.equal_range(hash(layout.get(), descriptors));
+
+    for (auto it = range.first; it != range.second; ++it) {
+        auto &entry = it->second;
+
+        if (entry.descriptor_set->get_layout() == layout && matches(*entry.descriptor_set, descriptors)) {
+            entry.last_used_frame = frame_index;
+            return entry.descriptor_set;
+        }
+    }
+
+    return nullptr;
+}
+
+void DescriptorSetCache::insert(const std::shared_ptr<DescriptorSet> &descriptor_set, uint32_t frame_index) {
+    std::vector<Descriptor> descriptors;
+    for (const auto &pair : descriptor_set->get_descriptors()) {
+        descriptors.push_back(pair.second);
+    }
+
+    entries_.emplace(hash(descriptor_set->get_layout().get(), descriptors), Entry{descriptor_set, frame_index});
+}
+
+void DescriptorSetCache::evict(uint32_t frame_index, uint32_t max_unused_frames) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (frame_index - it->second.last_used_frame > max_unused_frames) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "descriptor_set.h"
+
+namespace Pathfinder {
+
+/// Descriptor sets keyed by their layout and bound resources.
+///
+/// A cached set is never updated after creation, so it's safe to bind it again while earlier frames
+/// using it are still in flight. Sets that haven't been used for a while are dropped.
+class DescriptorSetCache {
+public:
+    /// @return Null if no cached set has the given layout and descriptors.
+    std::shared_ptr<DescriptorSet> find(const std::shared_ptr<DescriptorSetLayout> &layout,
+                                        const std::vector<Descriptor> &descriptors,
+                                        uint32_t frame_index);
+
+    void insert(const std::shared_ptr<DescriptorSet> &descriptor_set, uint32_t frame_index);
+
+    /// Drop the sets that haven't been used for more than `max_unused_frames` frames.
+    void evict(uint32_t frame_index, uint32_t max_unused_frames);
+
+    size_t get_size() const {
+        return entries_.size();
+    }
+
+private:
+    struct Entry {
+        std::shared_ptr<DescriptorSet> descriptor_set;
+        uint32_t last_used_frame = 0;
+    };
+
+    static size_t hash(const DescriptorSetLayout *layout, const std::vector<Descriptor> &descriptors);
+
+    std::unordered_multimap<size_t, Entry> entries_;
+};
+
+} // namespace Pathfinder
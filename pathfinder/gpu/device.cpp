@@ -1,58 +1,247 @@
 #include "device.h"
 
+#include <algorithm>
+
+#include "../common/math/basic.h"
+
 namespace Pathfinder {
 
-StagingAllocation Device::allocate_staging(size_t size) {
-    if (size > STAGING_BLOCK_SIZE) {
-        auto buffer = create_staging_buffer(size);
+// Cached descriptor sets unused for this many frames are dropped.
+// Must be at least the number of frames in flight, as those frames may still use them.
+constexpr uint32_t MAX_UNUSED_DESCRIPTOR_SET_FRAMES = 8;
+
+// Cached framebuffers unused for this many frames are dropped, even if their texture is still alive.
+constexpr uint32_t MAX_UNUSED_FRAMEBUFFER_FRAMES = 60;
+
+// The staging ring starts at this size and doubles whenever it runs out of space.
+constexpr size_t INITIAL_STAGING_RING_SIZE = 4 * 1024 * 1024;
+constexpr size_t MAX_STAGING_RING_SIZE = 64 * 1024 * 1024;
+
+// Larger allocations, e.g. whole images, get a pooled buffer of their own so that they don't make the ring grow.
+constexpr size_t MAX_RING_STAGING_ALLOCATION_SIZE = 1024 * 1024;
+
+// Covers texel sizes and copy offset alignments on all backends.
+constexpr size_t STAGING_ALIGNMENT = 16;
+
+// Total size of the pooled large staging buffers, and how long an unused one is kept.
+constexpr size_t MAX_STAGING_POOL_SIZE = 64 * 1024 * 1024;
+constexpr uint32_t MAX_UNUSED_STAGING_BUFFER_FRAMES = 60;
+
+// Free pooled command encoders unused for this many frames are dropped.
+constexpr uint32_t MAX_UNUSED_COMMAND_ENCODER_FRAMES = 60;
+
+void Device::begin_frame() {
+    current_frame_index_++;
+
+    staging_stats_.last_frame_bytes = current_frame_staging_bytes_;
+    staging_stats_.last_frame_stalls = current_frame_staging_stalls_;
+    staging_stats_.total_stalls += current_frame_staging_stalls_;
+    current_frame_staging_bytes_ = 0;
+    current_frame_staging_stalls_ = 0;
 
-        StagingAllocation alloc;
-        alloc.buffer = buffer;
-        alloc.offset = 0;
-        alloc.data_size = size;
-        alloc.mapped_ptr = nullptr;
-        return alloc;
+    // Frames that began frames_in_flight_ frames ago have finished on the GPU.
+    staging_ring_.retire(current_frame_index_ - frames_in_flight_);
+
+    for (auto it = staging_pool_.begin(); it != staging_pool_.end();) {
+        if (current_frame_index_ - it->last_used_frame > MAX_UNUSED_STAGING_BUFFER_FRAMES) {
+            staging_pool_size_ -= it->buffer->get_size();
+            it = staging_pool_.erase(it);
+        } else {
+            ++it;
+        }
     }
 
-    auto &bucket = staging_buckets_[current_frame_index_ % frames_in_flight_];
+    descriptor_set_cache_.evict(current_frame_index_, std::max(MAX_UNUSED_DESCRIPTOR_SET_FRAMES, frames_in_flight_));
 
-    for (auto &block : bucket.blocks) {
-        size_t aligned_offset = (block.used_size + 15) & ~15;
+    evict_framebuffers();
 
-        if (aligned_offset + size <= STAGING_BLOCK_SIZE) {
-            StagingAllocation alloc;
-            alloc.buffer = block.buffer;
-            alloc.offset = aligned_offset;
-            alloc.data_size = size;
-            alloc.mapped_ptr = nullptr;
+    recycle_command_encoders();
+}
 
-            block.used_size = aligned_offset + size;
-            return alloc;
+void Device::set_pipeline_cache_directory(const std::string &directory) {
+    pipeline_cache_ = std::make_shared<PipelineCache>(directory, get_device_identity());
+}
+
+std::shared_ptr<CommandEncoder> Device::create_command_encoder(const std::string &label) {
+    for (auto &pooled : command_encoder_pool_) {
+        if (pooled.encoder.use_count() == 1) {
+            pooled.encoder->reset();
+            pooled.encoder->label_ = label;
+            pooled.last_used_frame = current_frame_index_;
+            return pooled.encoder;
         }
     }
 
-    auto buffer = create_staging_buffer(STAGING_BLOCK_SIZE);
+    auto encoder = allocate_command_encoder();
+    encoder->label_ = label;
+    encoder->device_ = shared_from_this();
+
+    command_encoder_pool_.push_back({encoder, current_frame_index_});
 
-    StagingBlock new_block;
-    new_block.buffer = buffer;
-    new_block.used_size = size;
-    bucket.blocks.push_back(new_block);
+    return encoder;
+}
+
+void Device::recycle_command_encoders() {
+    for (auto it = command_encoder_pool_.begin(); it != command_encoder_pool_.end();) {
+        if (it->encoder.use_count() > 1) {
+            ++it;
+            continue;
+        }
+
+        if (current_frame_index_ - it->last_used_frame > MAX_UNUSED_COMMAND_ENCODER_FRAMES) {
+            it = command_encoder_pool_.erase(it);
+            continue;
+        }
+
+        // Release the resources it kept alive for the GPU.
+        it->encoder->reset();
+        ++it;
+    }
+}
+
+std::shared_ptr<Framebuffer> Device::get_or_create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
+                                                               const std::shared_ptr<Texture> &texture,
+                                                               const std::string &label) {
+    auto key = std::make_pair(render_pass.get(), texture.get());
+
+    auto it = framebuffer_cache_.find(key);
+    if (it != framebuffer_cache_.end()) {
+        // A different render pass may have been created at the address of a released one.
+        if (it->second.render_pass.lock() == render_pass) {
+            it->second.last_used_frame = current_frame_index_;
+            return it->second.framebuffer;
+        }
+        framebuffer_cache_.erase(it);
+    }
+
+    auto framebuffer = create_framebuffer(render_pass, texture, label);
+
+    framebuffer_cache_[key] = CachedFramebuffer{framebuffer, render_pass, current_frame_index_};
+
+    return framebuffer;
+}
+
+void Device::evict_framebuffers() {
+    // A texture may be used with several render passes.
+    std::map<const Texture *, long> cached_texture_references;
+    for (auto &pair : framebuffer_cache_) {
+        cached_texture_references[pair.first.second]++;
+    }
+
+    for (auto it = framebuffer_cache_.begin(); it != framebuffer_cache_.end();) {
+        auto &cached = it->second;
+
+        // Only cached framebuffers reference the texture, so it has been released everywhere else.
+        // Command encoders still using the framebuffer keep their own reference to it.
+        auto texture = cached.framebuffer->get_texture();
+        bool texture_released = texture.use_count() - 1 <= cached_texture_references[texture.get()];
+
+        if (texture_released || cached.render_pass.expired() ||
+            current_frame_index_ - cached.last_used_frame > MAX_UNUSED_FRAMEBUFFER_FRAMES) {
+            it = framebuffer_cache_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::shared_ptr<DescriptorSet> Device::get_or_create_descriptor_set(
+    const std::shared_ptr<DescriptorSetLayout> &layout,
+    const std::vector<Descriptor> &descriptors) {
+    auto descriptor_set = descriptor_set_cache_.find(layout, descriptors, current_frame_index_);
+    if (descriptor_set) {
+        return descriptor_set;
+    }
+
+    descriptor_set = create_descriptor_set(layout);
+    descriptor_set->add_or_update(descriptors);
+
+    descriptor_set_cache_.insert(descriptor_set, current_frame_index_);
+
+    return descriptor_set;
+}
+
+StagingAllocation Device::allocate_staging(size_t size, size_t alignment) {
+    current_frame_staging_bytes_ += size;
+
+    // Pooled buffers are used from the start.
+    if (size > MAX_RING_STAGING_ALLOCATION_SIZE) {
+        return allocate_pooled_staging(size);
+    }
+
+    alignment = std::max(alignment, STAGING_ALIGNMENT);
+
+    size_t offset = 0;
+
+    if (staging_ring_buffer_ == nullptr ||
+        !staging_ring_.allocate(size, alignment, current_frame_index_, offset)) {
+        // Rather than waiting for a frame to retire, move on to a new buffer. The old one is kept alive
+        // by the command encoders still referencing it.
+        if (staging_ring_buffer_ != nullptr) {
+            current_frame_staging_stalls_++;
+        }
+
+        size_t capacity = INITIAL_STAGING_RING_SIZE;
+        if (staging_ring_buffer_ != nullptr) {
+            capacity = std::min(staging_ring_.get_capacity() * 2, MAX_STAGING_RING_SIZE);
+        }
+
+        staging_ring_buffer_ = create_staging_buffer(capacity);
+        staging_ring_.reset(capacity);
+        staging_ring_.allocate(size, alignment, current_frame_index_, offset);
+    }
+
+    StagingAllocation alloc;
+    alloc.buffer = staging_ring_buffer_;
+    alloc.offset = offset;
+    alloc.data_size = size;
+    alloc.mapped_ptr = nullptr;
+
+    return alloc;
+}
+
+StagingAllocation Device::allocate_pooled_staging(size_t size) {
+    size_t buffer_size = upper_power_of_two(size);
 
     StagingAllocation alloc;
-    alloc.buffer = buffer;
     alloc.offset = 0;
     alloc.data_size = size;
     alloc.mapped_ptr = nullptr;
 
+    for (auto &pooled : staging_pool_) {
+        if (pooled.buffer->get_size() == buffer_size &&
+            current_frame_index_ - pooled.last_used_frame >= frames_in_flight_) {
+            pooled.last_used_frame = current_frame_index_;
+            alloc.buffer = pooled.buffer;
+            return alloc;
+        }
+    }
+
+    alloc.buffer = create_staging_buffer(buffer_size);
+
+    // Past the limit, the buffer is released once the GPU is done with it, as before pooling.
+    if (staging_pool_size_ + buffer_size <= MAX_STAGING_POOL_SIZE) {
+        staging_pool_.push_back({alloc.buffer, current_frame_index_});
+        staging_pool_size_ += buffer_size;
+    }
+
     return alloc;
 }
 
 void Device::reset_staging() {
-    for (auto &bucket : staging_buckets_) {
-        for (auto &block : bucket.blocks) {
-            block.used_size = 0;
-        }
+    staging_ring_.reset(staging_ring_.get_capacity());
+
+    for (auto &pooled : staging_pool_) {
+        pooled.last_used_frame = current_frame_index_ - frames_in_flight_;
     }
 }
 
+StagingStats Device::get_staging_stats() const {
+    auto stats = staging_stats_;
+    stats.ring_capacity = staging_ring_buffer_ ? staging_ring_.get_capacity() : 0;
+    stats.pooled_buffer_count = staging_pool_.size();
+    stats.pooled_bytes = staging_pool_size_;
+    return stats;
+}
+
 } // namespace Pathfinder
\ No newline at end of file
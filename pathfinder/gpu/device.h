@@ -1,15 +1,21 @@
 #pragma once
 
+#include <map>
+
 #include "../common/logger.h"
 #include "buffer.h"
 #include "command_encoder.h"
 #include "compute_pipeline.h"
+#include "descriptor_set_cache.h"
 #include "fence.h"
 #include "framebuffer.h"
+#include "pipeline_cache.h"
+#include "query_set.h"
 #include "render_pass.h"
 #include "render_pipeline.h"
 #include "shader.h"
 #include "shader_module.h"
+#include "staging_ring.h"
 
 namespace Pathfinder {
 
@@ -17,6 +23,26 @@ enum class BackendType {
     Opengl,
     Vulkan,
     Metal,
+    /// Records commands without a GPU. See DeviceNull.
+    Null,
+    /// Renders in software. See DeviceCpu.
+    Cpu,
+};
+
+/// Staging memory usage.
+struct StagingStats {
+    /// Bytes staged during the last finished frame.
+    size_t last_frame_bytes = 0;
+
+    /// Times the staging ring ran out of space and had to grow instead of waiting for a frame to retire.
+    uint32_t last_frame_stalls = 0;
+    uint64_t total_stalls = 0;
+
+    size_t ring_capacity = 0;
+
+    /// Large allocations are served by a pool of dedicated buffers.
+    size_t pooled_buffer_count = 0;
+    size_t pooled_bytes = 0;
 };
 
 /// We only need to provide a Driver to Canvas for rendering,
@@ -29,19 +55,41 @@ public:
                                                             const std::shared_ptr<Texture> &texture,
                                                             const std::string &label) = 0;
 
+    /// Get a framebuffer for rendering to the texture with the render pass.
+    /// Framebuffers are cached per (render pass, texture), and dropped once the texture or render pass is released
+    /// elsewhere, or after going unused for a while.
+    std::shared_ptr<Framebuffer> get_or_create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
+                                                           const std::shared_ptr<Texture> &texture,
+                                                           const std::string &label);
+
     virtual std::shared_ptr<Buffer> create_buffer(const BufferDescriptor &desc, const std::string &label) = 0;
 
+    /// Create a host-visible buffer whose ranges are only rewritten once the frame that last used them has
+    /// finished, i.e. frames_in_flight frames later. Backends may keep such buffers mapped.
+    virtual std::shared_ptr<Buffer> create_streaming_buffer(const BufferDescriptor &desc, const std::string &label) {
+        return create_buffer(desc, label);
+    }
+
     virtual std::shared_ptr<Texture> create_texture(const TextureDescriptor &desc, const std::string &label) = 0;
 
     virtual std::shared_ptr<Sampler> create_sampler(SamplerDescriptor descriptor) = 0;
 
-    virtual std::shared_ptr<CommandEncoder> create_command_encoder(const std::string &label) = 0;
+    /// Get a command encoder from the pool, or create one if none is free.
+    /// An encoder is free once only the pool references it, i.e. it's been dropped by the caller and released by the
+    /// queue after finishing on the GPU.
+    std::shared_ptr<CommandEncoder> create_command_encoder(const std::string &label);
 
     virtual std::shared_ptr<DescriptorSetLayout> create_descriptor_set_layout(
         const std::vector<DescriptorLayout> &descriptors) = 0;
 
     virtual std::shared_ptr<DescriptorSet> create_descriptor_set(std::shared_ptr<DescriptorSetLayout> layout) = 0;
 
+    /// Get a descriptor set holding exactly the given descriptors.
+    /// Sets are cached by layout and bound resources, and reused across frames.
+    /// The returned set is shared, so it must not be updated.
+    std::shared_ptr<DescriptorSet> get_or_create_descriptor_set(const std::shared_ptr<DescriptorSetLayout> &layout,
+                                                                const std::vector<Descriptor> &descriptors);
+
     virtual std::shared_ptr<RenderPass> create_render_pass(TextureFormat format,
                                                            AttachmentLoadOp load_op,
                                                            const std::string &label) = 0;
@@ -72,7 +120,24 @@ public:
 
     virtual std::shared_ptr<Fence> create_fence(const std::string &label) = 0;
 
-    StagingAllocation allocate_staging(size_t size);
+    /// Create a set of timestamp queries.
+    /// @return Null if the device doesn't support timestamp queries.
+    virtual std::shared_ptr<QuerySet> create_timestamp_query_set(uint32_t count, const std::string &label) {
+        return nullptr;
+    }
+
+    /// Keep compiled pipelines in `directory` and reuse them in later runs instead of compiling them again.
+    /// Only pipelines created afterwards are affected, so set it before creating the canvas.
+    virtual void set_pipeline_cache_directory(const std::string &directory);
+
+    /// Write pipelines compiled since the last save to the cache directory, if any.
+    /// Backends that don't store pipelines as soon as they're created also do this when destroyed.
+    virtual void save_pipeline_cache() {}
+
+    /// Small allocations come from a ring that's reclaimed as frames retire. Large ones get a pooled buffer.
+    /// Either way, the memory must not be used after frames_in_flight_ more frames have begun.
+    /// @param alignment Required alignment of the offset, if stricter than the default. Has to be a power of two.
+    StagingAllocation allocate_staging(size_t size, size_t alignment = 0);
 
     virtual void *map_staging(const StagingAllocation &allocation) {
         return nullptr;
@@ -80,22 +145,18 @@ public:
 
     virtual void unmap_staging(const StagingAllocation &allocation) {}
 
+    /// Make all staging memory available again. Only valid if the GPU is idle.
     virtual void reset_staging();
 
+    StagingStats get_staging_stats() const;
+
     virtual size_t get_aligned_uniform_size(size_t original_size) = 0;
 
     BackendType get_backend_type() const {
         return backend_type;
     }
 
-    void begin_frame() {
-        current_frame_index_++;
-
-        auto &bucket = staging_buckets_[current_frame_index_ % frames_in_flight_];
-        for (auto &block : bucket.blocks) {
-            block.used_size = 0;
-        }
-    }
+    virtual void begin_frame();
 
     uint32_t get_frames_in_flight() const {
         return frames_in_flight_;
@@ -120,30 +181,68 @@ public:
     }
 
 protected:
-    Device(int frames_in_flight) : frames_in_flight_(frames_in_flight) {
-        staging_buckets_.resize(frames_in_flight_);
-    }
+    Device(int frames_in_flight) : frames_in_flight_(frames_in_flight) {}
 
     BackendType backend_type = BackendType::Vulkan;
 
-    struct StagingBlock {
+    /// Null until a cache directory is set.
+    std::shared_ptr<PipelineCache> pipeline_cache_;
+
+    /// Vendor, device and driver version. Pipeline binaries are only valid for the same identity.
+    virtual std::string get_device_identity() const {
+        return "";
+    }
+
+    StagingRing staging_ring_;
+
+    /// Backs staging_ring_. Null until the first small allocation.
+    std::shared_ptr<Buffer> staging_ring_buffer_;
+
+    struct PooledStagingBuffer {
         std::shared_ptr<Buffer> buffer;
-        size_t used_size = 0;
+        uint32_t last_used_frame = 0;
     };
 
-    struct StagingBucket {
-        std::vector<StagingBlock> blocks;
+    std::vector<PooledStagingBuffer> staging_pool_;
+
+    size_t staging_pool_size_ = 0;
+
+    StagingStats staging_stats_;
+
+    size_t current_frame_staging_bytes_ = 0;
+    uint32_t current_frame_staging_stalls_ = 0;
+
+    StagingAllocation allocate_pooled_staging(size_t size);
+
+    struct PooledCommandEncoder {
+        std::shared_ptr<CommandEncoder> encoder;
+        uint32_t last_used_frame = 0;
     };
 
-    const size_t STAGING_BLOCK_SIZE = 4 * 1024 * 1024;
+    std::vector<PooledCommandEncoder> command_encoder_pool_;
 
-    std::vector<StagingBucket> staging_buckets_;
+    void recycle_command_encoders();
 
     uint32_t frames_in_flight_;
 
     uint32_t current_frame_index_ = 0;
 
+    DescriptorSetCache descriptor_set_cache_;
+
+    struct CachedFramebuffer {
+        std::shared_ptr<Framebuffer> framebuffer;
+        std::weak_ptr<RenderPass> render_pass;
+        uint32_t last_used_frame = 0;
+    };
+
+    std::map<std::pair<const RenderPass *, const Texture *>, CachedFramebuffer> framebuffer_cache_;
+
+    void evict_framebuffers();
+
     virtual std::shared_ptr<Buffer> create_staging_buffer(size_t size) = 0;
+
+    /// Create a new encoder for the pool.
+    virtual std::shared_ptr<CommandEncoder> allocate_command_encoder() = 0;
 };
 
 } // namespace Pathfinder
@@ -8,7 +8,7 @@
 
 namespace Pathfinder {
 
-BufferGl::BufferGl(const BufferDescriptor &desc) : Buffer(desc) {
+BufferGl::BufferGl(const BufferDescriptor &desc, bool persistent) : Buffer(desc) {
     if (desc.size == 0) {
         Logger::error("Attempted to create a buffer of zero size!");
     }
@@ -38,7 +38,20 @@ BufferGl::BufferGl(const BufferDescriptor &desc) : Buffer(desc) {
     }
 
     glBindBuffer(target, gl_id_);
-    glBufferData(target, desc.size, nullptr, GL_DYNAMIC_DRAW);
+#ifdef PATHFINDER_GL_BUFFER_STORAGE
+    if (persistent) {
+        // Map once and keep the pointer, instead of mapping for every access.
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(target, desc.size, nullptr, flags);
+        mapped_ptr_ = glMapBufferRange(target, 0, desc.size, flags);
+        persistent_ = mapped_ptr_ != nullptr;
+    } else
+#endif
+    {
+        // Only a hint, the driver decides where the buffer goes.
+        auto gl_usage = desc.property == MemoryProperty::DeviceLocal ? GL_STATIC_DRAW : GL_DYNAMIC_DRAW;
+        glBufferData(target, desc.size, nullptr, gl_usage);
+    }
     glBindBuffer(target, 0);
 
     gl_check_error("create_buffer");
@@ -88,6 +101,11 @@ void BufferGl::download_via_mapping(size_t data_size, size_t offset, void *data)
         return;
     }
 
+    if (persistent_) {
+        memcpy(data, (uint8_t *)mapped_ptr_ + offset, data_size);
+        return;
+    }
+
 #ifdef PATHFINDER_ENABLE_COMPUTE
     GLenum target = GL_SHADER_STORAGE_BUFFER;
 #else
@@ -147,6 +165,10 @@ void *BufferGl::map() {
 }
 
 void BufferGl::unmap() {
+    if (persistent_) {
+        return;
+    }
+
     GLint target = GL_NONE;
     switch (desc_.type) {
         case BufferType::Uniform:
@@ -4,6 +4,12 @@
 
 #include "../buffer.h"
 
+// Immutable buffer storage (and thus persistent mapping) is not available in GLES and WebGL.
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__) && \
+    !((defined(__linux__) && defined(__ARM_ARCH)) || (defined(_WIN32) && defined(_M_ARM64)))
+    #define PATHFINDER_GL_BUFFER_STORAGE
+#endif
+
 namespace Pathfinder {
 
 class BufferGl : public Buffer {
@@ -18,16 +24,21 @@ public:
 
     void* map();
 
+    /// Does nothing for persistently mapped buffers.
     void unmap();
 
     uint32_t get_handle() const;
 
 private:
-    explicit BufferGl(const BufferDescriptor& desc);
+    /// @param persistent Map the buffer once for its whole lifetime (GL 4.4). The mapping is coherent,
+    /// so the caller must make sure the GPU is not using a range while it's accessed on the CPU.
+    BufferGl(const BufferDescriptor& desc, bool persistent);
     uint32_t gl_id_ = 0;
 
     // Cache mapped pointer to improve performance.
     void* mapped_ptr_ = nullptr;
+
+    bool persistent_ = false;
 };
 
 } // namespace Pathfinder
@@ -6,7 +6,9 @@
 #include "buffer.h"
 #include "compute_pipeline.h"
 #include "debug_marker.h"
+#include "device.h"
 #include "framebuffer.h"
+#include "query_set.h"
 #include "render_pass.h"
 #include "render_pipeline.h"
 #include "sampler.h"
@@ -17,11 +19,41 @@ CommandEncoderGl::~CommandEncoderGl() {
     glDeleteVertexArrays(vao_.size(), vao_.data());
 }
 
+void CommandEncoderGl::reset() {
+    CommandEncoder::reset();
+
+    if (!vao_.empty()) {
+        glDeleteVertexArrays(vao_.size(), vao_.data());
+        vao_.clear();
+        pipeline_vaos_.clear();
+    }
+}
+
 bool CommandEncoderGl::prepare() {
     if (commands_.empty()) {
         return false;
     }
 
+    // The GL state may have been changed since the last submission.
+    state_cache_.reset();
+
+    // Push constants are bound as ranges of a single upload.
+    StagingAllocation push_constant_staging;
+    if (!push_constant_data_.empty()) {
+        auto device = device_.lock();
+
+        // Rounding up a single byte gives the uniform offset alignment.
+        push_constant_staging =
+            device->allocate_staging(push_constant_data_.size(), device->get_aligned_uniform_size(1));
+
+        memcpy(device->map_staging(push_constant_staging), push_constant_data_.data(), push_constant_data_.size());
+        device->unmap_staging(push_constant_staging);
+
+        track_temporary_resource(push_constant_staging.buffer);
+    }
+
+    uint32_t current_vao = 0;
+
     for (const auto &cmd : commands_) {
         switch (cmd.type) {
             case CommandType::BeginRenderPass: {
@@ -53,26 +85,28 @@ bool CommandEncoderGl::prepare() {
                 auto blend_state = pipeline_gl->get_blend_state();
 
                 // Color blend.
-                if (blend_state.enabled) {
-                    glEnable(GL_BLEND);
-                    glBlendFunc(to_gl_blend_factor(blend_state.color.src_factor),
-                                to_gl_blend_factor(blend_state.color.dst_factor));
-                } else {
-                    glDisable(GL_BLEND);
-                }
+                state_cache_.set_blend(blend_state.enabled,
+                                       to_gl_blend_factor(blend_state.color.src_factor),
+                                       to_gl_blend_factor(blend_state.color.dst_factor));
 
-                pipeline_gl->get_program()->use();
+                state_cache_.use_program(pipeline_gl->get_program()->get_handle());
 
                 render_pipeline_ = args.pipeline;
                 compute_pipeline_ = nullptr;
 
                 gl_check_error("BindRenderPipeline");
 
-                uint32_t vao;
-                glGenVertexArrays(1, &vao);
+                auto vao_iter = pipeline_vaos_.find(args.pipeline);
+                if (vao_iter == pipeline_vaos_.end()) {
+                    uint32_t vao;
+                    glGenVertexArrays(1, &vao);
+                    vao_.push_back(vao);
+                    vao_iter = pipeline_vaos_.emplace(args.pipeline, vao).first;
+                }
+                current_vao = vao_iter->second;
+
                 // We have to bind it here, in case we don't need any vertex buffer.
-                glBindVertexArray(vao);
-                vao_.push_back(vao);
+                state_cache_.bind_vertex_array(current_vao);
                 gl_check_error("GenVAO");
             } break;
             case CommandType::BindVertexBuffers: {
@@ -86,8 +120,21 @@ bool CommandEncoderGl::prepare() {
                 auto vertex_buffers = args.buffers;
                 auto vertex_offsets = args.offsets;
 
-                assert(!vao_.empty() && "Must bind a render pipeline before binding vertex buffers!");
-                glBindVertexArray(vao_.back());
+                assert(current_vao != 0 && "Must bind a render pipeline before binding vertex buffers!");
+                state_cache_.bind_vertex_array(current_vao);
+
+                std::array<uint32_t, MAX_VERTEX_BUFFER_BINDINGS> vbos{};
+                for (uint32_t i = 0; i < buffer_count; i++) {
+                    vbos[i] = static_cast<BufferGl *>(vertex_buffers[i])->get_handle();
+                }
+
+                // The vertex array keeps its attribute setup.
+                if (!state_cache_.update_vertex_buffers(current_vao,
+                                                        buffer_count,
+                                                        vbos.data(),
+                                                        vertex_offsets.data())) {
+                    break;
+                }
 
                 auto &attribute_descriptions = pipeline_gl->get_attribute_descriptions();
 
@@ -170,23 +217,22 @@ bool CommandEncoderGl::prepare() {
                         case DescriptorType::UniformBuffer: {
                             auto buffer_gl = static_cast<BufferGl *>(descriptor.buffer.get());
 
-                            glBindBufferRange(GL_UNIFORM_BUFFER,
-                                              binding_point,
-                                              buffer_gl->get_handle(),
-                                              descriptor.buffer_offset,
-                                              descriptor.buffer_range);
+                            state_cache_.bind_buffer_range(GL_UNIFORM_BUFFER,
+                                                           binding_point,
+                                                           buffer_gl->get_handle(),
+                                                           descriptor.buffer_offset,
+                                                           descriptor.buffer_range);
 
                             gl_check_error("bind uniform buffer");
                         } break;
                         case DescriptorType::Sampler: {
                             auto texture_gl = static_cast<TextureGl *>(descriptor.texture.get());
 
-                            glActiveTexture(GL_TEXTURE0 + binding_point);
-                            glBindTexture(GL_TEXTURE_2D, texture_gl->get_texture_id());
+                            state_cache_.bind_texture(binding_point, texture_gl->get_texture_id());
 
                             // Set sampler.
                             auto sampler_gl = static_cast<SamplerGl *>(descriptor.sampler.get());
-                            glBindSampler(binding_point, sampler_gl->get_handle());
+                            state_cache_.bind_sampler(binding_point, sampler_gl->get_handle());
 
                             gl_check_error("bind texture");
                         } break;
@@ -194,7 +240,17 @@ bool CommandEncoderGl::prepare() {
                         case DescriptorType::StorageBuffer: {
                             auto buffer_gl = static_cast<BufferGl *>(descriptor.buffer.get());
 
-                            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding_point, buffer_gl->get_handle());
+                            // Zero range means the rest of the buffer.
+                            auto range = descriptor.buffer_range;
+                            if (descriptor.buffer_offset != 0 && range == 0) {
+                                range = buffer_gl->get_size() - descriptor.buffer_offset;
+                            }
+
+                            state_cache_.bind_buffer_range(GL_SHADER_STORAGE_BUFFER,
+                                                           binding_point,
+                                                           buffer_gl->get_handle(),
+                                                           descriptor.buffer_offset,
+                                                           range);
                         } break;
                         case DescriptorType::Image: {
                             auto texture_gl = static_cast<TextureGl *>(descriptor.texture.get());
@@ -215,6 +271,19 @@ bool CommandEncoderGl::prepare() {
 
                 gl_check_error("BindDescriptorSet");
             } break;
+            case CommandType::PushConstants: {
+                auto &args = cmd.args.push_constants;
+
+                auto buffer_gl = static_cast<BufferGl *>(push_constant_staging.buffer.get());
+
+                state_cache_.bind_buffer_range(GL_UNIFORM_BUFFER,
+                                               args.binding,
+                                               buffer_gl->get_handle(),
+                                               push_constant_staging.offset + args.data_offset,
+                                               args.data_size);
+
+                gl_check_error("PushConstants");
+            } break;
             case CommandType::Draw: {
                 auto &args = cmd.args.draw;
 
@@ -272,7 +341,7 @@ bool CommandEncoderGl::prepare() {
 
                 auto pipeline_gl = static_cast<ComputePipelineGl *>(args.pipeline);
 
-                pipeline_gl->get_program()->use();
+                state_cache_.use_program(pipeline_gl->get_program()->get_handle());
 
                 compute_pipeline_ = args.pipeline;
             } break;
@@ -284,10 +353,9 @@ bool CommandEncoderGl::prepare() {
                 // Max local (in one shader) work group sizes x:1536 y:1024 z:64.
                 glDispatchCompute(args.group_size_x, args.group_size_y, args.group_size_z);
 
-    // In order to use timestamps more precisely.
-    #ifndef NDEBUG
-                glFinish();
-    #endif
+                // Later dispatches and buffer reads in the same encoder may depend on the results.
+                glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT |
+                                GL_BUFFER_UPDATE_BARRIER_BIT);
 
                 gl_check_error("Dispatch");
 #endif
@@ -346,6 +414,7 @@ bool CommandEncoderGl::prepare() {
 
                 glBindTexture(GL_TEXTURE_2D, 0);
                 glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                state_cache_.invalidate_active_texture();
 
                 gl_check_error("WriteTexture");
             } break;
@@ -379,6 +448,22 @@ bool CommandEncoderGl::prepare() {
 
                 gl_check_error("ReadTexture with PBO and Temp FBO");
             } break;
+            case CommandType::MemoryBarrier: {
+#ifdef PATHFINDER_ENABLE_COMPUTE
+                glMemoryBarrier(GL_ALL_BARRIER_BITS);
+
+                gl_check_error("MemoryBarrier");
+#endif
+            } break;
+            case CommandType::ResetQuerySet: {
+                // GL queries don't need to be reset.
+            } break;
+            case CommandType::WriteTimestamp: {
+                auto &args = cmd.args.write_timestamp;
+                static_cast<QuerySetGl *>(args.query_set)->write_timestamp(args.query_index);
+
+                gl_check_error("WriteTimestamp");
+            } break;
             case CommandType::Max:
                 break;
         }
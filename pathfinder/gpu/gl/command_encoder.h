@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <unordered_map>
 
 #include "../command_encoder.h"
+#include "state_cache.h"
 
 namespace Pathfinder {
 
@@ -18,7 +20,14 @@ protected:
 
     bool prepare() override;
 
+    void reset() override;
+
     std::vector<uint32_t> vao_;
+
+    /// One vertex array per render pipeline, as the attribute layout comes from the pipeline.
+    std::unordered_map<RenderPipeline *, uint32_t> pipeline_vaos_;
+
+    StateCacheGl state_cache_;
 };
 
 } // namespace Pathfinder
@@ -16,8 +16,8 @@ public:
     }
 
 private:
-    explicit ComputePipelineGl(const std::shared_ptr<ShaderModule> &comp_shader_module) {
-        program_ = std::make_shared<ComputeProgram>(comp_shader_module);
+    ComputePipelineGl(const std::shared_ptr<ShaderModule> &comp_shader_module, const PipelineCache *pipeline_cache) {
+        program_ = std::make_shared<ComputeProgram>(comp_shader_module, pipeline_cache);
     }
 
     std::shared_ptr<ComputeProgram> program_;
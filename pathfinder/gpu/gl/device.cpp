@@ -5,6 +5,7 @@
 #include "debug_marker.h"
 #include "fence.h"
 #include "framebuffer.h"
+#include "query_set.h"
 #include "render_pass.h"
 #include "render_pipeline.h"
 #include "sampler.h"
@@ -16,6 +17,49 @@ DeviceGl::DeviceGl(int frames_in_flight) : Device(frames_in_flight) {
     backend_type = BackendType::Opengl;
 
     glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &min_uniform_alignment_);
+
+#ifdef PATHFINDER_GL_BUFFER_STORAGE
+    // glBufferStorage is core since GL 4.4.
+    if (GLAD_GL_VERSION_4_4) {
+        frame_fences_.resize(frames_in_flight);
+    }
+#endif
+}
+
+DeviceGl::~DeviceGl() {
+    for (auto fence : frame_fences_) {
+        glDeleteSync(fence);
+    }
+}
+
+void DeviceGl::begin_frame() {
+    // Staging and streaming buffers are persistently mapped, so the GPU must have finished the frame whose ranges
+    // are about to be reused. Wait for it before the base class retires the staging ranges.
+    if (!frame_fences_.empty()) {
+        auto fence_count = frame_fences_.size();
+
+        // Mark the end of the current frame.
+        frame_fences_[current_frame_index_ % fence_count] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        auto &retired_fence = frame_fences_[(current_frame_index_ + 1) % fence_count];
+        if (retired_fence) {
+            glClientWaitSync(retired_fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(retired_fence);
+            retired_fence = nullptr;
+        }
+    }
+
+    Device::begin_frame();
+}
+
+std::string DeviceGl::get_device_identity() const {
+    std::string identity;
+    for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        auto string = (const char *)glGetString(name);
+        identity += string ? string : "";
+        identity += "\n";
+    }
+    return identity;
 }
 
 std::shared_ptr<Framebuffer> DeviceGl::create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
@@ -36,7 +80,14 @@ std::shared_ptr<Framebuffer> DeviceGl::create_framebuffer(const std::shared_ptr<
 }
 
 std::shared_ptr<Buffer> DeviceGl::create_buffer(const BufferDescriptor &desc, const std::string &label) {
-    auto buffer_gl = std::shared_ptr<BufferGl>(new BufferGl(desc));
+    auto buffer_gl = std::shared_ptr<BufferGl>(new BufferGl(desc, false));
+    buffer_gl->set_label(label);
+    return buffer_gl;
+}
+
+std::shared_ptr<Buffer> DeviceGl::create_streaming_buffer(const BufferDescriptor &desc, const std::string &label) {
+    // The frame fences guard the reuse of ranges, see begin_frame().
+    auto buffer_gl = std::shared_ptr<BufferGl>(new BufferGl(desc, !frame_fences_.empty()));
     buffer_gl->set_label(label);
     return buffer_gl;
 }
@@ -56,10 +107,8 @@ std::shared_ptr<Sampler> DeviceGl::create_sampler(SamplerDescriptor descriptor)
     return std::shared_ptr<SamplerGl>(new SamplerGl(descriptor));
 }
 
-std::shared_ptr<CommandEncoder> DeviceGl::create_command_encoder(const std::string &label) {
-    auto cmd_encoder = std::shared_ptr<CommandEncoderGl>(new CommandEncoderGl());
-    cmd_encoder->device_ = shared_from_this();
-    return cmd_encoder;
+std::shared_ptr<CommandEncoder> DeviceGl::allocate_command_encoder() {
+    return std::shared_ptr<CommandEncoderGl>(new CommandEncoderGl());
 }
 
 std::shared_ptr<RenderPass> DeviceGl::create_render_pass(TextureFormat format,
@@ -110,8 +159,12 @@ std::shared_ptr<RenderPipeline> DeviceGl::create_render_pipeline(
     const std::shared_ptr<DescriptorSetLayout> &descriptor_set_layout,
     TextureFormat target_format,
     const std::string &label) {
-    return std::shared_ptr<RenderPipelineGl>(
-        new RenderPipelineGl(vert_shader_module, frag_shader_module, attribute_descriptions, blend_state, label));
+    return std::shared_ptr<RenderPipelineGl>(new RenderPipelineGl(vert_shader_module,
+                                                                  frag_shader_module,
+                                                                  attribute_descriptions,
+                                                                  blend_state,
+                                                                  pipeline_cache_.get(),
+                                                                  label));
 }
 
 std::shared_ptr<DescriptorSetLayout> DeviceGl::create_descriptor_set_layout(
@@ -127,7 +180,7 @@ std::shared_ptr<ComputePipeline> DeviceGl::create_compute_pipeline(
     const std::shared_ptr<ShaderModule> &comp_shader_module,
     const std::shared_ptr<DescriptorSetLayout> &descriptor_set_layout,
     const std::string &label) {
-    return std::shared_ptr<ComputePipelineGl>(new ComputePipelineGl(comp_shader_module));
+    return std::shared_ptr<ComputePipelineGl>(new ComputePipelineGl(comp_shader_module, pipeline_cache_.get()));
 }
 
 std::shared_ptr<Fence> DeviceGl::create_fence(const std::string &label) {
@@ -139,12 +192,29 @@ std::shared_ptr<Fence> DeviceGl::create_fence(const std::string &label) {
 
     return fence_gl;
 }
+
+std::shared_ptr<QuerySet> DeviceGl::create_timestamp_query_set(uint32_t count, const std::string &label) {
+#ifdef PATHFINDER_GL_TIMESTAMP_QUERIES
+    // Timer queries are core since GL 3.3.
+    if (!GLAD_GL_VERSION_3_3) {
+        return nullptr;
+    }
+
+    auto query_set_gl = std::shared_ptr<QuerySetGl>(new QuerySetGl(count));
+    query_set_gl->label_ = label;
+
+    return query_set_gl;
+#else
+    return nullptr;
+#endif
+}
 std::shared_ptr<Buffer> DeviceGl::create_staging_buffer(size_t size) {
     BufferDescriptor desc;
     desc.type = BufferType::Storage;
     desc.size = size;
     desc.property = MemoryProperty::HostVisibleAndCoherent;
-    return create_buffer(desc, "GL Staging Buffer");
+
+    return create_streaming_buffer(desc, "GL Staging Buffer");
 }
 
 void *DeviceGl::map_staging(const StagingAllocation &allocation) {
@@ -14,19 +14,25 @@ class DeviceGl : public Device {
 public:
     DeviceGl(int frames_in_flight);
 
+    ~DeviceGl() override;
+
+    void begin_frame() override;
+
     std::shared_ptr<Framebuffer> create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
                                                     const std::shared_ptr<Texture> &texture,
                                                     const std::string &label) override;
 
     std::shared_ptr<Buffer> create_buffer(const BufferDescriptor &desc, const std::string &label) override;
 
+    std::shared_ptr<Buffer> create_streaming_buffer(const BufferDescriptor &desc, const std::string &label) override;
+
     std::shared_ptr<Texture> create_texture(const TextureDescriptor &desc, const std::string &label) override;
 
     std::shared_ptr<Texture> wrap_texture(uint32_t external_gl_id, const TextureDescriptor &desc);
 
     std::shared_ptr<Sampler> create_sampler(SamplerDescriptor descriptor) override;
 
-    std::shared_ptr<CommandEncoder> create_command_encoder(const std::string &label) override;
+    std::shared_ptr<CommandEncoder> allocate_command_encoder() override;
 
     std::shared_ptr<RenderPass> create_render_pass(TextureFormat format,
                                                    AttachmentLoadOp load_op,
@@ -62,6 +68,8 @@ public:
 
     std::shared_ptr<Fence> create_fence(const std::string &label) override;
 
+    std::shared_ptr<QuerySet> create_timestamp_query_set(uint32_t count, const std::string &label) override;
+
     void *map_staging(const StagingAllocation &allocation) override;
 
     void unmap_staging(const StagingAllocation &allocation) override;
@@ -74,8 +82,15 @@ public:
 
     void set_debug_label(const std::shared_ptr<Buffer> &buffer, const std::string &label) override;
 
+protected:
+    std::string get_device_identity() const override;
+
 private:
     GLint min_uniform_alignment_{};
+
+    /// One fence per frame in flight, signaled when the GPU has finished the frame.
+    /// Empty if persistent mapping isn't supported, in which case staging buffers are mapped for every access.
+    std::vector<GLsync> frame_fences_;
 };
 
 } // namespace Pathfinder
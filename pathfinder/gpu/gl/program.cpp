@@ -1,5 +1,8 @@
 #include "program.h"
 
+#include <cstring>
+
+#include "../pipeline_cache.h"
 #include "../shader_module.h"
 #include "shader_module.h"
 
@@ -49,20 +52,91 @@ void Program::set_mat4(const std::string &name, const Mat4 &mat) const {
     glUniformMatrix4fv(glGetUniformLocation(id_, name.c_str()), 1, GL_FALSE, &mat.v[0]);
 }
 
+/// Program binaries aren't supported by WebGL, and GL before 4.1 needs an extension.
+static bool is_program_binary_supported() {
+    static bool supported = [] {
+        GLint format_count = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+
+        // Discard the invalid enum error if the query isn't supported.
+        while (glGetError() != GL_NO_ERROR) {
+        }
+
+        return format_count > 0;
+    }();
+
+    return supported;
+}
+
+void Program::link(const std::vector<ShaderModuleGl *> &shader_modules, const PipelineCache *pipeline_cache) {
+    id_ = glCreateProgram();
+
+    std::string cache_key;
+
+    if (pipeline_cache && is_program_binary_supported()) {
+        std::string sources;
+        for (auto *shader_module : shader_modules) {
+            sources += shader_module->get_source();
+        }
+        cache_key = "gl-" + PipelineCache::hash_to_string(sources);
+
+        // The binary format comes first.
+        auto data = pipeline_cache->load(cache_key);
+
+        if (data.size() > sizeof(GLenum)) {
+            GLenum format;
+            memcpy(&format, data.data(), sizeof(GLenum));
+
+            glProgramBinary(id_, format, data.data() + sizeof(GLenum), GLsizei(data.size() - sizeof(GLenum)));
+
+            // The driver may still reject binaries of the same identity, e.g. after a silent update.
+            GLint success;
+            glGetProgramiv(id_, GL_LINK_STATUS, &success);
+            if (success) {
+                return;
+            }
+        }
+
+        glProgramParameteri(id_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
+    for (auto *shader_module : shader_modules) {
+        glAttachShader(id_, shader_module->get_handle());
+    }
+    glLinkProgram(id_);
+    check_compile_errors();
+
+    if (cache_key.empty()) {
+        return;
+    }
+
+    GLint success, length;
+    glGetProgramiv(id_, GL_LINK_STATUS, &success);
+    glGetProgramiv(id_, GL_PROGRAM_BINARY_LENGTH, &length);
+
+    if (!success || length <= 0) {
+        return;
+    }
+
+    std::vector<char> data(sizeof(GLenum) + length);
+    GLenum format;
+    glGetProgramBinary(id_, length, nullptr, &format, data.data() + sizeof(GLenum));
+    memcpy(data.data(), &format, sizeof(GLenum));
+
+    pipeline_cache->store(cache_key, data);
+}
+
 // RASTER PROGRAM
 
 RasterProgram::RasterProgram(const std::shared_ptr<ShaderModule> &vertex_shader_module,
-                             const std::shared_ptr<ShaderModule> &fragment_shader_module)
+                             const std::shared_ptr<ShaderModule> &fragment_shader_module,
+                             const PipelineCache *pipeline_cache)
     : Program() {
     auto vertex_shader_module_gl = (ShaderModuleGl *)vertex_shader_module.get();
     auto fragment_shader_module_gl = (ShaderModuleGl *)fragment_shader_module.get();
 
     // Set up shader program.
-    id_ = glCreateProgram();
-    glAttachShader(id_, vertex_shader_module_gl->get_handle());
-    glAttachShader(id_, fragment_shader_module_gl->get_handle());
-    glLinkProgram(id_);
-    check_compile_errors();
+    link({vertex_shader_module_gl, fragment_shader_module_gl}, pipeline_cache);
 
     // Apply bindings automatically.
     GLint current_program;
@@ -94,14 +168,13 @@ RasterProgram::RasterProgram(const std::shared_ptr<ShaderModule> &vertex_shader_
 
 // COMPUTE PROGRAM
 
-ComputeProgram::ComputeProgram(const std::shared_ptr<ShaderModule> &compute_shader_module) : Program() {
+ComputeProgram::ComputeProgram(const std::shared_ptr<ShaderModule> &compute_shader_module,
+                               const PipelineCache *pipeline_cache)
+    : Program() {
     auto compute_shader_module_gl = (ShaderModuleGl *)compute_shader_module.get();
 
     // Shader program.
-    id_ = glCreateProgram();
-    glAttachShader(id_, compute_shader_module_gl->get_handle());
-    glLinkProgram(id_);
-    check_compile_errors();
+    link({compute_shader_module_gl}, pipeline_cache);
 
     // Apply bindings automatically.
     GLint current_program;
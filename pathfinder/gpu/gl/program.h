@@ -3,6 +3,7 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "../../common/logger.h"
 #include "../../common/math/mat2.h"
@@ -12,6 +13,8 @@
 namespace Pathfinder {
 
 class ShaderModule;
+class ShaderModuleGl;
+class PipelineCache;
 
 class Program {
 public:
@@ -45,6 +48,11 @@ protected:
     /// Program ID.
     unsigned int id_{};
 
+    /// Load the program binary from the pipeline cache if possible. Otherwise, compile the shaders,
+    /// link them and store the binary for next time.
+    /// @param pipeline_cache Null if pipelines aren't cached.
+    void link(const std::vector<ShaderModuleGl *> &shader_modules, const PipelineCache *pipeline_cache);
+
     /// Utility function for checking shader linking errors.
     void check_compile_errors() const {
         GLint success;
@@ -66,12 +74,14 @@ protected:
 class RasterProgram : public Program {
 public:
     RasterProgram(const std::shared_ptr<ShaderModule> &vertex_shader_module,
-                  const std::shared_ptr<ShaderModule> &fragment_shader_module);
+                  const std::shared_ptr<ShaderModule> &fragment_shader_module,
+                  const PipelineCache *pipeline_cache = nullptr);
 };
 
 class ComputeProgram : public Program {
 public:
-    explicit ComputeProgram(const std::shared_ptr<ShaderModule> &compute_shader_module);
+    explicit ComputeProgram(const std::shared_ptr<ShaderModule> &compute_shader_module,
+                            const PipelineCache *pipeline_cache = nullptr);
 };
 
 } // namespace Pathfinder
@@ -0,0 +1,50 @@
+#include "query_set.h"
+
+namespace Pathfinder {
+
+QuerySetGl::QuerySetGl(uint32_t count) : QuerySet(count) {
+    queries_.resize(count);
+    issued_.resize(count, false);
+
+    glGenQueries((GLsizei)count, queries_.data());
+}
+
+QuerySetGl::~QuerySetGl() {
+    glDeleteQueries((GLsizei)queries_.size(), queries_.data());
+}
+
+void QuerySetGl::write_timestamp(uint32_t query_index) {
+#ifdef PATHFINDER_GL_TIMESTAMP_QUERIES
+    glQueryCounter(queries_[query_index], GL_TIMESTAMP);
+    issued_[query_index] = true;
+#endif
+}
+
+bool QuerySetGl::get_results(uint32_t first_query, uint32_t query_count, std::vector<uint64_t> &timestamps) {
+#ifdef PATHFINDER_GL_TIMESTAMP_QUERIES
+    timestamps.resize(query_count);
+
+    for (uint32_t i = 0; i < query_count; i++) {
+        auto query_index = first_query + i;
+        if (!issued_[query_index]) {
+            return false;
+        }
+
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv(queries_[query_index], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return false;
+        }
+
+        GLuint64 timestamp = 0;
+        glGetQueryObjectui64v(queries_[query_index], GL_QUERY_RESULT, &timestamp);
+        timestamps[i] = timestamp;
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+#include "../query_set.h"
+#include "base.h"
+
+// GL_TIMESTAMP is not available in GLES and WebGL.
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__) && \
+    !((defined(__linux__) && defined(__ARM_ARCH)) || (defined(_WIN32) && defined(_M_ARM64)))
+    #define PATHFINDER_GL_TIMESTAMP_QUERIES
+#endif
+
+namespace Pathfinder {
+
+class QuerySetGl : public QuerySet {
+    friend class DeviceGl;
+
+public:
+    ~QuerySetGl() override;
+
+    void write_timestamp(uint32_t query_index);
+
+    bool get_results(uint32_t first_query, uint32_t query_count, std::vector<uint64_t> &timestamps) override;
+
+private:
+    explicit QuerySetGl(uint32_t count);
+
+    std::vector<GLuint> queries_;
+
+    /// Querying results of a query that has never been issued is an error.
+    std::vector<bool> issued_;
+};
+
+} // namespace Pathfinder
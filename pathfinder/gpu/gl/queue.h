@@ -24,6 +24,13 @@ public:
             fence_gl->wait();
         }
 
+        // Readbacks go through persistently mapped staging buffers, which aren't synchronized implicitly.
+        if (!encoder->callbacks_.empty()) {
+            GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+            glDeleteSync(sync);
+        }
+
         encoder->invoke_callbacks();
     }
 };
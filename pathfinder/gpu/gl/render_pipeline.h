@@ -22,9 +22,10 @@ private:
                      const std::shared_ptr<ShaderModule> &frag_shader_module,
                      const std::vector<VertexInputAttributeDescription> &attribute_descriptions,
                      BlendState blend_state,
+                     const PipelineCache *pipeline_cache,
                      std::string label)
         : RenderPipeline(attribute_descriptions, blend_state, std::move(label)) {
-        program_ = std::make_shared<RasterProgram>(vert_shader_module, frag_shader_module);
+        program_ = std::make_shared<RasterProgram>(vert_shader_module, frag_shader_module, pipeline_cache);
 
         gl_check_error("create_render_pipeline");
 
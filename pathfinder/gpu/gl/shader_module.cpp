@@ -39,31 +39,15 @@ ShaderModuleGl::ShaderModuleGl(const std::vector<char> &source_code,
     label_ = label;
     texture_binding_map_ = texture_binding_map;
     uniform_buffer_binding_map_ = uniform_buffer_binding_map;
+    stage_ = shader_stage;
 
-    switch (shader_stage) {
-        case ShaderStage::Vertex: {
-            id_ = glCreateShader(GL_VERTEX_SHADER);
-        } break;
-        case ShaderStage::Fragment: {
-            id_ = glCreateShader(GL_FRAGMENT_SHADER);
-        } break;
-#ifdef PATHFINDER_ENABLE_COMPUTE
-        case ShaderStage::Compute: {
-            id_ = glCreateShader(GL_COMPUTE_SHADER);
-        } break;
-#endif
-        default:
-            abort();
-    }
-
-    /// Has to pass string.c_str(), as vector<char>.data() doesn't work.
-    std::string code_string = {source_code.begin(), source_code.end()};
+    source_ = {source_code.begin(), source_code.end()};
 
 #ifdef PATHFINDER_MINIMUM_SHADER_VERSION_SUPPORT
     if (shader_stage == ShaderStage::Compute) {
-        replaceFirst(code_string, "#version 430", "#version 310 es");
+        replaceFirst(source_, "#version 430", "#version 310 es");
     } else {
-        replaceFirst(code_string, "#version 310 es", "#version 300 es");
+        replaceFirst(source_, "#version 310 es", "#version 300 es");
     }
 
     // Deprecated, should be handled by SPIRV now.
@@ -80,20 +64,43 @@ ShaderModuleGl::ShaderModuleGl(const std::vector<char> &source_code,
     //     }
     // }
 #endif
+}
 
-    auto code_cstr = code_string.c_str();
+ShaderModuleGl::~ShaderModuleGl() {
+    if (id_ != 0) {
+        glDeleteShader(id_);
+    }
+}
+
+unsigned int ShaderModuleGl::get_handle() {
+    if (id_ != 0) {
+        return id_;
+    }
+
+    switch (stage_) {
+        case ShaderStage::Vertex: {
+            id_ = glCreateShader(GL_VERTEX_SHADER);
+        } break;
+        case ShaderStage::Fragment: {
+            id_ = glCreateShader(GL_FRAGMENT_SHADER);
+        } break;
+#ifdef PATHFINDER_ENABLE_COMPUTE
+        case ShaderStage::Compute: {
+            id_ = glCreateShader(GL_COMPUTE_SHADER);
+        } break;
+#endif
+        default:
+            abort();
+    }
+
+    /// Has to pass string.c_str(), as vector<char>.data() doesn't work.
+    auto code_cstr = source_.c_str();
 
     glShaderSource(id_, 1, &code_cstr, nullptr);
     glCompileShader(id_);
 
     check_compile_errors();
-}
-
-ShaderModuleGl::~ShaderModuleGl() {
-    glDeleteShader(id_);
-}
 
-unsigned int ShaderModuleGl::get_handle() const {
     return id_;
 }
 
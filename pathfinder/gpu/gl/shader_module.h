@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include "../shader_module.h"
@@ -17,7 +18,13 @@ class ShaderModuleGl : public ShaderModule {
 public:
     ~ShaderModuleGl() override;
 
-    unsigned int get_handle() const;
+    /// Compiles the shader on first use, as programs loaded from the pipeline cache don't need it.
+    unsigned int get_handle();
+
+    /// Final source code, after adapting it to the GL version.
+    const std::string &get_source() const {
+        return source_;
+    }
 
 private:
     ShaderModuleGl(const std::vector<char>& source_code,
@@ -31,6 +38,10 @@ private:
 
     unsigned int id_{};
 
+    ShaderStage stage_;
+
+    std::string source_;
+
     std::vector<std::pair<uint32_t, std::string>> texture_binding_map_;
     std::vector<std::pair<uint32_t, std::string>> uniform_buffer_binding_map_;
 };
@@ -0,0 +1,126 @@
+#include "state_cache.h"
+
+#include <algorithm>
+
+namespace Pathfinder {
+
+void StateCacheGl::reset() {
+    program_ = UNKNOWN;
+    vao_ = UNKNOWN;
+    vertex_buffers_.clear();
+    blend_enabled_ = -1;
+    blend_src_factor_ = -1;
+    blend_dst_factor_ = -1;
+    active_texture_unit_ = UNKNOWN;
+    textures_.clear();
+    samplers_.clear();
+    uniform_buffers_.clear();
+    storage_buffers_.clear();
+}
+
+void StateCacheGl::use_program(uint32_t program) {
+    if (program_ == program) {
+        return;
+    }
+
+    glUseProgram(program);
+    program_ = program;
+}
+
+void StateCacheGl::bind_vertex_array(uint32_t vao) {
+    if (vao_ == vao) {
+        return;
+    }
+
+    glBindVertexArray(vao);
+    vao_ = vao;
+}
+
+bool StateCacheGl::update_vertex_buffers(uint32_t vao,
+                                         uint32_t buffer_count,
+                                         const uint32_t *buffers,
+                                         const uint64_t *offsets) {
+    auto &current = vertex_buffers_[vao];
+
+    if (current.buffers.size() == buffer_count &&
+        std::equal(buffers, buffers + buffer_count, current.buffers.begin()) &&
+        std::equal(offsets, offsets + buffer_count, current.offsets.begin())) {
+        return false;
+    }
+
+    current.buffers.assign(buffers, buffers + buffer_count);
+    current.offsets.assign(offsets, offsets + buffer_count);
+
+    return true;
+}
+
+void StateCacheGl::set_blend(bool enabled, GLint src_factor, GLint dst_factor) {
+    if (blend_enabled_ != (int)enabled) {
+        if (enabled) {
+            glEnable(GL_BLEND);
+        } else {
+            glDisable(GL_BLEND);
+        }
+        blend_enabled_ = enabled;
+    }
+
+    // The blend function is kept while blending is disabled.
+    if (enabled && (blend_src_factor_ != src_factor || blend_dst_factor_ != dst_factor)) {
+        glBlendFunc(src_factor, dst_factor);
+        blend_src_factor_ = src_factor;
+        blend_dst_factor_ = dst_factor;
+    }
+}
+
+void StateCacheGl::bind_texture(uint32_t unit, uint32_t texture) {
+    auto &current = binding_at(textures_, unit, UNKNOWN);
+    if (current == texture) {
+        return;
+    }
+
+    if (active_texture_unit_ != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        active_texture_unit_ = unit;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    current = texture;
+}
+
+void StateCacheGl::invalidate_active_texture() {
+    if (active_texture_unit_ == UNKNOWN) {
+        textures_.clear();
+    } else {
+        binding_at(textures_, active_texture_unit_, UNKNOWN) = UNKNOWN;
+    }
+}
+
+void StateCacheGl::bind_sampler(uint32_t unit, uint32_t sampler) {
+    auto &current = binding_at(samplers_, unit, UNKNOWN);
+    if (current == sampler) {
+        return;
+    }
+
+    glBindSampler(unit, sampler);
+    current = sampler;
+}
+
+void StateCacheGl::bind_buffer_range(GLenum target, uint32_t binding, uint32_t buffer, size_t offset, size_t size) {
+    auto &bindings = target == GL_UNIFORM_BUFFER ? uniform_buffers_ : storage_buffers_;
+
+    BufferBinding new_binding{buffer, offset, size};
+
+    auto &current = binding_at(bindings, binding, BufferBinding{UNKNOWN, 0, 0});
+    if (current == new_binding) {
+        return;
+    }
+
+    if (offset == 0 && size == 0) {
+        glBindBufferBase(target, binding, buffer);
+    } else {
+        glBindBufferRange(target, binding, buffer, (GLintptr)offset, (GLsizeiptr)size);
+    }
+    current = new_binding;
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base.h"
+
+namespace Pathfinder {
+
+/// The GL state last set by a command encoder, used to skip binds that wouldn't change anything.
+/// Other code may change the GL state between submissions, so it's only valid while an encoder is being prepared.
+class StateCacheGl {
+public:
+    /// Forget all state, so that the following binds are all issued.
+    void reset();
+
+    void use_program(uint32_t program);
+
+    void bind_vertex_array(uint32_t vao);
+
+    /// Returns false if the vertex array already sources its attributes from these buffers at these offsets,
+    /// in which case the attribute setup can be skipped.
+    bool update_vertex_buffers(uint32_t vao, uint32_t buffer_count, const uint32_t *buffers, const uint64_t *offsets);
+
+    void set_blend(bool enabled, GLint src_factor, GLint dst_factor);
+
+    void bind_texture(uint32_t unit, uint32_t texture);
+
+    /// Has to be called after binding a texture to the active unit without going through the cache.
+    void invalidate_active_texture();
+
+    void bind_sampler(uint32_t unit, uint32_t sampler);
+
+    /// Zero offset and size bind the whole buffer.
+    void bind_buffer_range(GLenum target, uint32_t binding, uint32_t buffer, size_t offset, size_t size);
+
+private:
+    struct BufferBinding {
+        uint32_t buffer;
+        size_t offset;
+        size_t size;
+
+        bool operator==(const BufferBinding &rhs) const {
+            return buffer == rhs.buffer && offset == rhs.offset && size == rhs.size;
+        }
+    };
+
+    struct VertexBuffers {
+        std::vector<uint32_t> buffers;
+        std::vector<uint64_t> offsets;
+    };
+
+    /// Marks an unknown object binding.
+    static constexpr uint32_t UNKNOWN = UINT32_MAX;
+
+    /// Grow a binding table to hold the binding point, filling new entries with unknown bindings.
+    template <typename T>
+    static T &binding_at(std::vector<T> &bindings, uint32_t index, const T &unknown) {
+        if (index >= bindings.size()) {
+            bindings.resize(index + 1, unknown);
+        }
+        return bindings[index];
+    }
+
+    uint32_t program_ = UNKNOWN;
+
+    uint32_t vao_ = UNKNOWN;
+
+    std::unordered_map<uint32_t, VertexBuffers> vertex_buffers_;
+
+    /// -1 if unknown.
+    int blend_enabled_ = -1;
+    GLint blend_src_factor_ = -1;
+    GLint blend_dst_factor_ = -1;
+
+    uint32_t active_texture_unit_ = UNKNOWN;
+
+    /// Indexed by texture unit.
+    std::vector<uint32_t> textures_;
+    std::vector<uint32_t> samplers_;
+
+    /// Indexed by binding point.
+    std::vector<BufferBinding> uniform_buffers_;
+    std::vector<BufferBinding> storage_buffers_;
+};
+
+} // namespace Pathfinder
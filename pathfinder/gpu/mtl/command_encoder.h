@@ -36,6 +36,8 @@ private:
     CommandEncoderMtl(id<MTLDevice> mtl_device, id<MTLCommandQueue> mtl_cmd_queue)
         : mtl_device_(mtl_device), mtl_cmd_queue_(mtl_cmd_queue), mtl_cmd_buffer_(nil) {}
 
+    void reset() override;
+
     id<MTLDevice> mtl_device_ = nil;
     id<MTLCommandQueue> mtl_cmd_queue_ = nil;
     id<MTLCommandBuffer> mtl_cmd_buffer_ = nil;
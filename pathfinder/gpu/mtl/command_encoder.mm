@@ -14,6 +14,13 @@
 
 namespace Pathfinder {
 
+void CommandEncoderMtl::reset() {
+    CommandEncoder::reset();
+
+    // Metal command buffers are transient, a new one is created when the encoder is prepared again.
+    mtl_cmd_buffer_ = nil;
+}
+
 bool CommandEncoderMtl::prepare() {
     // For presentDrawable.
     if (mtl_cmd_buffer_ != nil) {
@@ -311,10 +318,26 @@ bool CommandEncoderMtl::prepare() {
                     }
                 }
             } break;
+            case CommandType::PushConstants: {
+                const auto &args = cmd.args.push_constants;
+                const auto data = get_push_constant_data(cmd);
+
+                // Metal copies small constants into the command buffer itself. Uniform buffers of the render stages
+                // come after the first 8 vertex buffer locations, like in BindDescriptorSet.
+                if (current_render_cmd_encoder_) {
+                    [current_render_cmd_encoder_ setVertexBytes:data length:args.data_size atIndex:args.binding + 8];
+                    [current_render_cmd_encoder_ setFragmentBytes:data length:args.data_size atIndex:args.binding + 8];
+                } else if (current_compute_cmd_encoder_) {
+                    [current_compute_cmd_encoder_ setBytes:data length:args.data_size atIndex:args.binding];
+                }
+            } break;
             case CommandType::EndComputePass: {
                 [current_compute_cmd_encoder_ endEncoding];
                 current_compute_cmd_encoder_ = nil;
             } break;
+            case CommandType::MemoryBarrier: {
+                // Hazards between passes are tracked by Metal for the resources we create.
+            } break;
         }
     }
 
@@ -29,7 +29,7 @@ public:
 
     std::shared_ptr<Sampler> create_sampler(SamplerDescriptor descriptor) override;
 
-    std::shared_ptr<CommandEncoder> create_command_encoder(const std::string &label) override;
+    std::shared_ptr<CommandEncoder> allocate_command_encoder() override;
 
     std::shared_ptr<DescriptorSetLayout> create_descriptor_set_layout(
         const std::vector<DescriptorLayout> &descriptors) override;
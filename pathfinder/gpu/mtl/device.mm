@@ -215,10 +215,8 @@ void *DeviceMtl::map_staging(const StagingAllocation &allocation) {
 void DeviceMtl::unmap_staging(const StagingAllocation &allocation) {
 }
 
-std::shared_ptr<CommandEncoder> DeviceMtl::create_command_encoder(const std::string &label) {
-    auto encoder = std::shared_ptr<CommandEncoderMtl>(new CommandEncoderMtl(mtl_device_, mtl_cmd_queue_));
-    encoder->device_ = shared_from_this();
-    return encoder;
+std::shared_ptr<CommandEncoder> DeviceMtl::allocate_command_encoder() {
+    return std::shared_ptr<CommandEncoderMtl>(new CommandEncoderMtl(mtl_device_, mtl_cmd_queue_));
 }
 
 std::shared_ptr<Framebuffer> DeviceMtl::create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
@@ -0,0 +1,78 @@
+#include "buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "../../common/logger.h"
+
+namespace Pathfinder {
+
+BufferNull::BufferNull(const BufferDescriptor &desc, const std::shared_ptr<NullDeviceStats> &stats)
+    : Buffer(desc), stats_(stats) {
+    if (desc.size == 0) {
+        Logger::error("Attempted to create a buffer of zero size!", "BufferNull");
+        stats_->validation_errors++;
+    }
+
+    stats_->buffers_created++;
+    stats_->buffer_count++;
+    stats_->buffer_bytes += desc.size;
+    stats_->peak_buffer_bytes = std::max(stats_->peak_buffer_bytes, stats_->buffer_bytes);
+}
+
+BufferNull::~BufferNull() {
+    stats_->buffer_count--;
+    stats_->buffer_bytes -= desc_.size;
+}
+
+uint8_t *BufferNull::get_data() {
+    if (data_.empty()) {
+        data_.resize(desc_.size);
+    }
+    return data_.data();
+}
+
+bool BufferNull::validate_range(size_t offset, size_t data_size, const char *operation) const {
+    if (offset + data_size <= desc_.size) {
+        return true;
+    }
+
+    Logger::error(std::string(operation) + " out of the range of buffer " + label_ + "!", "BufferNull");
+    stats_->validation_errors++;
+
+    return false;
+}
+
+bool BufferNull::validate_mapping() const {
+    // Device-local memory can't be mapped on Vulkan.
+    if (desc_.property == MemoryProperty::HostVisibleAndCoherent) {
+        return true;
+    }
+
+    Logger::error("Tried to map device-local buffer " + label_ + "!", "BufferNull");
+    stats_->validation_errors++;
+
+    return false;
+}
+
+void BufferNull::upload_via_mapping(size_t data_size, size_t offset, const void *data) {
+    if (!validate_mapping() || !validate_range(offset, data_size, "Mapped write")) {
+        return;
+    }
+
+    memcpy(get_data() + offset, data, data_size);
+
+    stats_->mapped_bytes_written += data_size;
+}
+
+void BufferNull::download_via_mapping(size_t data_size, size_t offset, void *data) {
+    if (!validate_mapping() || !validate_range(offset, data_size, "Mapped read")) {
+        return;
+    }
+
+    memcpy(data, get_data() + offset, data_size);
+
+    stats_->mapped_bytes_read += data_size;
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../buffer.h"
+#include "stats.h"
+
+namespace Pathfinder {
+
+/// Buffer contents live in host memory, so that transfers and readbacks behave like on a real device.
+/// The memory is only allocated on first access.
+class BufferNull : public Buffer {
+    friend class DeviceNull;
+
+public:
+    ~BufferNull() override;
+
+    void upload_via_mapping(size_t data_size, size_t offset, const void* data) override;
+
+    void download_via_mapping(size_t data_size, size_t offset, void* data) override;
+
+    uint8_t* get_data();
+
+    /// Check that the range is inside the buffer, recording a validation error if it's not.
+    bool validate_range(size_t offset, size_t data_size, const char* operation) const;
+
+private:
+    BufferNull(const BufferDescriptor& desc, const std::shared_ptr<NullDeviceStats>& stats);
+
+    bool validate_mapping() const;
+
+    std::vector<uint8_t> data_;
+
+    std::shared_ptr<NullDeviceStats> stats_;
+};
+
+} // namespace Pathfinder
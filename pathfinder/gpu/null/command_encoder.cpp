@@ -0,0 +1,410 @@
+#include "command_encoder.h"
+
+#include <cstring>
+#include <string>
+
+#include "../../common/logger.h"
+#include "buffer.h"
+#include "objects.h"
+#include "texture.h"
+
+namespace Pathfinder {
+
+namespace {
+
+const char *get_command_name(CommandType type) {
+    switch (type) {
+        case CommandType::BeginRenderPass:
+            return "BeginRenderPass";
+        case CommandType::SetViewport:
+            return "SetViewport";
+        case CommandType::BindRenderPipeline:
+            return "BindRenderPipeline";
+        case CommandType::BindVertexBuffers:
+            return "BindVertexBuffers";
+        case CommandType::BindIndexBuffer:
+            return "BindIndexBuffer";
+        case CommandType::BindDescriptorSet:
+            return "BindDescriptorSet";
+        case CommandType::Draw:
+            return "Draw";
+        case CommandType::DrawIndexed:
+            return "DrawIndexed";
+        case CommandType::DrawInstanced:
+            return "DrawInstanced";
+        case CommandType::DrawIndirect:
+            return "DrawIndirect";
+        case CommandType::EndRenderPass:
+            return "EndRenderPass";
+        case CommandType::BeginComputePass:
+            return "BeginComputePass";
+        case CommandType::BindComputePipeline:
+            return "BindComputePipeline";
+        case CommandType::Dispatch:
+            return "Dispatch";
+        case CommandType::DispatchIndirect:
+            return "DispatchIndirect";
+        case CommandType::EndComputePass:
+            return "EndComputePass";
+        case CommandType::PushConstants:
+            return "PushConstants";
+        case CommandType::WriteBuffer:
+            return "WriteBuffer";
+        case CommandType::ReadBuffer:
+            return "ReadBuffer";
+        case CommandType::WriteTexture:
+            return "WriteTexture";
+        case CommandType::ReadTexture:
+            return "ReadTexture";
+        case CommandType::MemoryBarrier:
+            return "MemoryBarrier";
+        case CommandType::ResetQuerySet:
+            return "ResetQuerySet";
+        case CommandType::WriteTimestamp:
+            return "WriteTimestamp";
+        default:
+            return "Unknown";
+    }
+}
+
+/// Pipelines and descriptor sets are compatible if their layouts have the same bindings, like on Vulkan.
+bool is_layout_compatible(const DescriptorSetLayout *pipeline_layout, const DescriptorSet *descriptor_set) {
+    if (pipeline_layout == nullptr) {
+        return true;
+    }
+    if (descriptor_set == nullptr) {
+        return false;
+    }
+
+    auto set_layout = descriptor_set->get_layout();
+
+    return set_layout.get() == pipeline_layout ||
+           (set_layout && set_layout->get_descriptor_layouts() == pipeline_layout->get_descriptor_layouts());
+}
+
+} // namespace
+
+void CommandEncoderNull::report(const Command &cmd, const std::string &message) {
+    Logger::error(std::string(get_command_name(cmd.type)) + " in encoder " + label_ + ": " + message,
+                  "CommandEncoderNull");
+    stats_->validation_errors++;
+}
+
+bool CommandEncoderNull::prepare() {
+    if (commands_.empty()) {
+        return false;
+    }
+
+    stats_->submissions++;
+
+    bool in_render_pass = false;
+    bool in_compute_pass = false;
+
+    DrawStateNull state;
+
+    for (const auto &cmd : commands_) {
+        stats_->command_counts[(size_t)cmd.type]++;
+
+        switch (cmd.type) {
+            case CommandType::BeginRenderPass: {
+                if (in_render_pass || in_compute_pass) {
+                    report(cmd, "passes can't be nested!");
+                }
+
+                auto &args = cmd.args.begin_render_pass;
+
+                in_render_pass = true;
+                state = {};
+                state.framebuffer = args.framebuffer;
+
+                auto texture = args.framebuffer->get_texture();
+                if (texture) {
+                    state.viewport = {{0, 0}, texture->get_size()};
+                }
+
+                execute_begin_render_pass(args.render_pass, args.framebuffer, args.clear_color);
+            } break;
+            case CommandType::SetViewport: {
+                if (!in_render_pass) {
+                    report(cmd, "not inside a render pass!");
+                }
+
+                state.viewport = cmd.args.set_viewport.viewport;
+            } break;
+            case CommandType::BindVertexBuffers: {
+                if (!in_render_pass) {
+                    report(cmd, "not inside a render pass!");
+                }
+
+                auto &args = cmd.args.bind_vertex_buffers;
+                state.vertex_buffer_count = args.buffer_count;
+                state.vertex_buffers = args.buffers;
+                state.vertex_buffer_offsets = args.offsets;
+            } break;
+            case CommandType::BindIndexBuffer: {
+                if (!in_render_pass) {
+                    report(cmd, "not inside a render pass!");
+                }
+            } break;
+            case CommandType::BindRenderPipeline: {
+                if (!in_render_pass) {
+                    report(cmd, "not inside a render pass!");
+                }
+
+                auto pipeline = static_cast<RenderPipelineNull *>(cmd.args.bind_render_pipeline.pipeline);
+
+                auto texture = state.framebuffer ? state.framebuffer->get_texture() : nullptr;
+                if (texture && texture->get_format() != pipeline->get_target_format()) {
+                    report(cmd, "pipeline " + pipeline->get_label() + " doesn't match the render target format!");
+                }
+
+                state.pipeline = pipeline;
+            } break;
+            case CommandType::BindDescriptorSet: {
+                if (!in_render_pass && !in_compute_pass) {
+                    report(cmd, "not inside a pass!");
+                }
+
+                state.descriptor_set = cmd.args.bind_descriptor_set.descriptor_set;
+            } break;
+            case CommandType::Draw:
+            case CommandType::DrawIndexed:
+            case CommandType::DrawInstanced:
+            case CommandType::DrawIndirect: {
+                if (!in_render_pass) {
+                    report(cmd, "not inside a render pass!");
+                }
+                if (state.pipeline == nullptr) {
+                    report(cmd, "no render pipeline bound!");
+                    break;
+                }
+
+                auto pipeline = state.pipeline;
+                if (!is_layout_compatible(pipeline->get_layout().get(), state.descriptor_set)) {
+                    report(cmd, "bound descriptor set doesn't match pipeline " + pipeline->get_label() + "!");
+                }
+
+                stats_->draw_calls++;
+
+                if (cmd.type == CommandType::Draw) {
+                    stats_->drawn_vertices += cmd.args.draw.vertex_count;
+                } else if (cmd.type == CommandType::DrawIndexed) {
+                    auto &args = cmd.args.draw_indexed;
+                    stats_->drawn_vertices += (uint64_t)args.index_count * args.instance_count;
+                } else if (cmd.type == CommandType::DrawInstanced) {
+                    auto &args = cmd.args.draw_instanced;
+                    stats_->drawn_vertices += (uint64_t)args.vertex_count * args.instance_count;
+                } else {
+                    auto &args = cmd.args.indirect;
+                    // Four u32 arguments.
+                    static_cast<BufferNull *>(args.buffer)->validate_range(args.offset, 16, "Indirect draw");
+                }
+
+                if (in_render_pass) {
+                    execute_draw(cmd, state);
+                }
+            } break;
+            case CommandType::EndRenderPass: {
+                if (!in_render_pass) {
+                    report(cmd, "no render pass to end!");
+                }
+
+                in_render_pass = false;
+                state = {};
+            } break;
+            case CommandType::BeginComputePass: {
+                if (in_render_pass || in_compute_pass) {
+                    report(cmd, "passes can't be nested!");
+                }
+
+                in_compute_pass = true;
+                compute_pipeline_ = nullptr;
+                state.descriptor_set = nullptr;
+                state.push_constants.clear();
+            } break;
+            case CommandType::BindComputePipeline: {
+                if (!in_compute_pass) {
+                    report(cmd, "not inside a compute pass!");
+                }
+
+                compute_pipeline_ = cmd.args.bind_compute_pipeline.pipeline;
+            } break;
+            case CommandType::Dispatch:
+            case CommandType::DispatchIndirect: {
+                if (!in_compute_pass) {
+                    report(cmd, "not inside a compute pass!");
+                }
+                if (compute_pipeline_ == nullptr) {
+                    report(cmd, "no compute pipeline bound!");
+                    break;
+                }
+
+                auto pipeline = static_cast<ComputePipelineNull *>(compute_pipeline_);
+                if (!is_layout_compatible(pipeline->get_layout().get(), state.descriptor_set)) {
+                    report(cmd, "bound descriptor set doesn't match pipeline " + pipeline->get_label() + "!");
+                }
+
+                stats_->dispatches++;
+
+                if (cmd.type == CommandType::Dispatch) {
+                    auto &args = cmd.args.dispatch;
+                    stats_->dispatched_workgroups +=
+                        (uint64_t)args.group_size_x * args.group_size_y * args.group_size_z;
+                } else {
+                    auto &args = cmd.args.indirect;
+                    // Three u32 group counts.
+                    static_cast<BufferNull *>(args.buffer)->validate_range(args.offset, 12, "Indirect dispatch");
+                }
+            } break;
+            case CommandType::EndComputePass: {
+                if (!in_compute_pass) {
+                    report(cmd, "no compute pass to end!");
+                }
+
+                in_compute_pass = false;
+                compute_pipeline_ = nullptr;
+            } break;
+            case CommandType::PushConstants: {
+                auto &args = cmd.args.push_constants;
+
+                const DescriptorSetLayout *layout = nullptr;
+                std::string pipeline_label;
+                if (in_render_pass && state.pipeline) {
+                    layout = state.pipeline->get_layout().get();
+                    pipeline_label = state.pipeline->get_label();
+                } else if (in_compute_pass && compute_pipeline_) {
+                    auto pipeline = static_cast<ComputePipelineNull *>(compute_pipeline_);
+                    layout = pipeline->get_layout().get();
+                    pipeline_label = pipeline->get_label();
+                } else {
+                    report(cmd, "no pipeline bound inside a pass!");
+                    break;
+                }
+
+                if (layout) {
+                    auto &descriptor_layouts = layout->get_descriptor_layouts();
+                    auto it = descriptor_layouts.find(args.binding);
+                    if (it == descriptor_layouts.end() || it->second.type != DescriptorType::PushConstant) {
+                        report(cmd,
+                               "pipeline " + pipeline_label + " has no push constants at binding " +
+                                   std::to_string(args.binding) + "!");
+                        break;
+                    }
+                    if (it->second.size != args.data_size) {
+                        report(cmd, "data size doesn't match the uniform block of pipeline " + pipeline_label + "!");
+                    }
+                }
+
+                state.push_constants[args.binding] = get_push_constant_data(cmd);
+
+                stats_->push_constant_bytes += args.data_size;
+            } break;
+            case CommandType::WriteBuffer: {
+                auto &args = cmd.args.write_buffer;
+                auto buffer = static_cast<BufferNull *>(args.buffer);
+                auto staging_buffer = static_cast<BufferNull *>(args.staging_buffer);
+
+                if (in_render_pass) {
+                    report(cmd, "transfers aren't allowed inside a render pass!");
+                }
+                if (!buffer->validate_range(args.offset, args.data_size, "Buffer write") ||
+                    !staging_buffer->validate_range(args.staging_offset, args.data_size, "Staging read")) {
+                    break;
+                }
+
+                memcpy(buffer->get_data() + args.offset,
+                       staging_buffer->get_data() + args.staging_offset,
+                       args.data_size);
+
+                stats_->buffer_bytes_written += args.data_size;
+            } break;
+            case CommandType::ReadBuffer: {
+                auto &args = cmd.args.read_buffer;
+                auto buffer = static_cast<BufferNull *>(args.buffer);
+                auto staging_buffer = static_cast<BufferNull *>(args.staging_buffer);
+
+                if (in_render_pass) {
+                    report(cmd, "transfers aren't allowed inside a render pass!");
+                }
+                if (!buffer->validate_range(args.offset, args.data_size, "Buffer read") ||
+                    !staging_buffer->validate_range(args.staging_offset, args.data_size, "Staging write")) {
+                    break;
+                }
+
+                memcpy(staging_buffer->get_data() + args.staging_offset,
+                       buffer->get_data() + args.offset,
+                       args.data_size);
+
+                stats_->buffer_bytes_read += args.data_size;
+            } break;
+            case CommandType::WriteTexture: {
+                auto &args = cmd.args.write_texture;
+                auto texture = static_cast<TextureNull *>(args.texture);
+                auto staging_buffer = static_cast<BufferNull *>(args.staging_buffer);
+
+                if (in_render_pass) {
+                    report(cmd, "transfers aren't allowed inside a render pass!");
+                }
+
+                size_t pixel_size = get_pixel_size(texture->get_format());
+                size_t row_size = args.width * pixel_size;
+                size_t texture_row_size = texture->get_size().x * pixel_size;
+
+                if (!staging_buffer->validate_range(args.staging_offset, row_size * args.height, "Staging read")) {
+                    break;
+                }
+
+                auto src = staging_buffer->get_data() + args.staging_offset;
+                auto dst = texture->get_data() + args.offset_y * texture_row_size + args.offset_x * pixel_size;
+                for (uint32_t row = 0; row < args.height; row++) {
+                    memcpy(dst + row * texture_row_size, src + row * row_size, row_size);
+                }
+
+                stats_->texture_bytes_written += row_size * args.height;
+            } break;
+            case CommandType::ReadTexture: {
+                auto &args = cmd.args.read_texture;
+                auto texture = static_cast<TextureNull *>(args.texture);
+                auto staging_buffer = static_cast<BufferNull *>(args.staging_buffer);
+
+                if (in_render_pass) {
+                    report(cmd, "transfers aren't allowed inside a render pass!");
+                }
+
+                size_t pixel_size = get_pixel_size(texture->get_format());
+                size_t row_size = args.width * pixel_size;
+                size_t texture_row_size = texture->get_size().x * pixel_size;
+
+                if (!staging_buffer->validate_range(args.staging_offset, row_size * args.height, "Staging write")) {
+                    break;
+                }
+
+                auto src = texture->get_data() + args.offset_y * texture_row_size + args.offset_x * pixel_size;
+                auto dst = staging_buffer->get_data() + args.staging_offset;
+                for (uint32_t row = 0; row < args.height; row++) {
+                    memcpy(dst + row * row_size, src + row * texture_row_size, row_size);
+                }
+
+                stats_->texture_bytes_read += row_size * args.height;
+            } break;
+            case CommandType::MemoryBarrier:
+            case CommandType::ResetQuerySet: {
+                if (in_render_pass) {
+                    report(cmd, "not allowed inside a render pass!");
+                }
+            } break;
+            case CommandType::WriteTimestamp:
+            case CommandType::Max:
+                break;
+        }
+    }
+
+    if (in_render_pass || in_compute_pass) {
+        Logger::error("Encoder " + label_ + " was submitted with an unfinished pass!", "CommandEncoderNull");
+        stats_->validation_errors++;
+    }
+
+    return true;
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+
+#include "../command_encoder.h"
+#include "stats.h"
+
+namespace Pathfinder {
+
+class RenderPipelineNull;
+
+/// Render state a draw reads and writes, tracked while walking the commands.
+struct DrawStateNull {
+    Framebuffer *framebuffer = nullptr;
+    RenderPipelineNull *pipeline = nullptr;
+    DescriptorSet *descriptor_set = nullptr;
+
+    /// Data pushed in the current pass, by binding.
+    std::map<uint32_t, const uint8_t *> push_constants;
+
+    uint32_t vertex_buffer_count = 0;
+    std::array<Buffer *, MAX_VERTEX_BUFFER_BINDINGS> vertex_buffers{};
+    std::array<uint64_t, MAX_VERTEX_BUFFER_BINDINGS> vertex_buffer_offsets{};
+
+    RectI viewport;
+};
+
+/// Commands are validated and counted when submitted. Transfers are carried out on host memory, while draws and
+/// dispatches have no effect unless a subclass executes them.
+class CommandEncoderNull : public CommandEncoder {
+    friend class DeviceNull;
+
+protected:
+    explicit CommandEncoderNull(const std::shared_ptr<NullDeviceStats> &stats) : stats_(stats) {}
+
+    bool prepare() override;
+
+    /// Called for each render pass, before any of its draws.
+    virtual void execute_begin_render_pass(RenderPass *render_pass, Framebuffer *framebuffer, ColorF clear_color) {}
+
+    /// Called for each valid draw.
+    virtual void execute_draw(const Command &cmd, const DrawStateNull &state) {}
+
+    std::shared_ptr<NullDeviceStats> stats_;
+
+private:
+    /// Record a command that a real device would reject.
+    void report(const Command &cmd, const std::string &message);
+};
+
+} // namespace Pathfinder
@@ -0,0 +1,131 @@
+#include "device.h"
+
+#include "buffer.h"
+#include "command_encoder.h"
+#include "objects.h"
+#include "texture.h"
+
+namespace Pathfinder {
+
+// The largest minUniformBufferOffsetAlignment allowed by Vulkan, so that offsets valid here are valid everywhere.
+constexpr size_t NULL_UNIFORM_ALIGNMENT = 256;
+
+DeviceNull::DeviceNull(int frames_in_flight) : Device(frames_in_flight) {
+    backend_type = BackendType::Null;
+
+    stats_ = std::make_shared<NullDeviceStats>();
+}
+
+void DeviceNull::reset_stats() {
+    NullDeviceStats stats;
+
+    stats.buffer_count = stats_->buffer_count;
+    stats.buffer_bytes = stats_->buffer_bytes;
+    stats.peak_buffer_bytes = stats_->buffer_bytes;
+    stats.texture_count = stats_->texture_count;
+    stats.texture_bytes = stats_->texture_bytes;
+    stats.peak_texture_bytes = stats_->texture_bytes;
+
+    // Resources keep a reference to the stats, so update them in place.
+    *stats_ = stats;
+}
+
+std::shared_ptr<Framebuffer> DeviceNull::create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
+                                                            const std::shared_ptr<Texture> &texture,
+                                                            const std::string &label) {
+    return std::shared_ptr<FramebufferNull>(new FramebufferNull(texture, label));
+}
+
+std::shared_ptr<Buffer> DeviceNull::create_buffer(const BufferDescriptor &desc, const std::string &label) {
+    auto buffer_null = std::shared_ptr<BufferNull>(new BufferNull(desc, stats_));
+    buffer_null->set_label(label);
+    return buffer_null;
+}
+
+std::shared_ptr<Texture> DeviceNull::create_texture(const TextureDescriptor &desc, const std::string &label) {
+    auto texture_null = std::shared_ptr<TextureNull>(new TextureNull(desc, stats_));
+    texture_null->set_label(label);
+    return texture_null;
+}
+
+std::shared_ptr<Sampler> DeviceNull::create_sampler(SamplerDescriptor descriptor) {
+    return std::shared_ptr<SamplerNull>(new SamplerNull(descriptor));
+}
+
+std::shared_ptr<CommandEncoder> DeviceNull::allocate_command_encoder() {
+    return std::shared_ptr<CommandEncoderNull>(new CommandEncoderNull(stats_));
+}
+
+std::shared_ptr<RenderPass> DeviceNull::create_render_pass(TextureFormat format,
+                                                           AttachmentLoadOp load_op,
+                                                           const std::string &label) {
+    return std::shared_ptr<RenderPassNull>(new RenderPassNull(load_op, label));
+}
+
+std::shared_ptr<RenderPass> DeviceNull::create_swap_chain_render_pass(TextureFormat format, AttachmentLoadOp load_op) {
+    return std::shared_ptr<RenderPassNull>(new RenderPassNull(load_op, "Swapchain Render Pass"));
+}
+
+std::shared_ptr<DescriptorSetLayout> DeviceNull::create_descriptor_set_layout(
+    const std::vector<DescriptorLayout> &descriptors) {
+    return std::shared_ptr<DescriptorSetLayout>(new DescriptorSetLayout(descriptors));
+}
+
+std::shared_ptr<DescriptorSet> DeviceNull::create_descriptor_set(std::shared_ptr<DescriptorSetLayout> layout) {
+    return std::shared_ptr<DescriptorSet>(new DescriptorSet(layout));
+}
+
+std::shared_ptr<ShaderModule> DeviceNull::create_shader_module(const std::shared_ptr<Shader> &shader,
+                                                               const std::string &label) {
+    return std::shared_ptr<ShaderModuleNull>(new ShaderModuleNull(label));
+}
+
+std::shared_ptr<ShaderModule> DeviceNull::create_shader_module(const std::vector<char> &source_code,
+                                                               ShaderStage shader_stage,
+                                                               const std::string &label) {
+    return std::shared_ptr<ShaderModuleNull>(new ShaderModuleNull(label));
+}
+
+std::shared_ptr<RenderPipeline> DeviceNull::create_render_pipeline(
+    const std::shared_ptr<ShaderModule> &vert_shader_module,
+    const std::shared_ptr<ShaderModule> &frag_shader_module,
+    const std::vector<VertexInputAttributeDescription> &attribute_descriptions,
+    BlendState blend_state,
+    const std::shared_ptr<DescriptorSetLayout> &descriptor_set_layout,
+    TextureFormat target_format,
+    const std::string &label) {
+    return std::shared_ptr<RenderPipelineNull>(
+        new RenderPipelineNull(attribute_descriptions, blend_state, descriptor_set_layout, target_format, label));
+}
+
+std::shared_ptr<ComputePipeline> DeviceNull::create_compute_pipeline(
+    const std::shared_ptr<ShaderModule> &comp_shader_module,
+    const std::shared_ptr<DescriptorSetLayout> &descriptor_set_layout,
+    const std::string &label) {
+    return std::shared_ptr<ComputePipelineNull>(new ComputePipelineNull(descriptor_set_layout, label));
+}
+
+std::shared_ptr<Fence> DeviceNull::create_fence(const std::string &label) {
+    auto fence = std::make_shared<Fence>();
+    fence->label = label;
+    return fence;
+}
+
+void *DeviceNull::map_staging(const StagingAllocation &allocation) {
+    auto buffer_null = (BufferNull *)allocation.buffer.get();
+    return buffer_null->get_data() + allocation.offset;
+}
+
+std::shared_ptr<Buffer> DeviceNull::create_staging_buffer(size_t size) {
+    BufferDescriptor desc;
+    desc.type = BufferType::Storage;
+    desc.size = size;
+    desc.property = MemoryProperty::HostVisibleAndCoherent;
+    return create_buffer(desc, "Null Staging Buffer");
+}
+
+size_t DeviceNull::get_aligned_uniform_size(size_t original_size) {
+    return (original_size + NULL_UNIFORM_ALIGNMENT - 1) & ~(NULL_UNIFORM_ALIGNMENT - 1);
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <memory>
+
+#include "../device.h"
+#include "stats.h"
+
+namespace Pathfinder {
+
+/// A device that records and validates commands without a GPU, for measuring the CPU cost of building scenes and
+/// encoding commands, and for running on machines without a graphics driver.
+///
+/// Transfers are carried out on host memory, so uploads and readbacks behave as on a real device. Shaders aren't
+/// run, so whatever the GPU would write reads back as it was last uploaded (zeros if never).
+/// This is enough for the D3D9 renderer and for the CPU stages of the D3D11 renderer.
+class DeviceNull : public Device {
+public:
+    explicit DeviceNull(int frames_in_flight);
+
+    std::shared_ptr<Framebuffer> create_framebuffer(const std::shared_ptr<RenderPass> &render_pass,
+                                                    const std::shared_ptr<Texture> &texture,
+                                                    const std::string &label) override;
+
+    std::shared_ptr<Buffer> create_buffer(const BufferDescriptor &desc, const std::string &label) override;
+
+    std::shared_ptr<Texture> create_texture(const TextureDescriptor &desc, const std::string &label) override;
+
+    std::shared_ptr<Sampler> create_sampler(SamplerDescriptor descriptor) override;
+
+    std::shared_ptr<CommandEncoder> allocate_command_encoder() override;
+
+    std::shared_ptr<RenderPass> create_render_pass(TextureFormat format,
+                                                   AttachmentLoadOp load_op,
+                                                   const std::string &label) override;
+
+    std::shared_ptr<RenderPass> create_swap_chain_render_pass(TextureFormat format, AttachmentLoadOp load_op) override;
+
+    std::shared_ptr<DescriptorSetLayout> create_descriptor_set_layout(
+        const std::vector<DescriptorLayout> &descriptors) override;
+
+    std::shared_ptr<DescriptorSet> create_descriptor_set(std::shared_ptr<DescriptorSetLayout> layout) override;
+
+    std::shared_ptr<ShaderModule> create_shader_module(const std::shared_ptr<Shader> &shader,
+                                                       const std::string &label) override;
+
+    std::shared_ptr<ShaderModule> create_shader_module(const std::vector<char> &source_code,
+                                                       ShaderStage shader_stage,
+                                                       const std::string &label) override;
+
+    std::shared_ptr<RenderPipeline> create_render_pipeline(
+        const std::shared_ptr<ShaderModule> &vert_shader_module,
+        const std::shared_ptr<ShaderModule> &frag_shader_module,
+        const std::vector<VertexInputAttributeDescription> &attribute_descriptions,
+        BlendState blend_state,
+        const std::shared_ptr<DescriptorSetLayout> &descriptor_set_layout,
+        TextureFormat target_format,
+        const std::string &label) override;
+
+    std::shared_ptr<ComputePipeline> create_compute_pipeline(
+        const std::shared_ptr<ShaderModule> &comp_shader_module,
+        const std::shared_ptr<DescriptorSetLayout> &descriptor_set_layout,
+        const std::string &label) override;
+
+    std::shared_ptr<Fence> create_fence(const std::string &label) override;
+
+    void *map_staging(const StagingAllocation &allocation) override;
+
+    std::shared_ptr<Buffer> create_staging_buffer(size_t size) override;
+
+    size_t get_aligned_uniform_size(size_t original_size) override;
+
+    const NullDeviceStats &get_stats() const {
+        return *stats_;
+    }
+
+    /// Zero the counters. Live resource counts and sizes are kept, and peaks restart from them.
+    void reset_stats();
+
+protected:
+    std::shared_ptr<NullDeviceStats> stats_;
+};
+
+} // namespace Pathfinder
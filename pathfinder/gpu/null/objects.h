@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../compute_pipeline.h"
+#include "../framebuffer.h"
+#include "../render_pass.h"
+#include "../render_pipeline.h"
+#include "../shader_module.h"
+
+namespace Pathfinder {
+
+// Objects of the null device, which have no state beyond what validation needs.
+
+class RenderPassNull : public RenderPass {
+    friend class DeviceNull;
+
+private:
+    RenderPassNull(AttachmentLoadOp load_op, const std::string &label) {
+        load_op_ = load_op;
+        label_ = label;
+    }
+};
+
+class FramebufferNull : public Framebuffer {
+    friend class DeviceNull;
+
+private:
+    FramebufferNull(const std::shared_ptr<Texture> &texture, const std::string &label) : Framebuffer(texture) {
+        label_ = label;
+    }
+};
+
+class SamplerNull : public Sampler {
+    friend class DeviceNull;
+
+private:
+    explicit SamplerNull(const SamplerDescriptor &descriptor) : Sampler(descriptor) {}
+};
+
+class ShaderModuleNull : public ShaderModule {
+    friend class DeviceNull;
+
+private:
+    explicit ShaderModuleNull(const std::string &label) {
+        label_ = label;
+    }
+};
+
+class RenderPipelineNull : public RenderPipeline {
+    friend class DeviceNull;
+
+public:
+    const std::shared_ptr<DescriptorSetLayout> &get_layout() const {
+        return layout_;
+    }
+
+    TextureFormat get_target_format() const {
+        return target_format_;
+    }
+
+    const std::string &get_label() const {
+        return label_;
+    }
+
+private:
+    RenderPipelineNull(const std::vector<VertexInputAttributeDescription> &attribute_descriptions,
+                       BlendState blend_state,
+                       const std::shared_ptr<DescriptorSetLayout> &layout,
+                       TextureFormat target_format,
+                       std::string label)
+        : RenderPipeline(attribute_descriptions, blend_state, std::move(label)), target_format_(target_format) {
+        layout_ = layout;
+    }
+
+    TextureFormat target_format_;
+};
+
+class ComputePipelineNull : public ComputePipeline {
+    friend class DeviceNull;
+
+public:
+    const std::shared_ptr<DescriptorSetLayout> &get_layout() const {
+        return layout_;
+    }
+
+    const std::string &get_label() const {
+        return label_;
+    }
+
+private:
+    ComputePipelineNull(const std::shared_ptr<DescriptorSetLayout> &layout, const std::string &label) {
+        layout_ = layout;
+        label_ = label;
+    }
+};
+
+} // namespace Pathfinder
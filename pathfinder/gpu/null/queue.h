@@ -0,0 +1,25 @@
+#pragma once
+
+#include "../../common/logger.h"
+#include "../queue.h"
+
+namespace Pathfinder {
+
+/// Commands are finished as soon as they're submitted, so fences are never waited on.
+class QueueNull : public Queue {
+public:
+    void submit(const std::shared_ptr<CommandEncoder> &encoder, const std::shared_ptr<Fence> &fence) override {
+        if (encoder->submitted_) {
+            Logger::error("Attempted to submit an encoder that's already been submitted!");
+            return;
+        }
+
+        encoder->submitted_ = true;
+
+        encoder->prepare();
+
+        encoder->invoke_callbacks();
+    }
+};
+
+} // namespace Pathfinder
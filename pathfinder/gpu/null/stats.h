@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "../command_encoder.h"
+
+namespace Pathfinder {
+
+/// Everything recorded by a null device since it was created or its stats were reset.
+struct NullDeviceStats {
+    uint64_t submissions = 0;
+
+    /// Recorded commands per CommandType.
+    std::array<uint64_t, (size_t)CommandType::Max> command_counts{};
+
+    uint64_t draw_calls = 0;
+    /// Vertices times instances. Unknown for indirect draws, which aren't included.
+    uint64_t drawn_vertices = 0;
+
+    uint64_t dispatches = 0;
+    /// Unknown for indirect dispatches, which aren't included.
+    uint64_t dispatched_workgroups = 0;
+
+    /// Transfers recorded by command encoders.
+    uint64_t buffer_bytes_written = 0;
+    uint64_t buffer_bytes_read = 0;
+    uint64_t texture_bytes_written = 0;
+    uint64_t texture_bytes_read = 0;
+
+    /// Recorded by CommandEncoder::push_constants.
+    uint64_t push_constant_bytes = 0;
+
+    /// Host access through Buffer::upload_via_mapping and Buffer::download_via_mapping.
+    uint64_t mapped_bytes_written = 0;
+    uint64_t mapped_bytes_read = 0;
+
+    /// Commands that would be invalid on a real device. Each one is also logged.
+    uint64_t validation_errors = 0;
+
+    uint64_t buffers_created = 0;
+    uint64_t textures_created = 0;
+
+    /// Alive at the moment, and the highest since the last reset.
+    size_t buffer_count = 0;
+    size_t buffer_bytes = 0;
+    size_t peak_buffer_bytes = 0;
+
+    size_t texture_count = 0;
+    size_t texture_bytes = 0;
+    size_t peak_texture_bytes = 0;
+
+    uint64_t get_command_count(CommandType type) const {
+        return command_counts[(size_t)type];
+    }
+};
+
+} // namespace Pathfinder
@@ -0,0 +1,27 @@
+#include "texture.h"
+
+#include <algorithm>
+
+namespace Pathfinder {
+
+TextureNull::TextureNull(const TextureDescriptor &desc, const std::shared_ptr<NullDeviceStats> &stats)
+    : Texture(desc), stats_(stats) {
+    stats_->textures_created++;
+    stats_->texture_count++;
+    stats_->texture_bytes += desc.byte_size();
+    stats_->peak_texture_bytes = std::max(stats_->peak_texture_bytes, stats_->texture_bytes);
+}
+
+TextureNull::~TextureNull() {
+    stats_->texture_count--;
+    stats_->texture_bytes -= desc_.byte_size();
+}
+
+uint8_t *TextureNull::get_data() {
+    if (data_.empty()) {
+        data_.resize(desc_.byte_size());
+    }
+    return data_.data();
+}
+
+} // namespace Pathfinder
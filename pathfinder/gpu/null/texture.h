@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../texture.h"
+#include "stats.h"
+
+namespace Pathfinder {
+
+/// Texels live in host memory, allocated when the texture is first written or read.
+/// The null device never draws to textures, so render targets only hold what was uploaded. See DeviceCpu.
+class TextureNull : public Texture {
+    friend class DeviceNull;
+
+public:
+    ~TextureNull() override;
+
+    uint8_t* get_data();
+
+private:
+    TextureNull(const TextureDescriptor& desc, const std::shared_ptr<NullDeviceStats>& stats);
+
+    std::vector<uint8_t> data_;
+
+    std::shared_ptr<NullDeviceStats> stats_;
+};
+
+} // namespace Pathfinder
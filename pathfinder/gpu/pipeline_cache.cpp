@@ -0,0 +1,109 @@
+#include "pipeline_cache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include "../common/logger.h"
+#include "../common/math/basic.h"
+
+namespace Pathfinder {
+
+// Bump when the entry layout changes.
+constexpr uint32_t PIPELINE_CACHE_MAGIC = 0x43504650; // "PFPC"
+constexpr uint32_t PIPELINE_CACHE_VERSION = 1;
+
+struct PipelineCacheHeader {
+    uint32_t magic = PIPELINE_CACHE_MAGIC;
+    uint32_t version = PIPELINE_CACHE_VERSION;
+    uint64_t data_size = 0;
+    /// Detects truncated or corrupted entries, e.g. from a process killed in the middle of writing.
+    uint64_t data_hash = 0;
+};
+
+PipelineCache::PipelineCache(const std::string &directory, const std::string &device_identity)
+    : directory_(directory), device_hash_(hash_to_string(device_identity)) {
+    std::error_code error;
+    std::filesystem::create_directories(directory_, error);
+    if (error) {
+        Logger::error("Failed to create pipeline cache directory " + directory_ + ": " + error.message(),
+                      "PipelineCache");
+    }
+}
+
+std::string PipelineCache::hash_to_string(const std::string &data) {
+    char string[17];
+    snprintf(string, sizeof(string), "%016llx", (unsigned long long)fnv_hash(data.data(), data.size()));
+    return string;
+}
+
+std::string PipelineCache::get_entry_path(const std::string &key) const {
+    return (std::filesystem::path(directory_) / (device_hash_ + "-" + key + ".bin")).string();
+}
+
+std::vector<char> PipelineCache::load(const std::string &key) const {
+    auto path = get_entry_path(key);
+
+    // Missing entries are expected, so they aren't reported.
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return {};
+    }
+
+    PipelineCacheHeader header;
+    std::vector<char> data;
+
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && header.magic == PIPELINE_CACHE_MAGIC &&
+                 header.version == PIPELINE_CACHE_VERSION;
+
+    if (valid) {
+        data.resize(header.data_size);
+        valid = fread(data.data(), 1, data.size(), file) == data.size() &&
+                fnv_hash(data.data(), data.size()) == header.data_hash;
+    }
+
+    fclose(file);
+
+    if (!valid) {
+        Logger::warn("Ignoring invalid pipeline cache entry: " + path, "PipelineCache");
+        return {};
+    }
+
+    return data;
+}
+
+void PipelineCache::store(const std::string &key, const std::vector<char> &data) const {
+    auto path = get_entry_path(key);
+
+    // Unique per process and call, as several processes may store the same entry at once.
+    auto temp_path = path + "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "." +
+                     std::to_string((uintptr_t)&data) + ".tmp";
+
+    FILE *file = fopen(temp_path.c_str(), "wb");
+    if (!file) {
+        Logger::error("Failed to write pipeline cache entry: " + path, "PipelineCache");
+        return;
+    }
+
+    PipelineCacheHeader header;
+    header.data_size = data.size();
+    header.data_hash = fnv_hash(data.data(), data.size());
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(data.data(), 1, data.size(), file) == data.size();
+
+    written = fclose(file) == 0 && written;
+
+    std::error_code error;
+    if (written) {
+        std::filesystem::rename(temp_path, path, error);
+    }
+
+    if (!written || error) {
+        Logger::error("Failed to write pipeline cache entry: " + path, "PipelineCache");
+        std::filesystem::remove(temp_path, error);
+    }
+}
+
+} // namespace Pathfinder
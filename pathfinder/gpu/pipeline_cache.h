@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pathfinder {
+
+/// Compiled pipelines stored on disk, so that later processes can skip compiling them.
+///
+/// Each entry is a file in the cache directory. File names start with a hash of the device identity,
+/// as pipeline binaries can only be used by the driver that produced them. Entries are written to a temporary file
+/// first and then renamed, so processes sharing a directory never see a partial entry.
+class PipelineCache {
+public:
+    /// @param device_identity Vendor, device and driver version. Binaries of another identity are never loaded.
+    PipelineCache(const std::string &directory, const std::string &device_identity);
+
+    /// @return Empty if there's no valid entry for the key.
+    std::vector<char> load(const std::string &key) const;
+
+    void store(const std::string &key, const std::vector<char> &data) const;
+
+    const std::string &get_directory() const {
+        return directory_;
+    }
+
+    /// Stable across processes, unlike std::hash.
+    static std::string hash_to_string(const std::string &data);
+
+private:
+    std::string get_entry_path(const std::string &key) const;
+
+    std::string directory_;
+
+    std::string device_hash_;
+};
+
+} // namespace Pathfinder
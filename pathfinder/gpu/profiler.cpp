@@ -0,0 +1,130 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "device.h"
+
+namespace Pathfinder {
+
+GpuProfiler::GpuProfiler(const std::shared_ptr<Device> &device, uint32_t max_scopes_per_frame) : device_(device) {
+    // One more frame than the frames in flight, so that we never read a frame the GPU may still be working on.
+    uint32_t frame_count = device->get_frames_in_flight() + 1;
+
+    for (uint32_t i = 0; i < frame_count; i++) {
+        // Two timestamps per scope.
+        auto query_set = device->create_timestamp_query_set(max_scopes_per_frame * 2, "gpu profiler query set");
+        if (!query_set) {
+            frames_.clear();
+            return;
+        }
+
+        frames_.push_back({query_set});
+    }
+}
+
+bool GpuProfiler::is_supported() const {
+    return !frames_.empty();
+}
+
+void GpuProfiler::begin_frame() {
+    if (!is_supported()) {
+        return;
+    }
+
+    // Renderers call this on every draw, but queries of all draws in a device frame go into the same frame.
+    uint32_t device_frame_index = device_->get_current_frame_index();
+    if (device_frame_index == last_device_frame_index_) {
+        return;
+    }
+    last_device_frame_index_ = device_frame_index;
+
+    current_frame_ = (current_frame_ + 1) % frames_.size();
+    scope_stack_.clear();
+
+    // The oldest frame is reused. If its results are still not available, they're dropped.
+    auto &frame = frames_[current_frame_];
+    resolve(frame);
+
+    frame.scopes.clear();
+    frame.query_count = 0;
+}
+
+void GpuProfiler::begin_scope(const std::shared_ptr<CommandEncoder> &encoder, const std::string &label) {
+    if (!is_supported()) {
+        return;
+    }
+
+    auto &frame = frames_[current_frame_];
+
+    // Out of queries. Skip the scope.
+    if (frame.query_count + 2 > frame.query_set->get_count()) {
+        scope_stack_.push_back(SIZE_MAX);
+        return;
+    }
+
+    scope_stack_.push_back(frame.scopes.size());
+    frame.scopes.push_back({label, frame.query_count});
+
+    encoder->reset_query_set(frame.query_set, frame.query_count, 2);
+    encoder->write_timestamp(frame.query_set, frame.query_count);
+
+    frame.query_count += 2;
+}
+
+void GpuProfiler::end_scope(const std::shared_ptr<CommandEncoder> &encoder) {
+    if (!is_supported()) {
+        return;
+    }
+
+    if (scope_stack_.empty()) {
+        Logger::error("Ended a GPU profiler scope that was never begun!");
+        return;
+    }
+
+    auto scope_index = scope_stack_.back();
+    scope_stack_.pop_back();
+
+    if (scope_index == SIZE_MAX) {
+        return;
+    }
+
+    auto &frame = frames_[current_frame_];
+    encoder->write_timestamp(frame.query_set, frame.scopes[scope_index].first_query + 1);
+}
+
+const std::vector<GpuTiming> &GpuProfiler::get_timings() const {
+    return timings_;
+}
+
+bool GpuProfiler::resolve(Frame &frame) {
+    if (frame.scopes.empty()) {
+        return false;
+    }
+
+    std::vector<uint64_t> timestamps;
+    if (!frame.query_set->get_results(0, frame.query_count, timestamps)) {
+        return false;
+    }
+
+    timings_.clear();
+
+    for (const auto &scope : frame.scopes) {
+        auto begin = timestamps[scope.first_query];
+        auto end = timestamps[scope.first_query + 1];
+        double time = end > begin ? double(end - begin) * 1e-6 : 0;
+
+        auto iter = std::find_if(
+            timings_.begin(), timings_.end(), [&scope](const GpuTiming &timing) { return timing.label == scope.label; });
+
+        if (iter == timings_.end()) {
+            timings_.push_back({scope.label, time});
+        } else {
+            iter->time += time;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "command_encoder.h"
+#include "query_set.h"
+
+namespace Pathfinder {
+
+class Device;
+
+/// GPU time spent in scopes with the same label during a frame.
+struct GpuTiming {
+    std::string label;
+    /// In ms.
+    double time = 0;
+};
+
+/// Measures GPU time of labeled scopes using timestamp queries.
+///
+/// Each frame writes into its own query set. Results are read back when the query set is
+/// about to be reused, frames later, so reading them never stalls the pipeline.
+/// Does nothing if the device doesn't support timestamp queries.
+class GpuProfiler {
+public:
+    explicit GpuProfiler(const std::shared_ptr<Device> &device, uint32_t max_scopes_per_frame = 128);
+
+    bool is_supported() const;
+
+    /// Resolve the oldest frame and start writing queries of a new one.
+    /// Only the first call in a device frame does so, later ones are ignored.
+    void begin_frame();
+
+    /// Scopes can be nested. Don't begin a scope inside a render pass.
+    void begin_scope(const std::shared_ptr<CommandEncoder> &encoder, const std::string &label);
+
+    void end_scope(const std::shared_ptr<CommandEncoder> &encoder);
+
+    /// Timings of the latest resolved frame, in the order the labels first appeared.
+    const std::vector<GpuTiming> &get_timings() const;
+
+private:
+    struct Scope {
+        std::string label;
+        uint32_t first_query = 0;
+    };
+
+    struct Frame {
+        std::shared_ptr<QuerySet> query_set;
+        std::vector<Scope> scopes;
+        uint32_t query_count = 0;
+    };
+
+    /// @return If the frame's results were available.
+    bool resolve(Frame &frame);
+
+    std::shared_ptr<Device> device_;
+
+    std::vector<Frame> frames_;
+
+    uint32_t current_frame_ = 0;
+
+    uint32_t last_device_frame_index_ = std::numeric_limits<uint32_t>::max();
+
+    /// Indices of unfinished scopes in the current frame.
+    std::vector<size_t> scope_stack_;
+
+    std::vector<GpuTiming> timings_;
+};
+
+} // namespace Pathfinder
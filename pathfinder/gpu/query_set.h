@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pathfinder {
+
+/// A fixed-size set of GPU timestamp queries.
+/// Timestamps are written by a command encoder and read back later without stalling.
+class QuerySet {
+public:
+    virtual ~QuerySet() = default;
+
+    uint32_t get_count() const {
+        return count_;
+    }
+
+    /**
+     * Read back timestamps without waiting for the GPU.
+     * @param first_query
+     * @param query_count
+     * @param timestamps Receives the timestamps in nanoseconds.
+     * @return False if any of the queries is not available yet.
+     */
+    virtual bool get_results(uint32_t first_query, uint32_t query_count, std::vector<uint64_t> &timestamps) = 0;
+
+protected:
+    explicit QuerySet(uint32_t count) : count_(count) {}
+
+    uint32_t count_;
+
+    /// Debug label.
+    std::string label_;
+};
+
+} // namespace Pathfinder
@@ -16,12 +16,38 @@ public:
 
     virtual void submit(const std::shared_ptr<CommandEncoder> &encoder, const std::shared_ptr<Fence> &fence) = 0;
 
+    /// Submit without waiting for the GPU to finish the commands.
+    /// Returns a token of the submission. The callbacks of the encoder (e.g. from read_buffer) are invoked
+    /// once it has completed, which is checked at begin_frame() or forced by wait().
+    /// Backends that execute submissions synchronously complete them right away.
+    virtual uint64_t submit_async(const std::shared_ptr<CommandEncoder> &encoder) {
+        submit(encoder, nullptr);
+        return ++last_submission_;
+    }
+
+    /// Whether the GPU has finished the submission.
+    virtual bool is_complete(uint64_t submission) {
+        return true;
+    }
+
+    /// Block until the GPU has finished the submission and invoke the callbacks of everything completed so far.
+    virtual void wait(uint64_t submission) {}
+
+    /// Make the next submission of this queue wait on the GPU for a submission of another queue.
+    /// Backends without cross-queue synchronization wait for it on the CPU instead.
+    virtual void wait_for(Queue &other, uint64_t submission) {
+        other.wait(submission);
+    }
+
     virtual void begin_frame(uint32_t current_frame_index) {}
 
     virtual void wait_idle() {}
 
 protected:
     uint32_t current_frame_index_{};
+
+    /// Token of the latest submission.
+    uint64_t last_submission_{};
 };
 
 } // namespace Pathfinder
@@ -0,0 +1,57 @@
+#include "staging_ring.h"
+
+namespace Pathfinder {
+
+bool StagingRing::allocate(size_t size, size_t alignment, uint32_t frame_index, size_t &offset) {
+    if (in_flight_frames_.empty()) {
+        head_ = 0;
+        tail_ = 0;
+    }
+
+    size_t aligned_head = (head_ + alignment - 1) & ~(alignment - 1);
+
+    if (in_flight_frames_.empty() || head_ > tail_) {
+        // Free space is after the head, and before the tail once wrapped around.
+        if (aligned_head + size <= capacity_) {
+            offset = aligned_head;
+        } else if (size <= tail_) {
+            offset = 0;
+        } else {
+            return false;
+        }
+    } else if (head_ < tail_) {
+        if (aligned_head + size > tail_) {
+            return false;
+        }
+        offset = aligned_head;
+    } else {
+        // The head has caught up with the tail.
+        return false;
+    }
+
+    head_ = offset + size;
+
+    if (!in_flight_frames_.empty() && in_flight_frames_.back().frame_index == frame_index) {
+        in_flight_frames_.back().head = head_;
+    } else {
+        in_flight_frames_.push_back({frame_index, head_});
+    }
+
+    return true;
+}
+
+void StagingRing::retire(uint32_t frame_index) {
+    while (!in_flight_frames_.empty() && (int32_t)(frame_index - in_flight_frames_.front().frame_index) >= 0) {
+        tail_ = in_flight_frames_.front().head;
+        in_flight_frames_.pop_front();
+    }
+}
+
+void StagingRing::reset(size_t capacity) {
+    capacity_ = capacity;
+    head_ = 0;
+    tail_ = 0;
+    in_flight_frames_.clear();
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace Pathfinder {
+
+/// Offset bookkeeping of a ring of staging memory.
+///
+/// Allocations are made at the head and tagged with the frame that made them. Once a frame has retired
+/// (its fence has been waited on), everything it allocated is released from the tail in one go.
+class StagingRing {
+public:
+    explicit StagingRing(size_t capacity = 0) : capacity_(capacity) {}
+
+    /// @return False if there's not enough free space left, i.e. the caller would have to wait for a frame to retire.
+    bool allocate(size_t size, size_t alignment, uint32_t frame_index, size_t &offset);
+
+    /// Release the allocations of all frames up to and including `frame_index`.
+    void retire(uint32_t frame_index);
+
+    /// Drop all allocations and change the capacity.
+    void reset(size_t capacity);
+
+    size_t get_capacity() const {
+        return capacity_;
+    }
+
+private:
+    struct FrameMarker {
+        uint32_t frame_index;
+        /// Head position after the last allocation of the frame.
+        size_t head;
+    };
+
+    size_t capacity_;
+
+    size_t head_ = 0;
+    size_t tail_ = 0;
+
+    /// Frames with allocations that haven't retired yet, oldest first.
+    std::deque<FrameMarker> in_flight_frames_;
+};
+
+} // namespace Pathfinder
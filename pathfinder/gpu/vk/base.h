@@ -85,6 +85,8 @@ inline VkDescriptorType to_vk_descriptor_type(DescriptorType descriptor_type) {
             return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
         case DescriptorType::Image:
             return VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        case DescriptorType::PushConstant:
+            return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
         default:
             abort();
     }
@@ -9,12 +9,16 @@
 #include "descriptor_set.h"
 #include "device.h"
 #include "framebuffer.h"
+#include "query_set.h"
 #include "render_pass.h"
 #include "render_pipeline.h"
 #include "texture.h"
 
 namespace Pathfinder {
 
+/// Dynamic uniform buffers per set guaranteed by Vulkan, which limits the push constant bindings of a set.
+constexpr size_t MAX_DYNAMIC_OFFSETS = 8;
+
 /// Correct image layout should be set even before binding, not just before submitting command buffer.
 /// Also, it can't be set during a render pass.
 VkImageMemoryBarrier generate_image_barrier(VkImage image,
@@ -105,11 +109,12 @@ VkImageMemoryBarrier generate_image_barrier(VkImage image,
     return barrier;
 }
 
-CommandEncoderVk::CommandEncoderVk(VkCommandBuffer vk_command_buffer, DeviceVk *device)
-    : vk_command_buffer_(vk_command_buffer), vk_device_(device->get_device()), device_vk_(device) {}
+CommandEncoderVk::CommandEncoderVk(DeviceVk *device) : vk_device_(device->get_device()), device_vk_(device) {}
+
+void CommandEncoderVk::reset() {
+    CommandEncoder::reset();
 
-CommandEncoderVk::~CommandEncoderVk() {
-    vkFreeCommandBuffers(vk_device_, device_vk_->get_command_pool(), 1, &vk_command_buffer_);
+    // The command buffer belongs to the frame pool, which recycles it.
     vk_command_buffer_ = VK_NULL_HANDLE;
 }
 
@@ -124,6 +129,8 @@ bool CommandEncoderVk::prepare() {
         return false;
     }
 
+    vk_command_buffer_ = device_vk_->acquire_frame_command_buffer();
+
     // Begin recording.
     VkCommandBufferBeginInfo begin_info{};
     begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -136,6 +143,16 @@ bool CommandEncoderVk::prepare() {
         ->get_debug_marker()
         .begin_region(vk_command_buffer_, label_, ColorF(1.0f, 0.78f, 0.05f, 1.0f));
 
+    // All push constants of the encoder are copied at once. Each push is then a dynamic offset into the copy.
+    uint32_t push_constant_base = 0;
+    if (!push_constant_data_.empty()) {
+        push_constant_base =
+            device_vk_->allocate_push_constants(push_constant_data_.data(), push_constant_data_.size());
+    }
+
+    bound_descriptor_set_ = nullptr;
+    push_constant_offsets_.clear();
+
     for (auto cmd_iter = commands_.begin(); cmd_iter < commands_.end(); ++cmd_iter) {
         auto const &cmd = *cmd_iter;
 
@@ -284,51 +301,25 @@ bool CommandEncoderVk::prepare() {
             } break;
             case CommandType::BindDescriptorSet: {
                 auto &args = cmd.args.bind_descriptor_set;
-                auto descriptor_set_vk = static_cast<DescriptorSetVk *>(args.descriptor_set);
-
-                auto descriptor_set_layout = args.descriptor_set->get_layout();
-                auto descriptor_set_layout_vk = (DescriptorSetLayoutVk *)descriptor_set_layout.get();
-                auto vk_descriptor_set_layout = descriptor_set_layout_vk->get_vk_layout();
-
-                if (render_pipeline_) {
-                    auto render_pipeline_vk = static_cast<RenderPipelineVk *>(render_pipeline_);
-
-                    descriptor_set_vk->update_vk_descriptor_set(vk_device_, vk_descriptor_set_layout);
-
-                    // Bind uniform buffers and samplers.
-                    vkCmdBindDescriptorSets(vk_command_buffer_,
-                                            VK_PIPELINE_BIND_POINT_GRAPHICS,
-                                            render_pipeline_vk->get_layout(),
-                                            0,
-                                            1,
-                                            &descriptor_set_vk->get_vk_descriptor_set(),
-                                            0,
-                                            nullptr);
-                } else if (compute_pipeline_) {
-                    auto compute_pipeline_vk = static_cast<ComputePipelineVk *>(compute_pipeline_);
-
-                    descriptor_set_vk->update_vk_descriptor_set(vk_device_, vk_descriptor_set_layout);
-
-                    // Bind uniform buffers and samplers.
-                    vkCmdBindDescriptorSets(vk_command_buffer_,
-                                            VK_PIPELINE_BIND_POINT_COMPUTE,
-                                            compute_pipeline_vk->get_layout(),
-                                            0,
-                                            1,
-                                            &descriptor_set_vk->get_vk_descriptor_set(),
-                                            0,
-                                            nullptr);
-                } else {
-                    Logger::error("No valid pipeline bound when binding descriptor set!");
-                    abort();
-                }
+
+                // Bound by the next draw or dispatch, together with the constants pushed until then.
+                bound_descriptor_set_ = static_cast<DescriptorSetVk *>(args.descriptor_set);
+                descriptor_set_bound_ = false;
+            } break;
+            case CommandType::PushConstants: {
+                auto &args = cmd.args.push_constants;
+
+                // Applied by the next draw or dispatch, so that consecutive pushes take a single rebind.
+                push_constant_offsets_[args.binding] = push_constant_base + args.data_offset;
             } break;
             case CommandType::Draw: {
                 auto &args = cmd.args.draw;
+                flush_push_constants();
                 vkCmdDraw(vk_command_buffer_, args.vertex_count, 1, 0, 0);
             } break;
             case CommandType::DrawIndexed: {
                 auto &args = cmd.args.draw_indexed;
+                flush_push_constants();
                 vkCmdDrawIndexed(vk_command_buffer_,
                                  args.index_count,
                                  args.instance_count,
@@ -338,17 +329,20 @@ bool CommandEncoderVk::prepare() {
             } break;
             case CommandType::DrawInstanced: {
                 auto &args = cmd.args.draw_instanced;
+                flush_push_constants();
                 vkCmdDraw(vk_command_buffer_, args.vertex_count, args.instance_count, 0, 0);
             } break;
             case CommandType::DrawIndirect: {
                 auto &args = cmd.args.indirect;
                 auto buffer_vk = static_cast<BufferVk *>(args.buffer);
+                flush_push_constants();
                 vkCmdDrawIndirect(vk_command_buffer_, buffer_vk->get_vk_buffer(), args.offset, 1, 0);
             } break;
             case CommandType::EndRenderPass: {
                 vkCmdEndRenderPass(vk_command_buffer_);
 
                 render_pipeline_ = nullptr;
+                bound_descriptor_set_ = nullptr;
             } break;
             case CommandType::BeginComputePass: {
                 assert(render_pipeline_ == nullptr);
@@ -374,16 +368,38 @@ bool CommandEncoderVk::prepare() {
             case CommandType::Dispatch: {
                 auto &args = cmd.args.dispatch;
 
+                flush_push_constants();
+
                 // Dispatch compute job.
                 vkCmdDispatch(vk_command_buffer_, args.group_size_x, args.group_size_y, args.group_size_z);
+
+                // Later dispatches and buffer reads in the same encoder may depend on the results.
+                VkMemoryBarrier barrier{};
+                barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+                barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT |
+                                        VK_ACCESS_TRANSFER_READ_BIT;
+
+                vkCmdPipelineBarrier(vk_command_buffer_,
+                                     VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                                     VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                     0,
+                                     1,
+                                     &barrier,
+                                     0,
+                                     nullptr,
+                                     0,
+                                     nullptr);
             } break;
             case CommandType::DispatchIndirect: {
                 auto &args = cmd.args.indirect;
                 auto buffer_vk = static_cast<BufferVk *>(args.buffer);
+                flush_push_constants();
                 vkCmdDispatchIndirect(vk_command_buffer_, buffer_vk->get_vk_buffer(), args.offset);
             } break;
             case CommandType::EndComputePass: {
                 compute_pipeline_ = nullptr;
+                bound_descriptor_set_ = nullptr;
             } break;
             case CommandType::WriteBuffer: {
                 auto &args = cmd.args.write_buffer;
@@ -535,6 +551,39 @@ bool CommandEncoderVk::prepare() {
                                            &region);
                 }
             } break;
+            case CommandType::MemoryBarrier: {
+                VkMemoryBarrier barrier{};
+                barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+                barrier.dstAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+
+                vkCmdPipelineBarrier(vk_command_buffer_,
+                                     VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                     VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+                                     0,
+                                     1,
+                                     &barrier,
+                                     0,
+                                     nullptr,
+                                     0,
+                                     nullptr);
+            } break;
+            case CommandType::ResetQuerySet: {
+                auto &args = cmd.args.reset_query_set;
+                auto query_set_vk = static_cast<QuerySetVk *>(args.query_set);
+
+                vkCmdResetQueryPool(
+                    vk_command_buffer_, query_set_vk->get_vk_query_pool(), args.first_query, args.query_count);
+            } break;
+            case CommandType::WriteTimestamp: {
+                auto &args = cmd.args.write_timestamp;
+                auto query_set_vk = static_cast<QuerySetVk *>(args.query_set);
+
+                vkCmdWriteTimestamp(vk_command_buffer_,
+                                    VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                    query_set_vk->get_vk_query_pool(),
+                                    args.query_index);
+            } break;
             case CommandType::Max:
                 break;
         }
@@ -552,6 +601,77 @@ bool CommandEncoderVk::prepare() {
     return true;
 }
 
+void CommandEncoderVk::bind_vk_descriptor_set(DescriptorSetVk *descriptor_set) {
+    VkPipelineBindPoint bind_point;
+    VkPipelineLayout vk_pipeline_layout;
+
+    if (render_pipeline_) {
+        bind_point = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        vk_pipeline_layout = static_cast<RenderPipelineVk *>(render_pipeline_)->get_layout();
+    } else if (compute_pipeline_) {
+        bind_point = VK_PIPELINE_BIND_POINT_COMPUTE;
+        vk_pipeline_layout = static_cast<ComputePipelineVk *>(compute_pipeline_)->get_layout();
+    } else {
+        Logger::error("No valid pipeline bound when binding descriptor set!");
+        abort();
+    }
+
+    auto descriptor_set_layout = descriptor_set->get_layout();
+    auto descriptor_set_layout_vk = (DescriptorSetLayoutVk *)descriptor_set_layout.get();
+
+    descriptor_set->update_vk_descriptor_set(vk_device_,
+                                             descriptor_set_layout_vk->get_vk_layout(),
+                                             device_vk_->get_push_constant_buffer());
+
+    get_dynamic_offsets(descriptor_set, bound_dynamic_offsets_);
+
+    // Bind uniform buffers and samplers.
+    vkCmdBindDescriptorSets(vk_command_buffer_,
+                            bind_point,
+                            vk_pipeline_layout,
+                            0,
+                            1,
+                            &descriptor_set->get_vk_descriptor_set(),
+                            (uint32_t)bound_dynamic_offsets_.size(),
+                            bound_dynamic_offsets_.data());
+
+    bound_descriptor_set_ = descriptor_set;
+    descriptor_set_bound_ = true;
+}
+
+void CommandEncoderVk::get_dynamic_offsets(DescriptorSetVk *descriptor_set, std::vector<uint32_t> &offsets) const {
+    offsets.clear();
+
+    auto descriptor_set_layout = descriptor_set->get_layout();
+
+    // One offset per push constant binding, in binding order. Bindings that haven't been pushed read the start of
+    // the buffer.
+    for (auto &pair : descriptor_set_layout->get_descriptor_layouts()) {
+        if (pair.second.type != DescriptorType::PushConstant || offsets.size() == MAX_DYNAMIC_OFFSETS) {
+            continue;
+        }
+
+        auto it = push_constant_offsets_.find(pair.first);
+        offsets.push_back(it == push_constant_offsets_.end() ? 0 : it->second);
+    }
+}
+
+void CommandEncoderVk::flush_push_constants() {
+    if (bound_descriptor_set_ == nullptr) {
+        return;
+    }
+
+    // Pushes with offsets equal to the bound ones, or none at all, need no rebind.
+    if (descriptor_set_bound_) {
+        get_dynamic_offsets(bound_descriptor_set_, pending_dynamic_offsets_);
+        if (pending_dynamic_offsets_ == bound_dynamic_offsets_) {
+            return;
+        }
+    }
+
+    bind_vk_descriptor_set(bound_descriptor_set_);
+}
+
 void CommandEncoderVk::add_barriers_for_descriptor_set(DescriptorSet *descriptor_set) {
     auto descriptor_set_vk = static_cast<DescriptorSetVk *>(descriptor_set);
 
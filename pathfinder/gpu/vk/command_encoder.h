@@ -1,5 +1,8 @@
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "../command_encoder.h"
 #include "device.h"
 
@@ -10,21 +13,47 @@ class CommandEncoderVk : public CommandEncoder {
     friend class QueueVk;
     friend class SwapChainVk;
 
-public:
-    ~CommandEncoderVk() override;
-
 private:
-    CommandEncoderVk(VkCommandBuffer vk_command_buffer, DeviceVk *device);
+    explicit CommandEncoderVk(DeviceVk *device);
 
     void add_barriers_for_descriptor_set(DescriptorSet *descriptor_set);
 
+    /// Bind to the current pipeline, with the latest offsets of its push constants.
+    void bind_vk_descriptor_set(DescriptorSetVk *descriptor_set);
+
+    /// Latest offsets of the push constant bindings of a set.
+    void get_dynamic_offsets(DescriptorSetVk *descriptor_set, std::vector<uint32_t> &offsets) const;
+
+    /// Bind the current set if it hasn't been bound yet, or again if constants have been pushed since.
+    /// Called before each draw and dispatch.
+    void flush_push_constants();
+
     bool prepare() override;
 
+    void reset() override;
+
+    /// Taken from the device's per-frame command pool when the encoder is prepared.
     VkCommandBuffer vk_command_buffer_{};
 
     VkDevice vk_device_{};
 
     DeviceVk *device_vk_{};
+
+    /// Bound in the current pass. Push constants are emulated with dynamic uniform buffers, so the set is bound
+    /// again with new offsets by the first draw or dispatch after a push.
+    DescriptorSetVk *bound_descriptor_set_{};
+
+    /// If bound_descriptor_set_ has been bound to the command buffer yet.
+    bool descriptor_set_bound_ = false;
+
+    /// Dynamic offsets of the pushed constants, by binding.
+    std::map<uint32_t, uint32_t> push_constant_offsets_;
+
+    /// Offsets the current set was bound with.
+    std::vector<uint32_t> bound_dynamic_offsets_;
+
+    /// Scratch for comparing with bound_dynamic_offsets_.
+    std::vector<uint32_t> pending_dynamic_offsets_;
 };
 
 } // namespace Pathfinder
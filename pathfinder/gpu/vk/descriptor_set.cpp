@@ -1,5 +1,6 @@
 #include "descriptor_set.h"
 
+#include <array>
 #include <cassert>
 
 #include "buffer.h"
@@ -7,60 +8,88 @@
 
 namespace Pathfinder {
 
-void DescriptorSetVk::update_vk_descriptor_set(VkDevice vk_device, VkDescriptorSetLayout vk_descriptor_set_layout) {
-    vk_device_ = vk_device;
+// Sets per shared pool. Descriptor counts of each type are sized for sets with a few bindings of that type.
+constexpr uint32_t DESCRIPTOR_POOL_MAX_SETS = 256;
+constexpr uint32_t DESCRIPTOR_POOL_DESCRIPTORS_PER_SET = 8;
 
-    if (!dirty) {
-        return;
+DescriptorPoolAllocatorVk::~DescriptorPoolAllocatorVk() {
+    // When we destroy a pool, the sets inside are destroyed as well.
+    for (auto pool : pools_) {
+        vkDestroyDescriptorPool(vk_device_, pool, nullptr);
     }
+}
 
-    auto descriptor_layouts = layout_->get_descriptor_layouts();
+VkDescriptorPool DescriptorPoolAllocatorVk::create_pool() {
+    std::array<VkDescriptorPoolSize, 5> pool_sizes{};
+    pool_sizes[0].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    pool_sizes[1].type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+    pool_sizes[2].type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    pool_sizes[3].type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+    pool_sizes[4].type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
 
-    // Create descriptor pool and allocate descriptor sets.
-    if (!descriptor_set_allocated_) {
-        // Get pool sizes.
-        std::vector<VkDescriptorPoolSize> pool_sizes{};
-
-        for (auto &d : descriptor_layouts) {
-            VkDescriptorPoolSize pool_size{};
-            pool_size.descriptorCount = 1;
-
-            switch (d.second.type) {
-                case DescriptorType::UniformBuffer: {
-                    pool_size.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-                } break;
-                case DescriptorType::Sampler: {
-                    pool_size.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-                } break;
-                case DescriptorType::StorageBuffer: {
-                    pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-                } break;
-                case DescriptorType::Image: {
-                    pool_size.type = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-                } break;
-                default: {
-                    abort();
-                }
-            }
+    for (auto &pool_size : pool_sizes) {
+        pool_size.descriptorCount = DESCRIPTOR_POOL_MAX_SETS * DESCRIPTOR_POOL_DESCRIPTORS_PER_SET;
+    }
+
+    VkDescriptorPoolCreateInfo pool_info{};
+    pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    // Cached sets are dropped one by one.
+    pool_info.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    pool_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
+    pool_info.pPoolSizes = pool_sizes.data();
+    pool_info.maxSets = DESCRIPTOR_POOL_MAX_SETS;
+
+    VkDescriptorPool pool;
+    VK_CHECK_RESULT(vkCreateDescriptorPool(vk_device_, &pool_info, nullptr, &pool))
 
-            pool_sizes.push_back(pool_size);
+    pools_.push_back(pool);
+
+    return pool;
+}
+
+VkDescriptorPool DescriptorPoolAllocatorVk::allocate(VkDescriptorSetLayout vk_layout,
+                                                     VkDescriptorSet &vk_descriptor_set) {
+    VkDescriptorSetAllocateInfo alloc_info{};
+    alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    alloc_info.descriptorSetCount = 1;
+    alloc_info.pSetLayouts = &vk_layout;
+
+    // Sets freed from older pools leave room in them, so try every pool, latest first.
+    for (auto it = pools_.rbegin(); it != pools_.rend(); ++it) {
+        alloc_info.descriptorPool = *it;
+
+        if (vkAllocateDescriptorSets(vk_device_, &alloc_info, &vk_descriptor_set) == VK_SUCCESS) {
+            return *it;
         }
+    }
 
-        VkDescriptorPoolCreateInfo pool_info{};
-        pool_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-        pool_info.poolSizeCount = static_cast<uint32_t>(pool_sizes.size());
-        pool_info.pPoolSizes = pool_sizes.data();
-        pool_info.maxSets = 1;
+    alloc_info.descriptorPool = create_pool();
 
-        VK_CHECK_RESULT(vkCreateDescriptorPool(vk_device_, &pool_info, nullptr, &vk_descriptor_pool_))
+    VK_CHECK_RESULT(vkAllocateDescriptorSets(vk_device_, &alloc_info, &vk_descriptor_set))
 
-        VkDescriptorSetAllocateInfo alloc_info{};
-        alloc_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-        alloc_info.descriptorPool = vk_descriptor_pool_;
-        alloc_info.descriptorSetCount = 1;
-        alloc_info.pSetLayouts = &vk_descriptor_set_layout;
+    return alloc_info.descriptorPool;
+}
 
-        VK_CHECK_RESULT(vkAllocateDescriptorSets(vk_device_, &alloc_info, &vk_descriptor_set_))
+void DescriptorPoolAllocatorVk::free(VkDescriptorPool vk_pool, VkDescriptorSet vk_descriptor_set) {
+    vkFreeDescriptorSets(vk_device_, vk_pool, 1, &vk_descriptor_set);
+}
+
+void DescriptorSetVk::update_vk_descriptor_set(VkDevice vk_device,
+                                               VkDescriptorSetLayout vk_descriptor_set_layout,
+                                               VkBuffer push_constant_buffer) {
+    vk_device_ = vk_device;
+
+    // A set with only push constants has no descriptors to make it dirty, but still has to be written once.
+    // It's also written again when the push constant buffer has been replaced.
+    if (!dirty && descriptor_set_allocated_ && push_constant_buffer == push_constant_buffer_) {
+        return;
+    }
+
+    push_constant_buffer_ = push_constant_buffer;
+
+    // Allocate the descriptor set from the shared pools.
+    if (!descriptor_set_allocated_) {
+        vk_descriptor_pool_ = pool_allocator_->allocate(vk_descriptor_set_layout, vk_descriptor_set_);
 
         descriptor_set_allocated_ = true;
     }
@@ -71,11 +100,13 @@ void DescriptorSetVk::update_vk_descriptor_set(VkDevice vk_device, VkDescriptorS
     std::vector<VkDescriptorBufferInfo> buffer_infos;
     std::vector<VkDescriptorImageInfo> image_infos;
 
+    auto &descriptor_layouts = layout_->get_descriptor_layouts();
+
     // A vector may reach its current capacity and reallocate its internal storage to a new memory location.
     // This is to make sure that doesn't happen.
-    buffer_infos.reserve(descriptors.size());
+    buffer_infos.reserve(descriptors.size() + descriptor_layouts.size());
     image_infos.reserve(descriptors.size());
-    descriptor_writes.reserve(descriptors.size());
+    descriptor_writes.reserve(descriptors.size() + descriptor_layouts.size());
 
     for (auto &pair : descriptors) {
         auto &descriptor = pair.second;
@@ -150,6 +181,31 @@ void DescriptorSetVk::update_vk_descriptor_set(VkDevice vk_device, VkDescriptorS
         descriptor_writes.push_back(write);
     }
 
+    // Push constants always point to the same buffer. Only their offsets change, which are given when binding.
+    for (auto &pair : descriptor_layouts) {
+        auto &descriptor_layout = pair.second;
+        if (descriptor_layout.type != DescriptorType::PushConstant) {
+            continue;
+        }
+
+        VkDescriptorBufferInfo buffer_info{};
+        buffer_info.buffer = push_constant_buffer;
+        buffer_info.offset = 0;
+        buffer_info.range = descriptor_layout.size;
+        buffer_infos.push_back(buffer_info);
+
+        VkWriteDescriptorSet write{};
+        write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet = vk_descriptor_set_;
+        write.dstBinding = descriptor_layout.binding;
+        write.dstArrayElement = 0;
+        write.descriptorCount = 1;
+        write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        write.pBufferInfo = &buffer_infos.back();
+
+        descriptor_writes.push_back(write);
+    }
+
     // To update multiple descriptor sets at once,
     // make sure the pBufferInfo or pImageInfo pointers are still valid at this point.
     vkUpdateDescriptorSets(vk_device_, descriptor_writes.size(), descriptor_writes.data(), 0, nullptr);
@@ -163,8 +219,7 @@ VkDescriptorSet &DescriptorSetVk::get_vk_descriptor_set() {
 
 DescriptorSetVk::~DescriptorSetVk() {
     if (descriptor_set_allocated_) {
-        // When we destroy the pool, the sets inside are destroyed as well.
-        vkDestroyDescriptorPool(vk_device_, vk_descriptor_pool_, nullptr);
+        pool_allocator_->free(vk_descriptor_pool_, vk_descriptor_set_);
     }
 }
 
@@ -1,10 +1,34 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "../descriptor_set.h"
 #include "base.h"
 
 namespace Pathfinder {
 
+/// Descriptor pools shared by all descriptor sets of a device.
+/// A new pool is added when the existing ones run out, and sets are returned to their pool individually.
+class DescriptorPoolAllocatorVk {
+public:
+    explicit DescriptorPoolAllocatorVk(VkDevice vk_device) : vk_device_(vk_device) {}
+
+    ~DescriptorPoolAllocatorVk();
+
+    /// @return The pool the set was allocated from.
+    VkDescriptorPool allocate(VkDescriptorSetLayout vk_layout, VkDescriptorSet &vk_descriptor_set);
+
+    void free(VkDescriptorPool vk_pool, VkDescriptorSet vk_descriptor_set);
+
+private:
+    VkDescriptorPool create_pool();
+
+    VkDevice vk_device_{};
+
+    std::vector<VkDescriptorPool> pools_;
+};
+
 class DescriptorSetLayoutVk : public DescriptorSetLayout {
     friend class DeviceVk;
 
@@ -35,18 +59,28 @@ class DescriptorSetVk : public DescriptorSet {
 public:
     ~DescriptorSetVk() override;
 
-    void update_vk_descriptor_set(VkDevice vk_device, VkDescriptorSetLayout vk_descriptor_set_layout);
+    /// @param push_constant_buffer Read by the push constant bindings, at the dynamic offsets given when binding.
+    void update_vk_descriptor_set(VkDevice vk_device,
+                                  VkDescriptorSetLayout vk_descriptor_set_layout,
+                                  VkBuffer push_constant_buffer);
 
     VkDescriptorSet& get_vk_descriptor_set();
 
 private:
-    explicit DescriptorSetVk(const std::shared_ptr<DescriptorSetLayout>& layout) : DescriptorSet(layout) {}
+    DescriptorSetVk(const std::shared_ptr<DescriptorSetLayout>& layout,
+                    const std::shared_ptr<DescriptorPoolAllocatorVk>& pool_allocator)
+        : DescriptorSet(layout), pool_allocator_(pool_allocator) {}
+
+    std::shared_ptr<DescriptorPoolAllocatorVk> pool_allocator_;
 
     VkDescriptorPool vk_descriptor_pool_{};
     VkDescriptorSet vk_descriptor_set_{};
 
     bool descriptor_set_allocated_ = false;
 
+    /// The one the push constant bindings were written with.
+    VkBuffer push_constant_buffer_{};
+
     VkDevice vk_device_{};
 };
 
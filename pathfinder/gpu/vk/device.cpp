@@ -1,5 +1,6 @@
 #include "device.h"
 
+#include <cstring>
 #include <memory>
 
 #include "base.h"
@@ -10,6 +11,7 @@
 #include "descriptor_set.h"
 #include "fence.h"
 #include "framebuffer.h"
+#include "query_set.h"
 #include "render_pass.h"
 #include "render_pipeline.h"
 #include "shader_module.h"
@@ -18,23 +20,103 @@
 
 namespace Pathfinder {
 
+/// Per frame in flight. Enough for a few thousand pushes. Grows when a frame needs more.
+constexpr size_t INITIAL_PUSH_CONSTANT_REGION_SIZE = 1024 * 1024;
+
 DeviceVk::DeviceVk(VkInstance vk_instance,
                    VkDevice vk_device,
                    VkPhysicalDevice vk_physical_device,
                    VkQueue vk_graphics_queue,
                    VkQueue vk_present_queue,
                    VkCommandPool vk_command_pool,
+                   const std::vector<VkCommandPool> &frame_command_pools,
                    int frames_in_flight)
     : Device(frames_in_flight), vk_instance_(vk_instance), vk_physical_device_(vk_physical_device),
       vk_device_(vk_device), vk_graphics_queue_(vk_graphics_queue), vk_present_queue_(vk_present_queue),
       vk_command_pool_(vk_command_pool) {
     backend_type = BackendType::Vulkan;
 
+    for (auto pool : frame_command_pools) {
+        FrameCommandPool frame_pool;
+        frame_pool.vk_pool = pool;
+        frame_command_pools_.push_back(frame_pool);
+    }
+
     debug_marker_.setup(vk_instance_);
 
+    descriptor_pool_allocator_ = std::make_shared<DescriptorPoolAllocatorVk>(vk_device_);
+
     VkPhysicalDeviceProperties props;
     vkGetPhysicalDeviceProperties(vk_physical_device, &props);
     min_uniform_alignment_ = props.limits.minUniformBufferOffsetAlignment;
+
+    push_constant_region_size_ = INITIAL_PUSH_CONSTANT_REGION_SIZE;
+
+    if (props.limits.timestampComputeAndGraphics) {
+        timestamp_period_ = props.limits.timestampPeriod;
+    }
+
+    VkPipelineCacheCreateInfo pipeline_cache_info{};
+    pipeline_cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    VK_CHECK_RESULT(vkCreatePipelineCache(vk_device_, &pipeline_cache_info, nullptr, &vk_pipeline_cache_))
+}
+
+DeviceVk::~DeviceVk() {
+    save_pipeline_cache();
+
+    vkDestroyPipelineCache(vk_device_, vk_pipeline_cache_, nullptr);
+}
+
+std::string DeviceVk::get_device_identity() const {
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(vk_physical_device_, &props);
+
+    std::string identity = "Vulkan " + std::to_string(props.vendorID) + " " + std::to_string(props.deviceID) + " " +
+                           std::to_string(props.driverVersion) + " ";
+    for (auto byte : props.pipelineCacheUUID) {
+        identity += std::to_string(byte) + ".";
+    }
+    return identity;
+}
+
+void DeviceVk::set_pipeline_cache_directory(const std::string &directory) {
+    Device::set_pipeline_cache_directory(directory);
+
+    // The driver checks the header of the initial data, and ignores it if it doesn't match.
+    auto data = pipeline_cache_->load("vulkan");
+
+    VkPipelineCacheCreateInfo pipeline_cache_info{};
+    pipeline_cache_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipeline_cache_info.initialDataSize = data.size();
+    pipeline_cache_info.pInitialData = data.data();
+
+    VkPipelineCache vk_pipeline_cache;
+    if (vkCreatePipelineCache(vk_device_, &pipeline_cache_info, nullptr, &vk_pipeline_cache) != VK_SUCCESS) {
+        Logger::error("Failed to create pipeline cache from disk!", "DeviceVk");
+        return;
+    }
+
+    // Keep the pipelines created so far.
+    vkMergePipelineCaches(vk_device_, vk_pipeline_cache, 1, &vk_pipeline_cache_);
+    vkDestroyPipelineCache(vk_device_, vk_pipeline_cache_, nullptr);
+    vk_pipeline_cache_ = vk_pipeline_cache;
+}
+
+void DeviceVk::save_pipeline_cache() {
+    if (!pipeline_cache_ || !pipeline_cache_dirty_) {
+        return;
+    }
+
+    size_t data_size = 0;
+    VK_CHECK_RESULT(vkGetPipelineCacheData(vk_device_, vk_pipeline_cache_, &data_size, nullptr))
+
+    std::vector<char> data(data_size);
+    VK_CHECK_RESULT(vkGetPipelineCacheData(vk_device_, vk_pipeline_cache_, &data_size, data.data()))
+    data.resize(data_size);
+
+    pipeline_cache_->store("vulkan", data);
+
+    pipeline_cache_dirty_ = false;
 }
 
 VkDevice DeviceVk::get_device() const {
@@ -57,6 +139,83 @@ VkCommandPool DeviceVk::get_command_pool() const {
     return vk_command_pool_;
 }
 
+VkCommandBuffer DeviceVk::acquire_frame_command_buffer() {
+    auto &frame_pool = frame_command_pools_[current_frame_index_ % frame_command_pools_.size()];
+
+    if (frame_pool.used_count == frame_pool.command_buffers.size()) {
+        VkCommandBufferAllocateInfo alloc_info{};
+        alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        alloc_info.commandPool = frame_pool.vk_pool;
+        alloc_info.commandBufferCount = 1;
+
+        VkCommandBuffer command_buffer;
+        VK_CHECK_RESULT(vkAllocateCommandBuffers(vk_device_, &alloc_info, &command_buffer))
+
+        frame_pool.command_buffers.push_back(command_buffer);
+    }
+
+    return frame_pool.command_buffers[frame_pool.used_count++];
+}
+
+void DeviceVk::begin_frame() {
+    Device::begin_frame();
+
+    // The frame that last used this pool has finished, so all of its command buffers can be recorded again.
+    auto &frame_pool = frame_command_pools_[current_frame_index_ % frame_command_pools_.size()];
+    vkResetCommandPool(vk_device_, frame_pool.vk_pool, 0);
+    frame_pool.used_count = 0;
+
+    // Same for the frame's push constants.
+    push_constant_region_head_ = 0;
+}
+
+VkBuffer DeviceVk::get_push_constant_buffer() {
+    if (push_constant_buffer_ == nullptr) {
+        BufferDescriptor desc;
+        desc.type = BufferType::Uniform;
+        desc.size = push_constant_region_size_ * frames_in_flight_;
+        desc.property = MemoryProperty::HostVisibleAndCoherent;
+        push_constant_buffer_ = create_buffer(desc, "push constant buffer");
+    }
+
+    return static_cast<BufferVk *>(push_constant_buffer_.get())->get_vk_buffer();
+}
+
+uint32_t DeviceVk::allocate_push_constants(const void *data, size_t data_size) {
+    get_push_constant_buffer();
+
+    auto region_offset = get_aligned_uniform_size(push_constant_region_head_);
+
+    if (region_offset + data_size > push_constant_region_size_) {
+        Logger::warn("Out of push constant space, growing the push constant buffer.", "DeviceVk");
+
+        // The buffer may only be replaced once no frame reads it anymore.
+        // Descriptor sets are written again with the new buffer when they are bound next.
+        vkDeviceWaitIdle(vk_device_);
+
+        // Double the regions, or more if a single encoder needs it.
+        push_constant_region_size_ *= 2;
+        while (push_constant_region_size_ < data_size) {
+            push_constant_region_size_ *= 2;
+        }
+
+        push_constant_buffer_ = nullptr;
+        get_push_constant_buffer();
+
+        region_offset = 0;
+    }
+
+    auto offset = (uint32_t)((current_frame_index_ % frames_in_flight_) * push_constant_region_size_ + region_offset);
+
+    auto buffer_vk = static_cast<BufferVk *>(push_constant_buffer_.get());
+    memcpy((uint8_t *)buffer_vk->map() + offset, data, data_size);
+
+    push_constant_region_head_ = region_offset + data_size;
+
+    return offset;
+}
+
 std::shared_ptr<DescriptorSetLayout> DeviceVk::create_descriptor_set_layout(
     const std::vector<DescriptorLayout> &descriptors) {
     VkDescriptorSetLayout vk_ds_layout;
@@ -85,7 +244,7 @@ std::shared_ptr<DescriptorSetLayout> DeviceVk::create_descriptor_set_layout(
 }
 
 std::shared_ptr<DescriptorSet> DeviceVk::create_descriptor_set(std::shared_ptr<DescriptorSetLayout> layout) {
-    return std::shared_ptr<DescriptorSetVk>(new DescriptorSetVk(layout));
+    return std::shared_ptr<DescriptorSetVk>(new DescriptorSetVk(layout, descriptor_pool_allocator_));
 }
 
 std::shared_ptr<ShaderModule> DeviceVk::create_shader_module(const std::shared_ptr<Shader> &shader,
@@ -284,12 +443,14 @@ std::shared_ptr<RenderPipeline> DeviceVk::create_render_pipeline(
 
     // Create pipeline.
     VK_CHECK_RESULT(vkCreateGraphicsPipelines(vk_device_,
-                                              VK_NULL_HANDLE,
+                                              vk_pipeline_cache_,
                                               1,
                                               &pipeline_info,
                                               nullptr,
                                               &render_pipeline_vk->vk_pipeline_))
 
+    pipeline_cache_dirty_ = true;
+
     debug_marker_.set_object_name(vk_device_,
                                   (uint64_t)render_pipeline_vk->vk_pipeline_,
                                   VK_OBJECT_TYPE_PIPELINE,
@@ -340,12 +501,14 @@ std::shared_ptr<ComputePipeline> DeviceVk::create_compute_pipeline(
 
     // Create pipeline.
     VK_CHECK_RESULT(vkCreateComputePipelines(vk_device_,
-                                             VK_NULL_HANDLE,
+                                             vk_pipeline_cache_,
                                              1,
                                              &pipeline_create_info,
                                              nullptr,
                                              &compute_pipeline_vk->vk_pipeline_))
 
+    pipeline_cache_dirty_ = true;
+
     debug_marker_.set_object_name(vk_device_,
                                   (uint64_t)compute_pipeline_vk->vk_pipeline_,
                                   VK_OBJECT_TYPE_PIPELINE,
@@ -491,24 +654,8 @@ std::shared_ptr<Sampler> DeviceVk::create_sampler(SamplerDescriptor descriptor)
     return std::shared_ptr<SamplerVk>(new SamplerVk(descriptor, sampler, vk_device_));
 }
 
-std::shared_ptr<CommandEncoder> DeviceVk::create_command_encoder(const std::string &label) {
-    // Allocate a command buffer.
-    // ----------------------------------------
-    VkCommandBufferAllocateInfo alloc_info{};
-    alloc_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-    alloc_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-    alloc_info.commandPool = vk_command_pool_;
-    alloc_info.commandBufferCount = 1;
-
-    VkCommandBuffer command_buffer;
-    vkAllocateCommandBuffers(vk_device_, &alloc_info, &command_buffer);
-    // ----------------------------------------
-
-    auto command_encoder_vk = std::shared_ptr<CommandEncoderVk>(new CommandEncoderVk(command_buffer, this));
-    command_encoder_vk->label_ = label;
-    command_encoder_vk->device_ = shared_from_this();
-
-    return command_encoder_vk;
+std::shared_ptr<CommandEncoder> DeviceVk::allocate_command_encoder() {
+    return std::shared_ptr<CommandEncoderVk>(new CommandEncoderVk(this));
 }
 
 std::shared_ptr<Fence> DeviceVk::create_fence(const std::string &label) {
@@ -534,6 +681,17 @@ std::shared_ptr<Fence> DeviceVk::create_fence(const std::string &label) {
     return fence_vk;
 }
 
+std::shared_ptr<QuerySet> DeviceVk::create_timestamp_query_set(uint32_t count, const std::string &label) {
+    if (timestamp_period_ == 0) {
+        return nullptr;
+    }
+
+    auto query_set_vk = std::shared_ptr<QuerySetVk>(new QuerySetVk(count, timestamp_period_, this));
+    query_set_vk->label_ = label;
+
+    return query_set_vk;
+}
+
 std::shared_ptr<Buffer> DeviceVk::create_staging_buffer(size_t size) {
     BufferDescriptor desc;
     desc.type = BufferType::Storage;
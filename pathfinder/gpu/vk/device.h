@@ -3,6 +3,7 @@
 #include "../base.h"
 #include "../device.h"
 #include "debug_marker.h"
+#include "descriptor_set.h"
 #include "render_pass.h"
 
 namespace Pathfinder {
@@ -20,8 +21,11 @@ public:
              VkQueue vk_graphics_queue,
              VkQueue vk_present_queue,
              VkCommandPool vk_command_pool,
+             const std::vector<VkCommandPool> &frame_command_pools,
              int frames_in_flight);
 
+    ~DeviceVk() override;
+
     std::shared_ptr<RenderPass> create_render_pass(TextureFormat format,
                                                    AttachmentLoadOp load_op,
                                                    const std::string &label) override;
@@ -38,7 +42,7 @@ public:
 
     std::shared_ptr<Sampler> create_sampler(SamplerDescriptor descriptor) override;
 
-    std::shared_ptr<CommandEncoder> create_command_encoder(const std::string &label) override;
+    std::shared_ptr<CommandEncoder> allocate_command_encoder() override;
 
     std::shared_ptr<DescriptorSetLayout> create_descriptor_set_layout(
         const std::vector<DescriptorLayout> &_descriptors) override;
@@ -68,12 +72,18 @@ public:
 
     std::shared_ptr<Fence> create_fence(const std::string &label) override;
 
+    std::shared_ptr<QuerySet> create_timestamp_query_set(uint32_t count, const std::string &label) override;
+
     void *map_staging(const StagingAllocation &allocation) override;
 
     void unmap_staging(const StagingAllocation &allocation) override;
 
     std::shared_ptr<Buffer> create_staging_buffer(size_t size) override;
 
+    void set_pipeline_cache_directory(const std::string &directory) override;
+
+    void save_pipeline_cache() override;
+
     VkDevice get_device() const;
 
     VkPhysicalDevice get_physical_device() const;
@@ -84,6 +94,20 @@ public:
 
     VkCommandPool get_command_pool() const;
 
+    /// Get a command buffer from the current frame's pool.
+    /// It stays valid until the pool is reset, when the frame comes around again.
+    VkCommandBuffer acquire_frame_command_buffer();
+
+    void begin_frame() override;
+
+    /// Buffer that shaders read push constants from, as dynamic uniform buffers.
+    VkBuffer get_push_constant_buffer();
+
+    /// Copy push constants into the current frame's region of the push constant buffer.
+    /// If the region is full, waits for the device to be idle and grows the buffer.
+    /// @return Where the data was copied to, i.e. the dynamic offset of its start.
+    uint32_t allocate_push_constants(const void *data, size_t data_size);
+
     uint32_t find_memory_type(uint32_t type_filter, VkMemoryPropertyFlags properties) const;
 
     void create_vk_buffer(VkDeviceSize size,
@@ -113,6 +137,9 @@ public:
 
     void set_debug_label(const std::shared_ptr<Buffer> &buffer, const std::string &label) override;
 
+protected:
+    std::string get_device_identity() const override;
+
 private:
     VkInstance vk_instance_{};
 
@@ -127,10 +154,43 @@ private:
 
     VkCommandPool vk_command_pool_{};
 
+    struct FrameCommandPool {
+        VkCommandPool vk_pool{};
+
+        /// Allocated once and recycled by resetting the pool.
+        std::vector<VkCommandBuffer> command_buffers;
+
+        size_t used_count = 0;
+    };
+
+    std::vector<FrameCommandPool> frame_command_pools_;
+
     VkDeviceSize min_uniform_alignment_{};
 
+    /// Nanoseconds per timestamp tick. Zero if timestamps are not supported.
+    float timestamp_period_{};
+
     DebugMarkerVk debug_marker_;
 
+    /// Pools of all descriptor sets created by this device.
+    std::shared_ptr<DescriptorPoolAllocatorVk> descriptor_pool_allocator_;
+
+    /// Used for all pipelines. Seeded from and saved to the pipeline cache directory, if set.
+    VkPipelineCache vk_pipeline_cache_{};
+
+    /// Pipelines have been created since the cache was last saved.
+    bool pipeline_cache_dirty_ = false;
+
+    /// Holds a region per frame in flight, which is filled from the start as the frame's encoders are prepared.
+    /// Created on first use.
+    std::shared_ptr<Buffer> push_constant_buffer_;
+
+    /// Bytes per frame in flight.
+    size_t push_constant_region_size_ = 0;
+
+    /// Used bytes of the current frame's region.
+    size_t push_constant_region_head_ = 0;
+
     VkShaderModule create_shader_module(const std::vector<char> &code);
 
     void create_vk_image(uint32_t width,
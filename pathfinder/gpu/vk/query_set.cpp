@@ -0,0 +1,49 @@
+#include "query_set.h"
+
+#include <cassert>
+#include <sstream>
+
+#include "../../common/logger.h"
+#include "device.h"
+
+namespace Pathfinder {
+
+QuerySetVk::QuerySetVk(uint32_t count, float timestamp_period, DeviceVk *device)
+    : QuerySet(count), timestamp_period_(timestamp_period), device_vk_(device) {
+    VkQueryPoolCreateInfo create_info{};
+    create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    create_info.queryCount = count;
+
+    VK_CHECK_RESULT(vkCreateQueryPool(device_vk_->get_device(), &create_info, nullptr, &vk_query_pool_))
+}
+
+QuerySetVk::~QuerySetVk() {
+    vkDestroyQueryPool(device_vk_->get_device(), vk_query_pool_, nullptr);
+}
+
+bool QuerySetVk::get_results(uint32_t first_query, uint32_t query_count, std::vector<uint64_t> &timestamps) {
+    timestamps.resize(query_count);
+
+    // Without VK_QUERY_RESULT_WAIT_BIT, this returns VK_NOT_READY instead of blocking.
+    auto result = vkGetQueryPoolResults(device_vk_->get_device(),
+                                        vk_query_pool_,
+                                        first_query,
+                                        query_count,
+                                        query_count * sizeof(uint64_t),
+                                        timestamps.data(),
+                                        sizeof(uint64_t),
+                                        VK_QUERY_RESULT_64_BIT);
+
+    if (result != VK_SUCCESS) {
+        return false;
+    }
+
+    for (auto &timestamp : timestamps) {
+        timestamp = (uint64_t)((double)timestamp * timestamp_period_);
+    }
+
+    return true;
+}
+
+} // namespace Pathfinder
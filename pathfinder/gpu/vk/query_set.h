@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../query_set.h"
+#include "base.h"
+
+namespace Pathfinder {
+
+class DeviceVk;
+
+class QuerySetVk : public QuerySet {
+    friend class DeviceVk;
+
+public:
+    ~QuerySetVk() override;
+
+    VkQueryPool get_vk_query_pool() const {
+        return vk_query_pool_;
+    }
+
+    bool get_results(uint32_t first_query, uint32_t query_count, std::vector<uint64_t> &timestamps) override;
+
+private:
+    QuerySetVk(uint32_t count, float timestamp_period, DeviceVk *device);
+
+    VkQueryPool vk_query_pool_{};
+
+    /// Nanoseconds per timestamp tick.
+    float timestamp_period_;
+
+    DeviceVk *device_vk_{};
+};
+
+} // namespace Pathfinder
@@ -1,23 +1,27 @@
 #include "queue.h"
 
+#include <algorithm>
+
 #include "command_encoder.h"
 #include "fence.h"
 
 namespace Pathfinder {
 
-void QueueVk::submit(const std::shared_ptr<CommandEncoder> &encoder, const std::shared_ptr<Fence> &fence) {
+bool QueueVk::prepare_encoder(const std::shared_ptr<CommandEncoder> &encoder) {
     if (encoder->submitted_) {
         Logger::error("Attempted to submit an encoder that's already been submitted!");
-        return;
+        return false;
     }
 
     // Mark the encoder as submitted.
     encoder->submitted_ = true;
 
-    if (!encoder->prepare()) {
-        return;
-    }
+    return encoder->prepare();
+}
 
+void QueueVk::submit_command_buffer(const std::shared_ptr<CommandEncoder> &encoder,
+                                    uint64_t submission,
+                                    VkFence vk_fence) {
     auto encoder_vk = (CommandEncoderVk *)encoder.get();
 
     // Submit the command buffer to the graphics queue.
@@ -26,38 +30,161 @@ void QueueVk::submit(const std::shared_ptr<CommandEncoder> &encoder, const std::
     submit_info.commandBufferCount = 1;
     submit_info.pCommandBuffers = &encoder_vk->vk_command_buffer_;
 
-    if (fence) {
-        auto fence_vk = (FenceVk *)fence.get();
+    VkTimelineSemaphoreSubmitInfo timeline_info{};
+    if (vk_timeline_semaphore_) {
+        timeline_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+        timeline_info.signalSemaphoreValueCount = 1;
+        timeline_info.pSignalSemaphoreValues = &submission;
 
-        vkQueueSubmit(vk_graphics_queue_, 1, &submit_info, fence_vk->fence);
+        submit_info.pNext = &timeline_info;
+        submit_info.signalSemaphoreCount = 1;
+        submit_info.pSignalSemaphores = &vk_timeline_semaphore_;
+    }
 
-        fence_vk->wait();
-    } else {
-        vkQueueSubmit(vk_graphics_queue_, 1, &submit_info, VK_NULL_HANDLE);
+    // Wait for the submissions of other queues whose results are used by this one.
+    std::vector<VkSemaphore> wait_semaphores;
+    std::vector<uint64_t> wait_values;
+    std::vector<VkPipelineStageFlags> wait_stages;
+    for (const auto &pending_wait : pending_waits_) {
+        wait_semaphores.push_back(pending_wait.vk_semaphore);
+        wait_values.push_back(pending_wait.value);
+        wait_stages.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    }
+    pending_waits_.clear();
+
+    if (!wait_semaphores.empty()) {
+        timeline_info.waitSemaphoreValueCount = static_cast<uint32_t>(wait_values.size());
+        timeline_info.pWaitSemaphoreValues = wait_values.data();
+
+        submit_info.waitSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
+        submit_info.pWaitSemaphores = wait_semaphores.data();
+        submit_info.pWaitDstStageMask = wait_stages.data();
+    }
+
+    VK_CHECK_RESULT(vkQueueSubmit(vk_graphics_queue_, 1, &submit_info, vk_fence))
+
+    pending_submissions_.push_back({submission, encoder});
+    frame_submissions_[current_frame_index_ % frames_in_flight_] = submission;
+}
+
+void QueueVk::submit(const std::shared_ptr<CommandEncoder> &encoder, const std::shared_ptr<Fence> &fence) {
+    if (!fence) {
+        auto submission = submit_async(encoder);
 
-        // If no fence is provided, but there are callbacks (e.g. from read_buffer),
-        // we must ensure the GPU is finished before invoking them.
-        // A simple way is to wait for the queue to be idle.
+        // Callbacks (e.g. from read_buffer) are expected to have been invoked when this returns.
         if (!encoder->callbacks_.empty()) {
-            vkQueueWaitIdle(vk_graphics_queue_);
-            // Print performance warning.
-            Logger::warn(
-                "vkQueueWaitIdle is used because a command encoder with callbacks has been called without a fence!");
-        } else {
-            encoders_in_flight_[current_frame_index_ % frames_in_flight_].push_back(encoder);
+            wait(submission);
         }
+        return;
+    }
+
+    if (!prepare_encoder(encoder)) {
+        return;
+    }
+
+    auto fence_vk = (FenceVk *)fence.get();
+
+    auto submission = ++last_submission_;
+    submit_command_buffer(encoder, submission, fence_vk->fence);
+
+    fence_vk->wait();
+
+    retire(submission);
+}
+
+uint64_t QueueVk::submit_async(const std::shared_ptr<CommandEncoder> &encoder) {
+    if (!prepare_encoder(encoder)) {
+        return last_submission_;
     }
 
-    encoder->invoke_callbacks();
+    auto submission = ++last_submission_;
+    submit_command_buffer(encoder, submission, VK_NULL_HANDLE);
+
+    return submission;
+}
+
+bool QueueVk::is_complete(uint64_t submission) {
+    if (submission > completed_submission_) {
+        poll();
+    }
+    return submission <= completed_submission_;
+}
+
+void QueueVk::wait(uint64_t submission) {
+    if (submission <= completed_submission_) {
+        return;
+    }
+
+    if (vk_timeline_semaphore_) {
+        VkSemaphoreWaitInfo wait_info{};
+        wait_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+        wait_info.semaphoreCount = 1;
+        wait_info.pSemaphores = &vk_timeline_semaphore_;
+        wait_info.pValues = &submission;
+
+        VK_CHECK_RESULT(vkWaitSemaphores(vk_device_, &wait_info, UINT64_MAX))
+    } else {
+        vkQueueWaitIdle(vk_graphics_queue_);
+        // Print performance warning.
+        Logger::warn("vkQueueWaitIdle is used because timeline semaphores are not supported!");
+
+        submission = last_submission_;
+    }
+
+    retire(submission);
+}
+
+void QueueVk::wait_for(Queue &other, uint64_t submission) {
+    auto &other_vk = (QueueVk &)other;
+
+    // Without timeline semaphores, only a CPU wait is possible.
+    if (!vk_timeline_semaphore_ || !other_vk.vk_timeline_semaphore_) {
+        other.wait(submission);
+        return;
+    }
+
+    // Wait even if the CPU has seen the submission complete, as the semaphore is what makes its writes visible
+    // to this queue.
+    pending_waits_.push_back({other_vk.vk_timeline_semaphore_, submission});
+}
+
+void QueueVk::poll() {
+    if (!vk_timeline_semaphore_) {
+        return;
+    }
+
+    uint64_t counter = 0;
+    VK_CHECK_RESULT(vkGetSemaphoreCounterValue(vk_device_, vk_timeline_semaphore_, &counter))
+
+    retire(counter);
+}
+
+void QueueVk::retire(uint64_t submission) {
+    completed_submission_ = std::max(completed_submission_, submission);
+
+    while (!pending_submissions_.empty() && pending_submissions_.front().submission <= completed_submission_) {
+        auto encoder = std::move(pending_submissions_.front().encoder);
+        pending_submissions_.pop_front();
+
+        encoder->invoke_callbacks();
+    }
 }
 
 void QueueVk::begin_frame(const uint32_t current_frame_index) {
     current_frame_index_ = current_frame_index;
-    encoders_in_flight_[current_frame_index_ % frames_in_flight_].clear();
+
+    if (vk_timeline_semaphore_) {
+        poll();
+    } else {
+        // The swap chain has waited for the frame that last used this slot.
+        retire(frame_submissions_[current_frame_index_ % frames_in_flight_]);
+    }
 }
 
 void QueueVk::wait_idle() {
     vkQueueWaitIdle(vk_graphics_queue_);
+
+    retire(last_submission_);
 }
 
 } // namespace Pathfinder
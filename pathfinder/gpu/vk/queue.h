@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+
 #include "../queue.h"
 #include "base.h"
 
@@ -12,28 +14,77 @@ class QueueVk : public Queue {
 public:
     void submit(const std::shared_ptr<CommandEncoder> &encoder, const std::shared_ptr<Fence> &fence) override;
 
+    uint64_t submit_async(const std::shared_ptr<CommandEncoder> &encoder) override;
+
+    bool is_complete(uint64_t submission) override;
+
+    void wait(uint64_t submission) override;
+
+    void wait_for(Queue &other, uint64_t submission) override;
+
     void begin_frame(uint32_t current_frame_index) override;
 
     void wait_idle() override;
 
 private:
+    /// Mark the encoder as submitted and finish its recording. Returns false if it can't be submitted.
+    static bool prepare_encoder(const std::shared_ptr<CommandEncoder> &encoder);
+
+    /// Submit the command buffer of the encoder, signaling the timeline semaphore with `submission`.
+    /// It waits for the pending cross-queue waits first.
+    void submit_command_buffer(const std::shared_ptr<CommandEncoder> &encoder, uint64_t submission, VkFence vk_fence);
+
+    /// Check the counter of the timeline semaphore and retire what has completed.
+    void poll();
+
+    /// Invoke the callbacks of all pending submissions up to `submission` and release their encoders.
+    void retire(uint64_t submission);
+
+    struct PendingSubmission {
+        uint64_t submission;
+        std::shared_ptr<CommandEncoder> encoder;
+    };
+
+    struct PendingWait {
+        VkSemaphore vk_semaphore;
+        uint64_t value;
+    };
+
     VkDevice vk_device_{};
 
     VkQueue vk_graphics_queue_{};
 
     VkQueue vk_present_queue_{};
 
-    std::vector<std::vector<std::shared_ptr<CommandEncoder>>> encoders_in_flight_;
+    /// Signaled with the token of each submission. Null if timeline semaphores aren't supported,
+    /// in which case waiting falls back to vkQueueWaitIdle.
+    VkSemaphore vk_timeline_semaphore_{};
+
+    /// Submissions whose encoders are kept alive until the GPU has finished them, in submission order.
+    std::deque<PendingSubmission> pending_submissions_;
+
+    uint64_t completed_submission_{};
+
+    /// Timeline values of other queues that the next submission waits for.
+    std::vector<PendingWait> pending_waits_;
+
+    /// Latest submission of each frame in flight.
+    std::vector<uint64_t> frame_submissions_;
 
     uint32_t frames_in_flight_{};
 
 public:
-    QueueVk(VkDevice vk_device, VkQueue vk_graphics_queue, VkQueue vk_present_queue, uint32_t frames_in_flight) {
+    QueueVk(VkDevice vk_device,
+            VkQueue vk_graphics_queue,
+            VkQueue vk_present_queue,
+            VkSemaphore vk_timeline_semaphore,
+            uint32_t frames_in_flight) {
         vk_device_ = vk_device;
         vk_graphics_queue_ = vk_graphics_queue;
         vk_present_queue_ = vk_present_queue;
+        vk_timeline_semaphore_ = vk_timeline_semaphore;
         frames_in_flight_ = frames_in_flight;
-        encoders_in_flight_.resize(frames_in_flight);
+        frame_submissions_.resize(frames_in_flight);
     }
 };
 
@@ -1,5 +1,6 @@
 #include "window_builder.h"
 
+#include <array>
 #include <set>
 
 #include "debug_marker.h"
@@ -83,8 +84,15 @@ WindowBuilderVk::WindowBuilderVk(ANativeWindow *native_window, const Vec2I &phys
 #endif
 
 WindowBuilderVk::~WindowBuilderVk() {
+    vkDestroySemaphore(device_, timeline_semaphore_, nullptr);
+    vkDestroySemaphore(device_, compute_timeline_semaphore_, nullptr);
+
     vkDestroyCommandPool(device_, command_pool_, nullptr);
 
+    for (auto pool : frame_command_pools_) {
+        vkDestroyCommandPool(device_, pool, nullptr);
+    }
+
     // Destroy the logical device.
     vkDestroyDevice(device_, nullptr);
 
@@ -153,12 +161,30 @@ std::shared_ptr<Device> WindowBuilderVk::request_device() {
                                                          graphics_queue_,
                                                          present_queue_,
                                                          command_pool_,
+                                                         frame_command_pools_,
                                                          MAX_FRAMES_IN_FLIGHT));
     return device;
 }
 
 std::shared_ptr<Queue> WindowBuilderVk::create_queue() {
-    auto queue = std::shared_ptr<QueueVk>(new QueueVk(device_, graphics_queue_, present_queue_, MAX_FRAMES_IN_FLIGHT));
+    auto queue = std::shared_ptr<QueueVk>(new QueueVk(device_,
+                                                      graphics_queue_,
+                                                      present_queue_,
+                                                      timeline_semaphore_,
+                                                      MAX_FRAMES_IN_FLIGHT));
+    return queue;
+}
+
+std::shared_ptr<Queue> WindowBuilderVk::create_compute_queue() {
+    if (!compute_queue_) {
+        return nullptr;
+    }
+
+    auto queue = std::shared_ptr<QueueVk>(new QueueVk(device_,
+                                                      compute_queue_,
+                                                      present_queue_,
+                                                      compute_timeline_semaphore_,
+                                                      MAX_FRAMES_IN_FLIGHT));
     return queue;
 }
 
@@ -171,6 +197,14 @@ void WindowBuilderVk::create_command_pool(VkSurfaceKHR surface) {
     pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT; // So we can reset command buffers.
 
     VK_CHECK_RESULT(vkCreateCommandPool(device_, &pool_info, nullptr, &command_pool_))
+
+    // Encoder command buffers are short-lived and never reset individually.
+    pool_info.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+    frame_command_pools_.resize(MAX_FRAMES_IN_FLIGHT);
+    for (auto &pool : frame_command_pools_) {
+        VK_CHECK_RESULT(vkCreateCommandPool(device_, &pool_info, nullptr, &pool))
+    }
 }
 
 void WindowBuilderVk::create_instance() {
@@ -184,7 +218,14 @@ void WindowBuilderVk::create_instance() {
     app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
     app_info.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
     app_info.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-    app_info.apiVersion = VK_API_VERSION_1_0;
+
+    // Timeline semaphores are core in Vulkan 1.2. A loader of version 1.0 rejects any other version.
+    uint32_t instance_version = VK_API_VERSION_1_0;
+    if (vkEnumerateInstanceVersion) {
+        vkEnumerateInstanceVersion(&instance_version);
+    }
+    api_version_ = instance_version >= VK_API_VERSION_1_1 ? VK_API_VERSION_1_2 : VK_API_VERSION_1_0;
+    app_info.apiVersion = api_version_;
 
     // Structure specifying parameters of a new instance.
     VkInstanceCreateInfo instance_info{};
@@ -298,6 +339,26 @@ bool WindowBuilderVk::is_device_suitable(VkPhysicalDevice physical_device, VkSur
            supported_features.samplerAnisotropy;
 }
 
+bool WindowBuilderVk::check_timeline_semaphore_support() const {
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(physical_device_, &props);
+
+    if (api_version_ < VK_API_VERSION_1_2 || props.apiVersion < VK_API_VERSION_1_2) {
+        return false;
+    }
+
+    VkPhysicalDeviceTimelineSemaphoreFeatures timeline_features{};
+    timeline_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+
+    VkPhysicalDeviceFeatures2 features{};
+    features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+    features.pNext = &timeline_features;
+
+    vkGetPhysicalDeviceFeatures2(physical_device_, &features);
+
+    return timeline_features.timelineSemaphore;
+}
+
 void WindowBuilderVk::pick_physical_device(VkSurfaceKHR surface) {
     // Ger the number of the physical devices accessible to a Vulkan instance.
     uint32_t device_count = 0;
@@ -446,7 +507,24 @@ void WindowBuilderVk::create_logical_device(VkSurfaceKHR surface) {
 
     std::set<uint32_t> unique_queue_families = {*qf_indices.graphics_family, *qf_indices.present_family};
 
-    float queue_priority = 1.0f;
+    bool timeline_semaphore_supported = check_timeline_semaphore_support();
+
+    // Take a second queue of the graphics family for compute work if there is one.
+    // The queues can only wait for each other on the GPU with timeline semaphores.
+    uint32_t graphics_queue_count = 1;
+    if (timeline_semaphore_supported) {
+        uint32_t queue_family_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(physical_device_, &queue_family_count, nullptr);
+
+        std::vector<VkQueueFamilyProperties> queue_families(queue_family_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(physical_device_, &queue_family_count, queue_families.data());
+
+        if (queue_families[*qf_indices.graphics_family].queueCount > 1) {
+            graphics_queue_count = 2;
+        }
+    }
+
+    std::array<float, 2> queue_priorities = {1.0f, 1.0f};
 
     std::vector<VkDeviceQueueCreateInfo> queue_create_infos;
 
@@ -455,8 +533,8 @@ void WindowBuilderVk::create_logical_device(VkSurfaceKHR surface) {
         VkDeviceQueueCreateInfo queue_create_info{};
         queue_create_info.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
         queue_create_info.queueFamilyIndex = queue_family;
-        queue_create_info.queueCount = 1;
-        queue_create_info.pQueuePriorities = &queue_priority;
+        queue_create_info.queueCount = queue_family == *qf_indices.graphics_family ? graphics_queue_count : 1;
+        queue_create_info.pQueuePriorities = queue_priorities.data();
         queue_create_infos.push_back(queue_create_info);
     }
 
@@ -475,6 +553,17 @@ void WindowBuilderVk::create_logical_device(VkSurfaceKHR surface) {
 
     create_info.pEnabledFeatures = &device_features;
 
+    // Lets the queue track the completion of each submission without blocking.
+    VkPhysicalDeviceTimelineSemaphoreFeatures timeline_features{};
+    timeline_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES;
+
+    if (timeline_semaphore_supported) {
+        timeline_features.timelineSemaphore = VK_TRUE;
+        create_info.pNext = &timeline_features;
+    } else {
+        Logger::warn("Timeline semaphores are not supported, submissions with readbacks will wait for the queue!");
+    }
+
     // Specify needed device extensions.
     create_info.enabledExtensionCount = static_cast<uint32_t>(DEVICE_EXTENSIONS.size());
     create_info.ppEnabledExtensionNames = DEVICE_EXTENSIONS.data();
@@ -493,6 +582,27 @@ void WindowBuilderVk::create_logical_device(VkSurfaceKHR surface) {
     // Get a queue handle from a device.
     vkGetDeviceQueue(device_, *qf_indices.graphics_family, 0, &graphics_queue_);
     vkGetDeviceQueue(device_, *qf_indices.present_family, 0, &present_queue_);
+
+    if (graphics_queue_count > 1) {
+        vkGetDeviceQueue(device_, *qf_indices.graphics_family, 1, &compute_queue_);
+    }
+
+    if (timeline_semaphore_supported) {
+        VkSemaphoreTypeCreateInfo type_info{};
+        type_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        type_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+        type_info.initialValue = 0;
+
+        VkSemaphoreCreateInfo semaphore_info{};
+        semaphore_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphore_info.pNext = &type_info;
+
+        VK_CHECK_RESULT(vkCreateSemaphore(device_, &semaphore_info, nullptr, &timeline_semaphore_))
+
+        if (compute_queue_) {
+            VK_CHECK_RESULT(vkCreateSemaphore(device_, &semaphore_info, nullptr, &compute_timeline_semaphore_))
+        }
+    }
 }
 
 VkFormat WindowBuilderVk::find_supported_format(const std::vector<VkFormat> &candidates,
@@ -69,6 +69,8 @@ public:
 
     std::shared_ptr<Queue> create_queue() override;
 
+    std::shared_ptr<Queue> create_compute_queue() override;
+
     VkPhysicalDevice get_physical_device() const;
 
     VkDevice get_device() const;
@@ -97,8 +99,24 @@ private:
     VkQueue graphics_queue_{};
     VkQueue present_queue_{};
 
+    /// Version requested when creating the instance.
+    uint32_t api_version_ = VK_API_VERSION_1_0;
+
+    /// Signaled by the queue with the token of each submission. Null if not supported.
+    VkSemaphore timeline_semaphore_{};
+
+    /// Second queue of the graphics family, so it shares command pools and resources with the graphics queue
+    /// without ownership transfers. Null if the family only has one queue or timeline semaphores aren't supported.
+    VkQueue compute_queue_{};
+
+    /// Signaled by the compute queue, which the graphics queue waits on.
+    VkSemaphore compute_timeline_semaphore_{};
+
     VkCommandPool command_pool_{};
 
+    /// One transient pool per frame in flight, reset as a whole when its frame comes around again.
+    std::vector<VkCommandPool> frame_command_pools_;
+
     static VKAPI_ATTR VkBool32 VKAPI_CALL debug_callback(VkDebugUtilsMessageSeverityFlagBitsEXT message_severity,
                                                          VkDebugUtilsMessageTypeFlagsEXT message_type,
                                                          const VkDebugUtilsMessengerCallbackDataEXT *callback_data,
@@ -136,6 +154,9 @@ private:
     /// Check if a physical device is suitable for the target surface.
     bool is_device_suitable(VkPhysicalDevice physical_device, VkSurfaceKHR surface) const;
 
+    /// Timeline semaphores need Vulkan 1.2 on both the instance and the selected physical device.
+    bool check_timeline_semaphore_support() const;
+
     void pick_physical_device(VkSurfaceKHR surface);
 
     void create_logical_device(VkSurfaceKHR surface);
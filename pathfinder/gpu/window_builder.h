@@ -46,6 +46,13 @@ public:
 
     virtual std::shared_ptr<Queue> create_queue() = 0;
 
+    /// Create a queue that runs compute work alongside the one from create_queue().
+    /// Call it once, after request_device(). Submissions to either queue are ordered with Queue::wait_for().
+    /// @return Null if the backend has no queue to spare.
+    virtual std::shared_ptr<Queue> create_compute_queue() {
+        return nullptr;
+    }
+
     void poll_events();
 
     void set_fullscreen(bool fullscreen);
@@ -1,35 +1,58 @@
 #include "allocator.h"
 
+#include <algorithm>
+
 namespace Pathfinder {
 
-uint64_t GpuMemoryAllocator::allocate_buffer(size_t byte_size, BufferType type, const std::string& tag) {
+static MemoryProperty get_memory_property(BufferUsage usage) {
+    switch (usage) {
+        case BufferUsage::Static:
+        case BufferUsage::GpuOnly:
+            return MemoryProperty::DeviceLocal;
+        case BufferUsage::Streaming:
+        case BufferUsage::Readback:
+        default:
+            return MemoryProperty::HostVisibleAndCoherent;
+    }
+}
+
+uint64_t GpuMemoryAllocator::allocate_buffer(size_t byte_size,
+                                             BufferType type,
+                                             const std::string& tag,
+                                             BufferUsage usage) {
     if (byte_size < MAX_BUFFER_SIZE_CLASS) {
         byte_size = upper_power_of_two(byte_size);
     }
 
-    auto descriptor = BufferDescriptor{type, byte_size, MemoryProperty::HostVisibleAndCoherent};
+    auto descriptor = BufferDescriptor{type, byte_size, get_memory_property(usage)};
 
     // Try to find a free object in the idle pool.
-    // Anything in idle_pool is confirmed safe by frame-delay.
-    for (int i = 0; i < (int)idle_pool.size(); i++) {
-        auto& free_obj = idle_pool[i];
+    // Anything in the idle pool is confirmed safe by frame-delay.
+    auto bucket_it = idle_buffers.find(descriptor);
+    if (bucket_it != idle_buffers.end() && !bucket_it->second.objects.empty()) {
+        auto& objects = bucket_it->second.objects;
 
-        if (free_obj.kind == FreeObjectKind::Buffer && free_obj.buffer_allocation.descriptor == descriptor) {
-            uint64_t id = free_obj.id;
-            BufferAllocation allocation = free_obj.buffer_allocation;
+        auto object_it = objects.back();
+        uint64_t id = object_it->id;
+        BufferAllocation allocation = object_it->buffer_allocation;
 
-            idle_pool.erase(idle_pool.begin() + i);
+        objects.pop_back();
+        idle_objects.erase(object_it);
 
-            allocation.tag = tag;
-            device->set_debug_label(allocation.buffer, tag);
+        allocation.tag = tag;
+        device->set_debug_label(allocation.buffer, tag);
 
-            bytes_committed += byte_size;
-            active_buffers[id] = allocation;
+        bytes_committed += byte_size;
+        active_buffers[id] = allocation;
 
-            return id;
-        }
+        current_churn_.reused++;
+        update_peaks();
+
+        return id;
     }
 
+    make_room(byte_size);
+
     auto buffer = device->create_buffer(descriptor, tag);
     auto id = next_buffer_id++;
     active_buffers[id] = BufferAllocation{buffer, descriptor, tag};
@@ -37,6 +60,59 @@ uint64_t GpuMemoryAllocator::allocate_buffer(size_t byte_size, BufferType type,
     bytes_allocated += byte_size;
     bytes_committed += byte_size;
 
+    current_churn_.created++;
+    current_churn_.bytes_created += byte_size;
+    update_peaks();
+
+    return id;
+}
+
+uint64_t GpuMemoryAllocator::allocate_buffer_range(size_t byte_size, BufferType type, const std::string& tag) {
+    BufferRangeAllocation allocation;
+    allocation.type = type;
+    allocation.tag = tag;
+
+    if (byte_size > MAX_BUFFER_SLAB_ALLOCATION_SIZE) {
+        allocation.dedicated_buffer_id = allocate_buffer(byte_size, type, tag);
+        allocation.range = {get_buffer(allocation.dedicated_buffer_id), 0, byte_size};
+    } else {
+        auto& slabs = buffer_slabs[type];
+
+        size_t offset = 0;
+        BufferSlab* slab = nullptr;
+
+        for (auto& existing_slab : slabs) {
+            if (existing_slab.blocks.allocate(byte_size, offset)) {
+                slab = &existing_slab;
+                break;
+            }
+        }
+
+        if (slab == nullptr) {
+            make_room(BUFFER_SLAB_SIZE);
+
+            auto descriptor = BufferDescriptor{type, BUFFER_SLAB_SIZE, MemoryProperty::HostVisibleAndCoherent};
+
+            slabs.push_back({device->create_buffer(descriptor, "buffer slab"),
+                             BuddyAllocator(BUFFER_SLAB_SIZE, BUFFER_SLAB_MIN_BLOCK_SIZE)});
+            slab = &slabs.back();
+            slab->blocks.allocate(byte_size, offset);
+
+            bytes_allocated += BUFFER_SLAB_SIZE;
+
+            current_churn_.created++;
+            current_churn_.bytes_created += BUFFER_SLAB_SIZE;
+        }
+
+        bytes_committed += slab->blocks.get_block_size(offset);
+        update_peaks();
+
+        allocation.range = {slab->buffer, offset, byte_size};
+    }
+
+    auto id = next_buffer_range_id++;
+    active_buffer_ranges[id] = allocation;
+
     return id;
 }
 
@@ -47,25 +123,31 @@ uint64_t GpuMemoryAllocator::allocate_texture(Vec2I size, TextureFormat format,
     auto byte_size = descriptor.byte_size();
 
     // Try to find a free object in the idle pool.
-    for (int i = 0; i < (int)idle_pool.size(); i++) {
-        auto& free_obj = idle_pool[i];
+    auto bucket_it = idle_textures.find(descriptor);
+    if (bucket_it != idle_textures.end() && !bucket_it->second.objects.empty()) {
+        auto& objects = bucket_it->second.objects;
 
-        if (free_obj.kind == FreeObjectKind::Texture && free_obj.texture_allocation.descriptor == descriptor) {
-            uint64_t id = free_obj.id;
-            auto allocation = free_obj.texture_allocation;
+        auto object_it = objects.back();
+        uint64_t id = object_it->id;
+        auto allocation = object_it->texture_allocation;
 
-            idle_pool.erase(idle_pool.begin() + i);
+        objects.pop_back();
+        idle_objects.erase(object_it);
 
-            allocation.tag = tag;
-            device->set_debug_label(allocation.texture, tag);
+        allocation.tag = tag;
+        device->set_debug_label(allocation.texture, tag);
 
-            bytes_committed += byte_size;
-            active_textures[id] = allocation;
+        bytes_committed += byte_size;
+        active_textures[id] = allocation;
 
-            return id;
-        }
+        current_churn_.reused++;
+        update_peaks();
+
+        return id;
     }
 
+    make_room(byte_size);
+
     auto texture = device->create_texture(descriptor, tag);
     auto id = next_texture_id++;
     active_textures[id] = TextureAllocation{texture, descriptor, tag};
@@ -73,6 +155,10 @@ uint64_t GpuMemoryAllocator::allocate_texture(Vec2I size, TextureFormat format,
     bytes_allocated += byte_size;
     bytes_committed += byte_size;
 
+    current_churn_.created++;
+    current_churn_.bytes_created += byte_size;
+    update_peaks();
+
     return id;
 }
 
@@ -94,11 +180,64 @@ void GpuMemoryAllocator::free_buffer(uint64_t id) {
     free_obj.id = id;
     free_obj.buffer_allocation = allocation;
 
+    current_churn_.freed++;
+
     // Put into current frame bucket.
     uint32_t frame_index = device->get_current_frame_index();
     pending_buckets[frame_index % frames_in_flight_].objects.push_back(free_obj);
 }
 
+void GpuMemoryAllocator::free_buffer_range(uint64_t id) {
+    auto it = active_buffer_ranges.find(id);
+    if (it == active_buffer_ranges.end()) {
+        Logger::error("Attempted to free unallocated buffer range!");
+        return;
+    }
+
+    auto allocation = it->second;
+    active_buffer_ranges.erase(it);
+
+    // A dedicated buffer is delayed by free_buffer() itself.
+    if (allocation.dedicated_buffer_id != std::numeric_limits<uint64_t>::max()) {
+        free_buffer(allocation.dedicated_buffer_id);
+        return;
+    }
+
+    // The block stays taken until the range is released, but it's no longer held by user logic.
+    auto slab = find_buffer_slab(allocation);
+    if (slab != nullptr) {
+        bytes_committed -= slab->blocks.get_block_size(allocation.range.offset);
+    }
+
+    FreeObject free_obj;
+    free_obj.timestamp = std::chrono::steady_clock::now();
+    free_obj.kind = FreeObjectKind::BufferRange;
+    free_obj.id = id;
+    free_obj.buffer_range_allocation = allocation;
+
+    current_churn_.freed++;
+
+    // The range may still be in use by frames in flight.
+    uint32_t frame_index = device->get_current_frame_index();
+    pending_buckets[frame_index % frames_in_flight_].objects.push_back(free_obj);
+}
+
+GpuMemoryAllocator::BufferSlab* GpuMemoryAllocator::find_buffer_slab(const BufferRangeAllocation& allocation) {
+    for (auto& slab : buffer_slabs[allocation.type]) {
+        if (slab.buffer == allocation.range.buffer) {
+            return &slab;
+        }
+    }
+    return nullptr;
+}
+
+void GpuMemoryAllocator::release_buffer_range(const BufferRangeAllocation& allocation) {
+    auto slab = find_buffer_slab(allocation);
+    if (slab != nullptr) {
+        slab->blocks.free(allocation.range.offset);
+    }
+}
+
 void GpuMemoryAllocator::free_texture(uint64_t id) {
     auto it = active_textures.find(id);
     if (it == active_textures.end()) {
@@ -117,6 +256,8 @@ void GpuMemoryAllocator::free_texture(uint64_t id) {
     free_obj.id = id;
     free_obj.texture_allocation = allocation;
 
+    current_churn_.freed++;
+
     // Put into current frame bucket.
     uint32_t frame_index = device->get_current_frame_index();
     pending_buckets[frame_index % frames_in_flight_].objects.push_back(free_obj);
@@ -131,6 +272,15 @@ std::shared_ptr<Buffer> GpuMemoryAllocator::get_buffer(uint64_t id) {
     return it->second.buffer;
 }
 
+BufferRange GpuMemoryAllocator::get_buffer_range(uint64_t id) {
+    auto it = active_buffer_ranges.find(id);
+    if (it == active_buffer_ranges.end()) {
+        Logger::error("Attempted to get unallocated buffer range!");
+        return {};
+    }
+    return it->second.range;
+}
+
 std::shared_ptr<Texture> GpuMemoryAllocator::get_texture(uint64_t id) {
     auto it = active_textures.find(id);
     if (it == active_textures.end()) {
@@ -149,51 +299,227 @@ void GpuMemoryAllocator::begin_frame() {
 
     last_frame_index_ = frame_index;
 
+    last_frame_churn_ = current_churn_;
+    current_churn_ = {};
+
     // Reclaim the bucket we are about to overwrite.
     // This bucket contains objects that have been "cooling down" for frames_in_flight_ frames.
     auto& bucket = pending_buckets[frame_index % frames_in_flight_];
-    if (!bucket.objects.empty()) {
-        idle_pool.insert(idle_pool.end(), bucket.objects.begin(), bucket.objects.end());
-        bucket.objects.clear();
+    for (auto& free_obj : bucket.objects) {
+        if (free_obj.kind == FreeObjectKind::Buffer) {
+            idle_objects.push_back(free_obj);
+            idle_buffers[free_obj.buffer_allocation.descriptor].objects.push_back(std::prev(idle_objects.end()));
+        } else if (free_obj.kind == FreeObjectKind::BufferRange) {
+            // Ranges go straight back to their slab.
+            release_buffer_range(free_obj.buffer_range_allocation);
+        } else {
+            idle_objects.push_back(free_obj);
+            idle_textures[free_obj.texture_allocation.descriptor].objects.push_back(std::prev(idle_objects.end()));
+        }
     }
+    bucket.objects.clear();
+
+    // Objects that just became idle can be evicted now.
+    make_room(0);
+}
+
+static size_t get_idle_object_size(const FreeObject& free_obj) {
+    if (free_obj.kind == FreeObjectKind::Buffer) {
+        return free_obj.buffer_allocation.buffer->get_size();
+    }
+    return free_obj.texture_allocation.descriptor.byte_size();
 }
 
 void GpuMemoryAllocator::purge_if_needed() {
     auto now = std::chrono::steady_clock::now();
+
     bool purge_happened = false;
 
-    for (auto it = idle_pool.begin(); it != idle_pool.end();) {
-        std::chrono::duration<double> duration = now - it->timestamp;
-        if (duration.count() >= DECAY_TIME) {
-            if (it->kind == FreeObjectKind::Buffer) {
-                bytes_allocated -= it->buffer_allocation.buffer->get_size();
+    // Objects are ordered by the time they were freed, so only the front ones can have decayed.
+    while (!idle_objects.empty()) {
+        std::chrono::duration<double> duration = now - idle_objects.front().timestamp;
+        if (duration.count() < DECAY_TIME) {
+            break;
+        }
+
+        current_churn_.purged++;
+        destroy_oldest_idle_object();
+        purge_happened = true;
+    }
+
+    if (purge_happened) print_info();
+}
+
+/// Remove the front object of a bucket, and the bucket itself once it's empty.
+template <typename Map>
+static void pop_oldest_bucket_object(Map& idle_buckets, const typename Map::key_type& descriptor) {
+    auto bucket_it = idle_buckets.find(descriptor);
+    assert(bucket_it != idle_buckets.end());
+
+    bucket_it->second.objects.pop_front();
+    if (bucket_it->second.objects.empty()) {
+        idle_buckets.erase(bucket_it);
+    }
+}
+
+void GpuMemoryAllocator::destroy_oldest_idle_object() {
+    auto& free_obj = idle_objects.front();
+
+    // Buckets keep the order of the idle list, so the oldest object is also at the front of its bucket.
+    if (free_obj.kind == FreeObjectKind::Buffer) {
+        pop_oldest_bucket_object(idle_buffers, free_obj.buffer_allocation.descriptor);
+    } else {
+        pop_oldest_bucket_object(idle_textures, free_obj.texture_allocation.descriptor);
+    }
+
+    auto byte_size = get_idle_object_size(free_obj);
+    bytes_allocated -= byte_size;
+    current_churn_.bytes_destroyed += byte_size;
+
+    idle_objects.pop_front();
+}
+
+void GpuMemoryAllocator::evict_idle_objects(size_t target_bytes) {
+    while (bytes_allocated > target_bytes && !idle_objects.empty()) {
+        current_churn_.evicted++;
+        destroy_oldest_idle_object();
+    }
+
+    // Empty slabs are the last resort, as small ranges are requested often.
+    for (auto& pair : buffer_slabs) {
+        auto& slabs = pair.second;
+
+        for (auto it = slabs.begin(); it != slabs.end() && bytes_allocated > target_bytes;) {
+            if (it->blocks.is_empty()) {
+                bytes_allocated -= BUFFER_SLAB_SIZE;
+                current_churn_.evicted++;
+                current_churn_.bytes_destroyed += BUFFER_SLAB_SIZE;
+
+                it = slabs.erase(it);
             } else {
-                bytes_allocated -= it->texture_allocation.descriptor.byte_size();
+                ++it;
             }
-            it = idle_pool.erase(it);
-            purge_happened = true;
-        } else {
-            ++it;
         }
     }
+}
 
-    if (purge_happened) print_info();
+void GpuMemoryAllocator::make_room(size_t byte_size) {
+    if (memory_budget_ == 0 || bytes_allocated + byte_size <= memory_budget_) {
+        return;
+    }
+
+    size_t target_bytes = memory_budget_ > byte_size ? memory_budget_ - byte_size : 0;
+
+    evict_idle_objects(target_bytes);
+
+    if (bytes_allocated <= target_bytes || handling_pressure_) {
+        return;
+    }
+
+    // Objects freed by the callbacks become idle after frames_in_flight_ frames and are evicted then.
+    handling_pressure_ = true;
+    for (auto& pair : pressure_callbacks_) {
+        pair.second(bytes_allocated - target_bytes);
+    }
+    handling_pressure_ = false;
+}
+
+void GpuMemoryAllocator::update_peaks() {
+    peak_bytes_allocated = std::max(peak_bytes_allocated, bytes_allocated);
+    peak_bytes_committed = std::max(peak_bytes_committed, bytes_committed);
+}
+
+void GpuMemoryAllocator::set_memory_budget(size_t budget) {
+    memory_budget_ = budget;
+    make_room(0);
+}
+
+uint64_t GpuMemoryAllocator::add_pressure_callback(MemoryPressureCallback callback) {
+    auto id = next_pressure_callback_id_++;
+    pressure_callbacks_[id] = std::move(callback);
+    return id;
+}
+
+void GpuMemoryAllocator::remove_pressure_callback(uint64_t id) {
+    pressure_callbacks_.erase(id);
+}
+
+GpuMemoryStats GpuMemoryAllocator::get_stats() const {
+    GpuMemoryStats stats;
+
+    stats.budget = memory_budget_;
+    stats.bytes_allocated = bytes_allocated;
+    stats.bytes_committed = bytes_committed;
+    stats.peak_bytes_allocated = peak_bytes_allocated;
+    stats.peak_bytes_committed = peak_bytes_committed;
+    stats.last_frame_churn = last_frame_churn_;
+
+    for (const auto& pair : active_buffers) {
+        auto byte_size = pair.second.descriptor.size;
+        stats.active_buffers.count++;
+        stats.active_buffers.bytes += byte_size;
+        stats.active_by_tag[pair.second.tag].count++;
+        stats.active_by_tag[pair.second.tag].bytes += byte_size;
+    }
+
+    for (const auto& pair : active_textures) {
+        auto byte_size = pair.second.descriptor.byte_size();
+        stats.active_textures.count++;
+        stats.active_textures.bytes += byte_size;
+        stats.active_by_tag[pair.second.tag].count++;
+        stats.active_by_tag[pair.second.tag].bytes += byte_size;
+    }
+
+    for (const auto& pair : active_buffer_ranges) {
+        // Dedicated buffers are counted as active buffers already.
+        if (pair.second.dedicated_buffer_id != std::numeric_limits<uint64_t>::max()) {
+            continue;
+        }
+        auto byte_size = pair.second.range.size;
+        stats.active_buffer_ranges.count++;
+        stats.active_buffer_ranges.bytes += byte_size;
+        stats.active_by_tag[pair.second.tag].count++;
+        stats.active_by_tag[pair.second.tag].bytes += byte_size;
+    }
+
+    for (const auto& free_obj : idle_objects) {
+        auto& usage = free_obj.kind == FreeObjectKind::Buffer ? stats.idle_buffers : stats.idle_textures;
+        usage.count++;
+        usage.bytes += get_idle_object_size(free_obj);
+    }
+
+    for (const auto& bucket : pending_buckets) {
+        stats.pending_count += bucket.objects.size();
+    }
+
+    for (const auto& pair : buffer_slabs) {
+        stats.buffer_slabs.count += pair.second.size();
+        stats.buffer_slabs.bytes += pair.second.size() * BUFFER_SLAB_SIZE;
+    }
+
+    return stats;
 }
 
 void GpuMemoryAllocator::print_info() {
     size_t texture_count = active_textures.size();
     size_t buffer_count = active_buffers.size();
 
-    size_t idle_count = idle_pool.size();
     size_t pending_count = 0;
     for (const auto& bucket : pending_buckets) {
         pending_count += bucket.objects.size();
     }
 
+    size_t slab_count = 0;
+    for (const auto& pair : buffer_slabs) {
+        slab_count += pair.second.size();
+    }
+
     Logger::debug("Current status: ALLOCATED " + std::to_string(int(bytes_allocated / 1024.f)) + " KB | COMMITTED " +
                   std::to_string(int(bytes_committed / 1024.f)) + " KB | Active textures " +
                   std::to_string(texture_count) + " | Active buffers " + std::to_string(buffer_count) +
-                  " | Free (Idle/Pending) " + std::to_string(idle_count) + "/" + std::to_string(pending_count));
+                  " | Active buffer ranges " + std::to_string(active_buffer_ranges.size()) + " in " +
+                  std::to_string(slab_count) + " slabs | Free (Idle/Pending) " + std::to_string(idle_objects.size()) + "/" +
+                  std::to_string(pending_count));
 
     for (auto& allocation : active_textures) {
         Logger::debug("Active texture " + std::to_string(allocation.first) + ": " + allocation.second.tag + " - " +
@@ -3,12 +3,17 @@
 #include <array>
 #include <chrono>
 #include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "../common/math/basic.h"
 #include "../gpu/device.h"
+#include "buddy_allocator.h"
 
 namespace Pathfinder {
 
@@ -19,12 +24,42 @@ constexpr size_t MAX_BUFFER_SIZE_CLASS = 16 * 1024 * 1024;
 // Number of seconds before unused memory is purged from idle_pool.
 constexpr float DECAY_TIME = 2.0;
 
+// Size of the backing buffers small buffer ranges are sub-allocated from.
+constexpr size_t BUFFER_SLAB_SIZE = 1024 * 1024;
+
+// Smallest sub-allocated range. Also the offset alignment, which covers uniform and storage buffer
+// offset requirements on all backends.
+constexpr size_t BUFFER_SLAB_MIN_BLOCK_SIZE = 256;
+
+// Ranges larger than this get a buffer of their own.
+constexpr size_t MAX_BUFFER_SLAB_ALLOCATION_SIZE = 64 * 1024;
+
+/// How a buffer is accessed, which decides where it's placed.
+enum class BufferUsage {
+    /// Written through staged uploads (CommandEncoder::write_buffer) and read by the GPU. Device-local.
+    Static,
+    /// Written by the CPU through mapping, typically every frame. Host-visible.
+    Streaming,
+    /// Written and read by the GPU only. Device-local.
+    GpuOnly,
+    /// Written by the GPU and read by the CPU through mapping. Host-visible.
+    Readback,
+};
+
 struct BufferAllocation {
     std::shared_ptr<Buffer> buffer;
     BufferDescriptor descriptor;
     std::string tag;
 };
 
+struct BufferRangeAllocation {
+    BufferRange range;
+    BufferType type;
+    /// Set if the range didn't fit into a slab and has a buffer of its own.
+    uint64_t dedicated_buffer_id = std::numeric_limits<uint64_t>::max();
+    std::string tag;
+};
+
 struct TextureAllocation {
     std::shared_ptr<Texture> texture;
     TextureDescriptor descriptor;
@@ -33,6 +68,7 @@ struct TextureAllocation {
 
 enum class FreeObjectKind {
     Buffer,
+    BufferRange,
     Texture,
     Framebuffer,
     Max,
@@ -44,6 +80,7 @@ struct FreeObject {
     uint64_t id = std::numeric_limits<uint64_t>::max();
 
     BufferAllocation buffer_allocation;
+    BufferRangeAllocation buffer_range_allocation;
     TextureAllocation texture_allocation;
 };
 
@@ -51,6 +88,86 @@ struct FrameBucket {
     std::vector<FreeObject> objects;
 };
 
+/// Idle objects sharing a descriptor, pointing into the allocator's idle list.
+/// Objects are kept in the order they were freed, so the oldest ones, which decay first, are at the front
+/// and the most recently used ones are reused from the back.
+struct IdleBucket {
+    std::deque<std::list<FreeObject>::iterator> objects;
+};
+
+struct BufferDescriptorHash {
+    size_t operator()(const BufferDescriptor& descriptor) const {
+        return descriptor.size ^ ((size_t)descriptor.type << 56) ^ ((size_t)descriptor.property << 60);
+    }
+};
+
+struct TextureDescriptorHash {
+    size_t operator()(const TextureDescriptor& descriptor) const {
+        return (size_t)descriptor.size.x ^ ((size_t)descriptor.size.y << 24) ^ ((size_t)descriptor.format << 48);
+    }
+};
+
+/// Number and total size of a group of objects.
+struct GpuMemoryUsage {
+    size_t count = 0;
+    size_t bytes = 0;
+};
+
+/// Object turnover during a single frame.
+struct GpuMemoryChurn {
+    /// Objects created on the device.
+    size_t created = 0;
+    size_t bytes_created = 0;
+
+    /// Allocations served from the idle pool.
+    size_t reused = 0;
+
+    size_t freed = 0;
+
+    /// Idle objects destroyed after DECAY_TIME.
+    size_t purged = 0;
+
+    /// Idle objects destroyed early to stay within the memory budget.
+    size_t evicted = 0;
+
+    size_t bytes_destroyed = 0;
+};
+
+struct GpuMemoryStats {
+    /// Zero if there's no budget.
+    size_t budget = 0;
+
+    size_t bytes_allocated = 0;
+    size_t bytes_committed = 0;
+
+    size_t peak_bytes_allocated = 0;
+    size_t peak_bytes_committed = 0;
+
+    /// Objects held by user logic, per kind. Buffer range bytes are the requested sizes.
+    GpuMemoryUsage active_buffers;
+    GpuMemoryUsage active_textures;
+    GpuMemoryUsage active_buffer_ranges;
+
+    /// Objects waiting to be reused or destroyed, per kind.
+    GpuMemoryUsage idle_buffers;
+    GpuMemoryUsage idle_textures;
+
+    size_t pending_count = 0;
+
+    /// Backing buffers of buffer ranges.
+    GpuMemoryUsage buffer_slabs;
+
+    /// Active objects per allocation tag.
+    std::unordered_map<std::string, GpuMemoryUsage> active_by_tag;
+
+    /// Turnover of the last finished frame.
+    GpuMemoryChurn last_frame_churn;
+};
+
+/// Called when the memory budget is exceeded and there are no idle objects left to evict.
+/// The argument is the number of bytes over the budget. Owners of cached objects should free what they can spare.
+using MemoryPressureCallback = std::function<void(size_t)>;
+
 /// GPU memory management.
 class GpuMemoryAllocator {
 public:
@@ -59,16 +176,28 @@ public:
         pending_buckets.resize(frames_in_flight_);
     }
 
-    uint64_t allocate_buffer(size_t byte_size, BufferType type, const std::string& tag);
+    /// Buffers that are never mapped should be Static or GpuOnly, so that they live in device-local memory.
+    uint64_t allocate_buffer(size_t byte_size,
+                             BufferType type,
+                             const std::string& tag,
+                             BufferUsage usage = BufferUsage::Streaming);
 
     uint64_t allocate_texture(Vec2I size, TextureFormat format, const std::string& tag);
 
+    /// Allocate a range of a shared buffer. Suited to small buffers like uniform buffers, which would otherwise
+    /// take a device buffer each. Bind the range with its offset and size.
+    uint64_t allocate_buffer_range(size_t byte_size, BufferType type, const std::string& tag);
+
     std::shared_ptr<Buffer> get_buffer(uint64_t id);
 
+    BufferRange get_buffer_range(uint64_t id);
+
     std::shared_ptr<Texture> get_texture(uint64_t id);
 
     void free_buffer(uint64_t id);
 
+    void free_buffer_range(uint64_t id);
+
     void free_texture(uint64_t id);
 
     /// Notify the allocator that a new frame has started.
@@ -77,6 +206,23 @@ public:
 
     void purge_if_needed();
 
+    /// Limit the device memory held by this allocator. Zero means no limit.
+    ///
+    /// The budget is soft: allocations always succeed. When it's exceeded, idle objects are destroyed
+    /// starting from the least recently used ones, then pressure callbacks are invoked.
+    void set_memory_budget(size_t budget);
+
+    size_t get_memory_budget() const {
+        return memory_budget_;
+    }
+
+    /// @return ID to remove the callback with.
+    uint64_t add_pressure_callback(MemoryPressureCallback callback);
+
+    void remove_pressure_callback(uint64_t id);
+
+    GpuMemoryStats get_stats() const;
+
     void print_info();
 
 private:
@@ -84,12 +230,44 @@ private:
 
     std::unordered_map<uint64_t, BufferAllocation> active_buffers;
     std::unordered_map<uint64_t, TextureAllocation> active_textures;
+    std::unordered_map<uint64_t, BufferRangeAllocation> active_buffer_ranges;
+
+    struct BufferSlab {
+        std::shared_ptr<Buffer> buffer;
+        BuddyAllocator blocks;
+    };
+
+    /// Backing buffers of buffer ranges, per buffer type.
+    std::unordered_map<BufferType, std::vector<BufferSlab>> buffer_slabs;
+
+    /// @return Null if the range has a dedicated buffer.
+    BufferSlab* find_buffer_slab(const BufferRangeAllocation& allocation);
+
+    /// Return the block of a range to its slab.
+    void release_buffer_range(const BufferRangeAllocation& allocation);
+
+    /// Destroy idle objects and empty slabs until `byte_size` more bytes fit into the budget,
+    /// then notify the pressure callbacks if that wasn't enough.
+    void make_room(size_t byte_size);
+
+    void evict_idle_objects(size_t target_bytes);
+
+    /// Destroy the least recently used idle object.
+    void destroy_oldest_idle_object();
+
+    void update_peaks();
 
     uint64_t next_buffer_id = 0;
+    uint64_t next_buffer_range_id = 0;
     uint64_t next_texture_id = 0;
 
-    // Resources that are confirmed to be safe for reuse (at least frames_in_flight_ old).
-    std::vector<FreeObject> idle_pool;
+    // Resources that are confirmed to be safe for reuse (at least frames_in_flight_ old),
+    // in the order they became idle, so that the least recently used one is at the front.
+    std::list<FreeObject> idle_objects;
+
+    // Idle resources bucketed by descriptor so that acquiring and releasing one is O(1).
+    std::unordered_map<BufferDescriptor, IdleBucket, BufferDescriptorHash> idle_buffers;
+    std::unordered_map<TextureDescriptor, IdleBucket, TextureDescriptorHash> idle_textures;
 
     // Resources organized by their free-frame index.
     std::vector<FrameBucket> pending_buckets;
@@ -105,6 +283,20 @@ private:
 
     /// Total GPU memory allocated on the device (Active + Pending + Idle states).
     size_t bytes_allocated = 0;
+
+    size_t peak_bytes_allocated = 0;
+    size_t peak_bytes_committed = 0;
+
+    GpuMemoryChurn current_churn_;
+    GpuMemoryChurn last_frame_churn_;
+
+    size_t memory_budget_ = 0;
+
+    std::unordered_map<uint64_t, MemoryPressureCallback> pressure_callbacks_;
+    uint64_t next_pressure_callback_id_ = 0;
+
+    /// Avoids invoking the pressure callbacks from within themselves.
+    bool handling_pressure_ = false;
 };
 
 } // namespace Pathfinder
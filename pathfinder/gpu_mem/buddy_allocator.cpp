@@ -0,0 +1,89 @@
+#include "buddy_allocator.h"
+
+#include <algorithm>
+
+#include "../common/logger.h"
+
+namespace Pathfinder {
+
+BuddyAllocator::BuddyAllocator(size_t size, size_t min_block_size) : min_block_size_(min_block_size) {
+    while ((min_block_size_ << (max_order_ + 1)) <= size) {
+        max_order_++;
+    }
+
+    free_blocks_.resize(max_order_ + 1);
+    free_blocks_[max_order_].insert(0);
+}
+
+uint32_t BuddyAllocator::get_order(size_t size) const {
+    uint32_t order = 0;
+    while ((min_block_size_ << order) < size) {
+        order++;
+    }
+    return order;
+}
+
+bool BuddyAllocator::allocate(size_t size, size_t &offset) {
+    uint32_t order = get_order(std::max(size, (size_t)1));
+    if (order > max_order_) {
+        return false;
+    }
+
+    // Find the smallest free block that fits.
+    uint32_t free_order = order;
+    while (free_order <= max_order_ && free_blocks_[free_order].empty()) {
+        free_order++;
+    }
+
+    if (free_order > max_order_) {
+        return false;
+    }
+
+    offset = *free_blocks_[free_order].begin();
+    free_blocks_[free_order].erase(free_blocks_[free_order].begin());
+
+    // Split it down, keeping the upper halves free.
+    while (free_order > order) {
+        free_order--;
+        free_blocks_[free_order].insert(offset + (min_block_size_ << free_order));
+    }
+
+    allocated_orders_[offset] = order;
+
+    return true;
+}
+
+void BuddyAllocator::free(size_t offset) {
+    auto it = allocated_orders_.find(offset);
+    if (it == allocated_orders_.end()) {
+        Logger::error("Attempted to free an unallocated block!");
+        return;
+    }
+
+    uint32_t order = it->second;
+    allocated_orders_.erase(it);
+
+    // Merge with free buddies as far as possible.
+    while (order < max_order_) {
+        size_t buddy_offset = offset ^ (min_block_size_ << order);
+
+        if (free_blocks_[order].erase(buddy_offset) == 0) {
+            break;
+        }
+
+        offset = std::min(offset, buddy_offset);
+        order++;
+    }
+
+    free_blocks_[order].insert(offset);
+}
+
+size_t BuddyAllocator::get_block_size(size_t offset) const {
+    auto it = allocated_orders_.find(offset);
+    if (it == allocated_orders_.end()) {
+        return 0;
+    }
+    return min_block_size_ << it->second;
+}
+
+} // namespace Pathfinder
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace Pathfinder {
+
+/// Buddy allocation of offsets inside a block of memory.
+///
+/// Blocks are power-of-two multiples of the minimum block size, aligned to their own size.
+/// Freed blocks are merged with their buddy whenever it's free as well.
+class BuddyAllocator {
+public:
+    /// `size` is rounded down to a power-of-two multiple of `min_block_size`, which must be a power of two.
+    BuddyAllocator(size_t size, size_t min_block_size);
+
+    /// @return False if there's no free block large enough.
+    bool allocate(size_t size, size_t &offset);
+
+    void free(size_t offset);
+
+    /// Size of the block reserved by an allocation.
+    size_t get_block_size(size_t offset) const;
+
+    /// Nothing is allocated.
+    bool is_empty() const {
+        return allocated_orders_.empty();
+    }
+
+private:
+    uint32_t get_order(size_t size) const;
+
+    size_t min_block_size_;
+
+    uint32_t max_order_ = 0;
+
+    /// Offsets of free blocks, per order.
+    std::vector<std::set<size_t>> free_blocks_;
+
+    /// Order of each allocated block, keyed by offset.
+    std::unordered_map<size_t, uint32_t> allocated_orders_;
+};
+
+} // namespace Pathfinder
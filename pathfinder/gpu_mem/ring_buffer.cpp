@@ -0,0 +1,104 @@
+#include "ring_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "../common/math/basic.h"
+
+namespace Pathfinder {
+
+// Keeps vertex attribute offsets valid on all backends.
+constexpr size_t RING_BUFFER_ALIGNMENT = 256;
+
+RingBuffer::RingBuffer(const std::shared_ptr<Device> &_device, BufferType type, size_t block_size, std::string label)
+    : device(_device), type_(type), block_size_(block_size), label_(std::move(label)) {
+    regions_.resize(device->get_frames_in_flight());
+}
+
+void RingBuffer::begin_frame(uint32_t frame_index) {
+    current_region_ = frame_index % regions_.size();
+
+    auto &region = regions_[current_region_];
+
+    // The region overflowed last time. Its frame has finished, so replace the blocks with a single one
+    // large enough to hold all of them.
+    if (region.blocks.size() > 1) {
+        size_t total_size = 0;
+        for (auto &block : region.blocks) {
+            total_size += block.buffer->get_size();
+        }
+
+        region.blocks.clear();
+        region.blocks.push_back({create_block_buffer((size_t)upper_power_of_two(total_size)), 0});
+    }
+
+    for (auto &block : region.blocks) {
+        block.used_size = 0;
+    }
+}
+
+StagingAllocation RingBuffer::allocate(size_t size) {
+    auto &region = regions_[current_region_];
+
+    Block *target_block = nullptr;
+    size_t offset = 0;
+
+    for (auto &block : region.blocks) {
+        size_t aligned_offset = (block.used_size + RING_BUFFER_ALIGNMENT - 1) & ~(RING_BUFFER_ALIGNMENT - 1);
+
+        if (aligned_offset + size <= block.buffer->get_size()) {
+            target_block = &block;
+            offset = aligned_offset;
+            break;
+        }
+    }
+
+    // Blocks in use by the current frame can't be resized, so add another one.
+    if (target_block == nullptr) {
+        region.blocks.push_back({create_block_buffer(std::max(block_size_, (size_t)upper_power_of_two(size))), 0});
+        target_block = &region.blocks.back();
+    }
+
+    target_block->used_size = offset + size;
+
+    StagingAllocation allocation;
+    allocation.buffer = target_block->buffer;
+    allocation.offset = offset;
+    allocation.data_size = size;
+    allocation.mapped_ptr = device->map_staging(allocation);
+
+    return allocation;
+}
+
+void RingBuffer::unmap(const StagingAllocation &allocation) {
+    device->unmap_staging(allocation);
+}
+
+StagingAllocation RingBuffer::upload(size_t size, const void *data) {
+    auto allocation = allocate(size);
+
+    if (allocation.mapped_ptr) {
+        memcpy(allocation.mapped_ptr, data, size);
+    } else {
+        allocation.buffer->upload_via_mapping(size, allocation.offset, data);
+    }
+
+    unmap(allocation);
+
+    return allocation;
+}
+
+size_t RingBuffer::get_used_size() const {
+    size_t used_size = 0;
+    for (auto &block : regions_[current_region_].blocks) {
+        used_size += block.used_size;
+    }
+    return used_size;
+}
+
+std::shared_ptr<Buffer> RingBuffer::create_block_buffer(size_t size) {
+    auto desc = BufferDescriptor{type_, size, MemoryProperty::HostVisibleAndCoherent};
+    return device->create_streaming_buffer(desc, label_);
+}
+
+} // namespace Pathfinder
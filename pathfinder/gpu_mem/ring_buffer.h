@@ -0,0 +1,60 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../gpu/device.h"
+
+namespace Pathfinder {
+
+/// Per-frame streaming memory for data rebuilt every frame, such as instance attributes.
+///
+/// Holds a region for each frame in flight. Allocations are sub-ranges of the region of the current frame,
+/// and a region is only rewritten once its frame index comes around again, by which time the device has
+/// waited for the frame that last used it.
+class RingBuffer {
+public:
+    RingBuffer(const std::shared_ptr<Device> &_device, BufferType type, size_t block_size, std::string label);
+
+    /// Switch to the region of the given frame and reclaim its previous content.
+    void begin_frame(uint32_t frame_index);
+
+    /// Reserve a sub-range of the current region. The returned range is mapped and can be written directly.
+    StagingAllocation allocate(size_t size);
+
+    /// Finish writing an allocation. Required before the range is used by GPU commands.
+    void unmap(const StagingAllocation &allocation);
+
+    /// Allocate and fill a sub-range in one go.
+    StagingAllocation upload(size_t size, const void *data);
+
+    /// Bytes allocated by the current frame so far.
+    size_t get_used_size() const;
+
+private:
+    struct Block {
+        std::shared_ptr<Buffer> buffer;
+        size_t used_size = 0;
+    };
+
+    struct Region {
+        std::vector<Block> blocks;
+    };
+
+    std::shared_ptr<Buffer> create_block_buffer(size_t size);
+
+    std::shared_ptr<Device> device;
+
+    BufferType type_;
+
+    size_t block_size_;
+
+    std::string label_;
+
+    std::vector<Region> regions_;
+
+    uint32_t current_region_ = 0;
+};
+
+} // namespace Pathfinder
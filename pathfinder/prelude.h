@@ -18,3 +18,12 @@
 #include "gpu/window.h"
 #include "gpu/window_builder.h"
 #include "utils/blit.h"
+
+#ifdef PATHFINDER_USE_NULL
+    #include "gpu/null/device.h"
+    #include "gpu/null/queue.h"
+#endif
+
+#ifdef PATHFINDER_USE_CPU
+    #include "gpu/cpu/device.h"
+#endif
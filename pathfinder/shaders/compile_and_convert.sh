@@ -30,8 +30,12 @@ $GENERATOR -i d3d11/bin.comp -o generated/bin_comp.shdbin -t comp
 $GENERATOR -i d3d11/bound.comp -o generated/bound_comp.shdbin -t comp
 $GENERATOR -i d3d11/dice.comp -o generated/dice_comp.shdbin -t comp
 $GENERATOR -i d3d11/fill.comp -o generated/fill_comp.shdbin -t comp
+$GENERATOR -i d3d11/fill_group.comp -o generated/fill_group_comp.shdbin -t comp
+$GENERATOR -i d3d11/fill_grouped.comp -o generated/fill_grouped_comp.shdbin -t comp
 $GENERATOR -i d3d11/propagate.comp -o generated/propagate_comp.shdbin -t comp
+$GENERATOR -i d3d11/radix_sort.comp -o generated/radix_sort_comp.shdbin -t comp
 $GENERATOR -i d3d11/sort.comp -o generated/sort_comp.shdbin -t comp
+$GENERATOR -i d3d11/sort_keys.comp -o generated/sort_keys_comp.shdbin -t comp
 $GENERATOR -i d3d11/tile.comp -o generated/tile_comp.shdbin -t comp
 
 # 5. Copy supporting files
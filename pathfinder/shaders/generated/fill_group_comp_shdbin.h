@@ -0,0 +1,5 @@
+#pragma once
+
+namespace Pathfinder {
+    static uint8_t fill_group_comp_shdbin[] = {83,72,68,66,1,0,0,0,1,4,0,0,0,5,0,0,0,2,4,0,0,0,251,9,0,0,109,97,105,110,47,47,66,73,78,68,73,78,71,95,83,84,65,82,84,10,47,47,85,66,79,58,98,85,110,105,102,111,114,109,58,53,10,47,47,66,73,78,68,73,78,71,95,69,78,68,10,35,118,101,114,115,105,111,110,32,52,53,48,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,78,69,88,84,95,84,73,76,69,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,70,73,82,83,84,95,70,73,76,76,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,49,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,66,65,67,75,68,82,79,80,95,65,76,80,72,65,95,84,73,76,69,95,73,68,32,32,32,50,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,67,79,78,84,82,79,76,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,51,117,10,10,35,100,101,102,105,110,101,32,77,65,88,95,70,73,76,76,95,73,84,69,82,65,84,73,79,78,83,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,48,50,52,117,10,10,47,47,32,71,114,111,117,112,101,100,32,102,105,108,108,32,99,111,117,110,116,44,32,102,111,108,108,111,119,101,100,32,98,121,32,97,32,40,102,105,114,115,116,32,103,114,111,117,112,101,100,32,102,105,108,108,44,32,102,105,108,108,32,99,111,117,110,116,41,32,112,97,105,114,32,112,101,114,32,97,108,112,104,97,32,116,105,108,101,46,10,35,100,101,102,105,110,101,32,70,73,76,76,95,82,65,78,71,69,83,95,71,82,79,85,80,69,68,95,70,73,76,76,95,67,79,85,78,84,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,32,32,52,117,10,10,108,97,121,111,117,116,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,54,52,41,32,105,110,59,10,10,108,97,121,111,117,116,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,53,41,32,117,110,105,102,111,114,109,32,98,85,110,105,102,111,114,109,32,123,10,32,32,32,32,105,118,101,99,50,32,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,59,10,32,32,32,32,105,118,101,99,50,32,117,80,97,100,48,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,98,117,102,102,101,114,32,98,70,105,108,108,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,102,114,111,109,44,32,91,49,93,58,32,116,111,44,32,91,50,93,58,32,110,101,120,116,32,102,105,108,108,32,73,68,10,32,32,32,32,117,105,110,116,32,105,70,105,108,108,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,98,117,102,102,101,114,32,98,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,110,101,120,116,32,116,105,108,101,32,73,68,10,32,32,32,32,47,47,32,91,49,93,58,32,102,105,114,115,116,32,102,105,108,108,32,73,68,10,32,32,32,32,47,47,32,91,50,93,58,32,98,97,99,107,100,114,111,112,32,100,101,108,116,97,32,117,112,112,101,114,32,56,32,98,105,116,115,44,32,97,108,112,104,97,32,116,105,108,101,32,73,68,32,108,111,119,101,114,32,50,52,10,32,32,32,32,47,47,32,91,51,93,58,32,99,111,108,111,114,47,99,116,114,108,47,98,97,99,107,100,114,111,112,32,119,111,114,100,10,32,32,32,32,117,105,110,116,32,105,84,105,108,101,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,98,117,102,102,101,114,32,98,65,108,112,104,97,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,97,108,112,104,97,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,47,47,32,91,49,93,58,32,99,108,105,112,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,117,105,110,116,32,105,65,108,112,104,97,84,105,108,101,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,98,117,102,102,101,114,32,98,71,114,111,117,112,101,100,70,105,108,108,115,32,123,10,32,32,32,32,47,47,32,120,58,32,102,114,111,109,44,32,121,58,32,116,111,10,32,32,32,32,117,118,101,99,50,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,52,41,32,98,117,102,102,101,114,32,98,70,105,108,108,82,97,110,103,101,115,32,123,10,32,32,32,32,117,105,110,116,32,105,70,105,108,108,82,97,110,103,101,115,91,93,59,10,125,59,10,10,47,47,47,32,67,111,112,121,32,116,104,101,32,102,105,108,108,32,108,105,115,116,32,111,102,32,101,97,99,104,32,97,108,112,104,97,32,116,105,108,101,32,105,110,116,111,32,97,32,99,111,110,116,105,103,117,111,117,115,32,114,97,110,103,101,44,32,107,101,101,112,105,110,103,32,116,104,101,32,108,105,115,116,32,111,114,100,101,114,46,10,118,111,105,100,32,109,97,105,110,40,41,32,123,10,32,32,32,32,117,105,110,116,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,105,102,32,40,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,61,32,117,105,110,116,40,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,121,32,45,32,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,120,41,41,32,114,101,116,117,114,110,59,10,10,32,32,32,32,117,105,110,116,32,116,105,108,101,73,110,100,101,120,32,61,32,105,65,108,112,104,97,84,105,108,101,115,91,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,59,10,32,32,32,32,105,110,116,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,32,61,32,105,110,116,40,105,84,105,108,101,115,91,116,105,108,101,73,110,100,101,120,32,42,32,52,117,32,43,32,84,73,76,69,95,70,73,69,76,68,95,70,73,82,83,84,95,70,73,76,76,95,73,68,93,41,59,10,10,32,32,32,32,117,105,110,116,32,102,105,108,108,67,111,117,110,116,32,61,32,48,117,59,10,32,32,32,32,102,111,114,32,40,105,110,116,32,102,105,108,108,73,110,100,101,120,32,61,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,59,32,102,105,108,108,73,110,100,101,120,32,62,61,32,48,32,38,38,32,102,105,108,108,67,111,117,110,116,32,60,32,77,65,88,95,70,73,76,76,95,73,84,69,82,65,84,73,79,78,83,59,32,102,105,108,108,67,111,117,110,116,43,43,41,32,123,10,32,32,32,32,32,32,32,32,102,105,108,108,73,110,100,101,120,32,61,32,105,110,116,40,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,50,93,41,59,10,32,32,32,32,125,10,10,32,32,32,32,117,105,110,116,32,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,32,61,32,48,117,59,10,32,32,32,32,105,102,32,40,102,105,108,108,67,111,117,110,116,32,62,32,48,117,41,32,123,10,32,32,32,32,32,32,32,32,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,32,61,32,97,116,111,109,105,99,65,100,100,40,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,71,82,79,85,80,69,68,95,70,73,76,76,95,67,79,85,78,84,93,44,32,102,105,108,108,67,111,117,110,116,41,59,10,10,32,32,32,32,32,32,32,32,105,110,116,32,102,105,108,108,73,110,100,101,120,32,61,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,102,105,108,108,67,111,117,110,116,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,32,43,32,105,93,32,61,32,117,118,101,99,50,40,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,48,93,44,32,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,49,93,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,102,105,108,108,73,110,100,101,120,32,61,32,105,110,116,40,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,50,93,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,32,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,32,61,32,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,59,10,32,32,32,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,49,117,93,32,61,32,102,105,108,108,67,111,117,110,116,59,10,125,10,83,72,68,66,1,0,0,0,4,3,0,0,0,1,0,0,0,2,4,0,0,0,254,9,0,0,109,97,105,110,47,47,66,73,78,68,73,78,71,95,83,84,65,82,84,10,47,47,85,66,79,58,98,85,110,105,102,111,114,109,58,53,10,47,47,66,73,78,68,73,78,71,95,69,78,68,10,35,118,101,114,115,105,111,110,32,51,49,48,32,101,115,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,78,69,88,84,95,84,73,76,69,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,70,73,82,83,84,95,70,73,76,76,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,49,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,66,65,67,75,68,82,79,80,95,65,76,80,72,65,95,84,73,76,69,95,73,68,32,32,32,50,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,67,79,78,84,82,79,76,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,51,117,10,10,35,100,101,102,105,110,101,32,77,65,88,95,70,73,76,76,95,73,84,69,82,65,84,73,79,78,83,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,48,50,52,117,10,10,47,47,32,71,114,111,117,112,101,100,32,102,105,108,108,32,99,111,117,110,116,44,32,102,111,108,108,111,119,101,100,32,98,121,32,97,32,40,102,105,114,115,116,32,103,114,111,117,112,101,100,32,102,105,108,108,44,32,102,105,108,108,32,99,111,117,110,116,41,32,112,97,105,114,32,112,101,114,32,97,108,112,104,97,32,116,105,108,101,46,10,35,100,101,102,105,110,101,32,70,73,76,76,95,82,65,78,71,69,83,95,71,82,79,85,80,69,68,95,70,73,76,76,95,67,79,85,78,84,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,32,32,52,117,10,10,108,97,121,111,117,116,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,54,52,41,32,105,110,59,10,10,108,97,121,111,117,116,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,53,41,32,117,110,105,102,111,114,109,32,98,85,110,105,102,111,114,109,32,123,10,32,32,32,32,105,118,101,99,50,32,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,59,10,32,32,32,32,105,118,101,99,50,32,117,80,97,100,48,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,70,105,108,108,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,102,114,111,109,44,32,91,49,93,58,32,116,111,44,32,91,50,93,58,32,110,101,120,116,32,102,105,108,108,32,73,68,10,32,32,32,32,117,105,110,116,32,105,70,105,108,108,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,110,101,120,116,32,116,105,108,101,32,73,68,10,32,32,32,32,47,47,32,91,49,93,58,32,102,105,114,115,116,32,102,105,108,108,32,73,68,10,32,32,32,32,47,47,32,91,50,93,58,32,98,97,99,107,100,114,111,112,32,100,101,108,116,97,32,117,112,112,101,114,32,56,32,98,105,116,115,44,32,97,108,112,104,97,32,116,105,108,101,32,73,68,32,108,111,119,101,114,32,50,52,10,32,32,32,32,47,47,32,91,51,93,58,32,99,111,108,111,114,47,99,116,114,108,47,98,97,99,107,100,114,111,112,32,119,111,114,100,10,32,32,32,32,117,105,110,116,32,105,84,105,108,101,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,65,108,112,104,97,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,97,108,112,104,97,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,47,47,32,91,49,93,58,32,99,108,105,112,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,117,105,110,116,32,105,65,108,112,104,97,84,105,108,101,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,98,117,102,102,101,114,32,98,71,114,111,117,112,101,100,70,105,108,108,115,32,123,10,32,32,32,32,47,47,32,120,58,32,102,114,111,109,44,32,121,58,32,116,111,10,32,32,32,32,117,118,101,99,50,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,52,41,32,114,101,115,116,114,105,99,116,32,98,117,102,102,101,114,32,98,70,105,108,108,82,97,110,103,101,115,32,123,10,32,32,32,32,117,105,110,116,32,105,70,105,108,108,82,97,110,103,101,115,91,93,59,10,125,59,10,10,47,47,47,32,67,111,112,121,32,116,104,101,32,102,105,108,108,32,108,105,115,116,32,111,102,32,101,97,99,104,32,97,108,112,104,97,32,116,105,108,101,32,105,110,116,111,32,97,32,99,111,110,116,105,103,117,111,117,115,32,114,97,110,103,101,44,32,107,101,101,112,105,110,103,32,116,104,101,32,108,105,115,116,32,111,114,100,101,114,46,10,118,111,105,100,32,109,97,105,110,40,41,32,123,10,32,32,32,32,117,105,110,116,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,105,102,32,40,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,61,32,117,105,110,116,40,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,121,32,45,32,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,120,41,41,32,114,101,116,117,114,110,59,10,10,32,32,32,32,117,105,110,116,32,116,105,108,101,73,110,100,101,120,32,61,32,105,65,108,112,104,97,84,105,108,101,115,91,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,59,10,32,32,32,32,105,110,116,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,32,61,32,105,110,116,40,105,84,105,108,101,115,91,116,105,108,101,73,110,100,101,120,32,42,32,52,117,32,43,32,84,73,76,69,95,70,73,69,76,68,95,70,73,82,83,84,95,70,73,76,76,95,73,68,93,41,59,10,10,32,32,32,32,117,105,110,116,32,102,105,108,108,67,111,117,110,116,32,61,32,48,117,59,10,32,32,32,32,102,111,114,32,40,105,110,116,32,102,105,108,108,73,110,100,101,120,32,61,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,59,32,102,105,108,108,73,110,100,101,120,32,62,61,32,48,32,38,38,32,102,105,108,108,67,111,117,110,116,32,60,32,77,65,88,95,70,73,76,76,95,73,84,69,82,65,84,73,79,78,83,59,32,102,105,108,108,67,111,117,110,116,43,43,41,32,123,10,32,32,32,32,32,32,32,32,102,105,108,108,73,110,100,101,120,32,61,32,105,110,116,40,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,50,93,41,59,10,32,32,32,32,125,10,10,32,32,32,32,117,105,110,116,32,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,32,61,32,48,117,59,10,32,32,32,32,105,102,32,40,102,105,108,108,67,111,117,110,116,32,62,32,48,117,41,32,123,10,32,32,32,32,32,32,32,32,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,32,61,32,97,116,111,109,105,99,65,100,100,40,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,71,82,79,85,80,69,68,95,70,73,76,76,95,67,79,85,78,84,93,44,32,102,105,108,108,67,111,117,110,116,41,59,10,10,32,32,32,32,32,32,32,32,105,110,116,32,102,105,108,108,73,110,100,101,120,32,61,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,102,105,108,108,67,111,117,110,116,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,32,43,32,105,93,32,61,32,117,118,101,99,50,40,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,48,93,44,32,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,49,93,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,102,105,108,108,73,110,100,101,120,32,61,32,105,110,116,40,105,70,105,108,108,115,91,102,105,108,108,73,110,100,101,120,32,42,32,51,32,43,32,50,93,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,32,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,32,61,32,103,114,111,117,112,101,100,70,105,108,108,73,110,100,101,120,59,10,32,32,32,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,49,117,93,32,61,32,102,105,108,108,67,111,117,110,116,59,10,125,10};
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+namespace Pathfinder {
+    static uint8_t fill_grouped_comp_shdbin[] = {83,72,68,66,1,0,0,0,1,4,0,0,0,5,0,0,0,2,4,0,0,0,165,24,0,0,109,97,105,110,47,47,66,73,78,68,73,78,71,95,83,84,65,82,84,10,47,47,84,69,88,58,117,65,114,101,97,76,85,84,58,52,10,47,47,85,66,79,58,98,85,110,105,102,111,114,109,58,53,10,47,47,66,73,78,68,73,78,71,95,69,78,68,10,35,118,101,114,115,105,111,110,32,52,53,48,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,115,97,109,112,108,101,114,50,68,59,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,105,109,97,103,101,50,68,59,10,10,108,97,121,111,117,116,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,54,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,52,41,32,105,110,59,10,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,78,69,88,84,95,84,73,76,69,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,70,73,82,83,84,95,70,73,76,76,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,49,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,66,65,67,75,68,82,79,80,95,65,76,80,72,65,95,84,73,76,69,95,73,68,32,32,32,50,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,67,79,78,84,82,79,76,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,51,117,10,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,77,65,83,75,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,51,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,87,73,78,68,73,78,71,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,49,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,69,86,69,78,95,79,68,68,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,50,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,48,95,83,72,73,70,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,10,10,35,100,101,102,105,110,101,32,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,32,32,52,117,10,10,47,47,32,79,110,101,32,102,105,108,108,32,112,101,114,32,105,110,118,111,99,97,116,105,111,110,32,105,115,32,108,111,97,100,101,100,32,105,110,116,111,32,115,104,97,114,101,100,32,109,101,109,111,114,121,32,97,116,32,97,32,116,105,109,101,46,10,35,100,101,102,105,110,101,32,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,54,52,117,10,10,47,47,32,78,111,32,115,105,109,117,108,116,97,110,101,111,117,115,32,105,109,97,103,101,32,82,69,65,68,32,38,32,87,82,73,84,69,32,102,111,114,32,71,76,69,83,46,10,35,105,102,100,101,102,32,71,76,95,69,83,10,119,114,105,116,101,111,110,108,121,32,108,97,121,111,117,116,40,114,103,98,97,56,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,117,68,101,115,116,59,10,35,101,108,115,101,10,108,97,121,111,117,116,40,114,103,98,97,56,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,117,68,101,115,116,59,10,35,101,110,100,105,102,10,10,108,97,121,111,117,116,40,98,105,110,100,105,110,103,32,61,32,52,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,117,65,114,101,97,76,85,84,59,10,10,108,97,121,111,117,116,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,53,41,32,117,110,105,102,111,114,109,32,98,85,110,105,102,111,114,109,32,123,10,32,32,32,32,105,118,101,99,50,32,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,59,10,32,32,32,32,105,118,101,99,50,32,117,80,97,100,48,59,10,125,59,10,10,47,47,32,70,105,108,108,115,32,103,114,111,117,112,101,100,32,98,121,32,102,105,108,108,95,103,114,111,117,112,46,99,111,109,112,46,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,98,117,102,102,101,114,32,98,71,114,111,117,112,101,100,70,105,108,108,115,32,123,10,32,32,32,32,47,47,32,120,58,32,102,114,111,109,44,32,121,58,32,116,111,10,32,32,32,32,117,118,101,99,50,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,93,59,10,125,59,10,10,47,47,32,112,114,111,112,97,103,97,116,101,95,109,101,116,97,100,97,116,97,95,98,117,102,102,101,114,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,98,117,102,102,101,114,32,98,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,112,97,116,104,32,73,68,10,32,32,32,32,47,47,32,91,49,93,58,32,110,101,120,116,32,116,105,108,101,32,73,68,10,32,32,32,32,47,47,32,91,50,93,58,32,102,105,114,115,116,32,102,105,108,108,32,73,68,10,32,32,32,32,47,47,32,91,51,93,58,32,98,97,99,107,100,114,111,112,32,100,101,108,116,97,32,117,112,112,101,114,32,56,32,98,105,116,115,44,32,97,108,112,104,97,32,116,105,108,101,32,73,68,32,108,111,119,101,114,32,50,52,32,98,105,116,115,10,32,32,32,32,47,47,32,91,52,93,58,32,99,111,108,111,114,47,99,116,114,108,47,98,97,99,107,100,114,111,112,32,119,111,114,100,10,32,32,32,32,117,105,110,116,32,105,84,105,108,101,115,91,93,59,10,125,59,10,10,47,47,32,122,95,98,117,102,102,101,114,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,98,117,102,102,101,114,32,98,65,108,112,104,97,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,97,108,112,104,97,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,47,47,32,91,49,93,58,32,99,108,105,112,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,117,105,110,116,32,105,65,108,112,104,97,84,105,108,101,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,54,41,32,98,117,102,102,101,114,32,98,70,105,108,108,82,97,110,103,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,103,114,111,117,112,101,100,32,102,105,108,108,32,99,111,117,110,116,10,32,32,32,32,47,47,32,91,52,46,46,93,58,32,102,105,114,115,116,32,103,114,111,117,112,101,100,32,102,105,108,108,32,97,110,100,32,102,105,108,108,32,99,111,117,110,116,32,111,102,32,101,97,99,104,32,97,108,112,104,97,32,116,105,108,101,10,32,32,32,32,117,105,110,116,32,105,70,105,108,108,82,97,110,103,101,115,91,93,59,10,125,59,10,10,115,104,97,114,101,100,32,118,101,99,52,32,115,70,105,108,108,115,91,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,93,59,10,10,118,101,99,52,32,99,111,109,112,117,116,101,67,111,118,101,114,97,103,101,40,118,101,99,50,32,102,114,111,109,44,32,118,101,99,50,32,116,111,44,32,115,97,109,112,108,101,114,50,68,32,97,114,101,97,76,85,84,41,32,123,10,32,32,32,32,47,47,32,68,101,116,101,114,109,105,110,101,32,119,105,110,100,105,110,103,44,32,97,110,100,32,115,111,114,116,32,105,110,116,111,32,97,32,99,111,110,115,105,115,116,101,110,116,32,111,114,100,101,114,32,115,111,32,119,101,32,111,110,108,121,32,110,101,101,100,32,116,111,32,102,105,110,100,32,111,110,101,32,114,111,111,116,32,98,101,108,111,119,46,10,32,32,32,32,118,101,99,50,32,108,101,102,116,32,61,32,102,114,111,109,46,120,32,60,32,116,111,46,120,32,63,32,102,114,111,109,32,58,32,116,111,44,32,114,105,103,104,116,32,61,32,102,114,111,109,46,120,32,60,32,116,111,46,120,32,63,32,116,111,32,58,32,102,114,111,109,59,10,10,32,32,32,32,47,47,32,83,104,111,111,116,32,97,32,118,101,114,116,105,99,97,108,32,114,97,121,32,116,111,119,97,114,100,32,116,104,101,32,99,117,114,118,101,46,10,32,32,32,32,118,101,99,50,32,119,105,110,100,111,119,32,61,32,99,108,97,109,112,40,118,101,99,50,40,102,114,111,109,46,120,44,32,116,111,46,120,41,44,32,45,48,46,53,44,32,48,46,53,41,59,10,32,32,32,32,102,108,111,97,116,32,111,102,102,115,101,116,32,61,32,109,105,120,40,119,105,110,100,111,119,46,120,44,32,119,105,110,100,111,119,46,121,44,32,48,46,53,41,32,45,32,108,101,102,116,46,120,59,10,10,32,32,32,32,47,47,32,79,110,45,115,101,103,109,101,110,116,32,99,111,111,114,100,105,110,97,116,101,46,10,32,32,32,32,102,108,111,97,116,32,116,32,61,32,111,102,102,115,101,116,32,47,32,40,114,105,103,104,116,46,120,32,45,32,108,101,102,116,46,120,41,59,10,10,32,32,32,32,47,47,32,67,111,109,112,117,116,101,32,112,111,115,105,116,105,111,110,32,97,110,100,32,100,101,114,105,118,97,116,105,118,101,32,116,111,32,102,111,114,109,32,97,32,108,105,110,101,32,97,112,112,114,111,120,105,109,97,116,105,111,110,46,10,32,32,32,32,102,108,111,97,116,32,121,32,61,32,109,105,120,40,108,101,102,116,46,121,44,32,114,105,103,104,116,46,121,44,32,116,41,59,32,47,47,32,67,72,89,58,32,121,32,112,111,115,105,116,105,111,110,32,99,97,108,99,117,108,97,116,101,100,32,102,114,111,109,32,116,46,10,32,32,32,32,102,108,111,97,116,32,100,32,61,32,40,114,105,103,104,116,46,121,32,45,32,108,101,102,116,46,121,41,32,47,32,40,114,105,103,104,116,46,120,32,45,32,108,101,102,116,46,120,41,59,32,47,47,32,67,72,89,58,32,68,101,114,105,118,97,116,105,118,101,32,111,102,32,116,104,101,32,115,101,103,109,101,110,116,46,10,10,32,32,32,32,47,47,32,76,111,111,107,32,117,112,32,97,114,101,97,32,117,110,100,101,114,32,116,104,97,116,32,108,105,110,101,44,32,97,110,100,32,115,99,97,108,101,32,104,111,114,105,122,111,110,116,97,108,108,121,32,116,111,32,116,104,101,32,119,105,110,100,111,119,32,115,105,122,101,46,10,32,32,32,32,102,108,111,97,116,32,100,88,32,61,32,119,105,110,100,111,119,46,120,32,45,32,119,105,110,100,111,119,46,121,59,10,10,32,32,32,32,47,47,32,82,101,116,117,114,110,32,116,104,101,32,99,111,108,111,114,32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,99,32,112,111,115,105,116,105,111,110,32,105,110,32,116,101,120,116,117,114,101,32,97,114,101,97,76,85,84,46,10,32,32,32,32,114,101,116,117,114,110,32,116,101,120,116,117,114,101,40,97,114,101,97,76,85,84,44,32,118,101,99,50,40,121,32,43,32,56,46,48,44,32,97,98,115,40,100,32,42,32,100,88,41,41,32,47,32,49,54,46,48,41,32,42,32,100,88,59,10,125,10,10,47,47,32,84,104,101,32,119,104,111,108,101,32,119,111,114,107,103,114,111,117,112,32,119,111,114,107,115,32,111,110,32,116,104,101,32,115,97,109,101,32,97,108,112,104,97,32,116,105,108,101,44,32,115,111,32,105,116,32,108,111,97,100,115,32,116,104,101,32,116,105,108,101,39,115,32,102,105,108,108,115,32,116,111,103,101,116,104,101,114,46,10,118,101,99,52,32,97,99,99,117,109,117,108,97,116,101,67,111,118,101,114,97,103,101,70,111,114,70,105,108,108,82,97,110,103,101,40,117,105,110,116,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,44,32,117,105,110,116,32,102,105,108,108,67,111,117,110,116,44,32,105,118,101,99,50,32,116,105,108,101,83,117,98,67,111,111,114,100,41,32,123,10,32,32,32,32,118,101,99,50,32,116,105,108,101,70,114,97,103,67,111,111,114,100,32,61,32,118,101,99,50,40,116,105,108,101,83,117,98,67,111,111,114,100,41,32,43,32,118,101,99,50,40,48,46,53,41,59,10,10,32,32,32,32,118,101,99,52,32,99,111,118,101,114,97,103,101,115,32,61,32,118,101,99,52,40,48,46,48,41,59,10,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,99,104,117,110,107,83,116,97,114,116,32,61,32,48,117,59,32,99,104,117,110,107,83,116,97,114,116,32,60,32,102,105,108,108,67,111,117,110,116,59,32,99,104,117,110,107,83,116,97,114,116,32,43,61,32,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,41,32,123,10,32,32,32,32,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,105,122,101,32,61,32,109,105,110,40,102,105,108,108,67,111,117,110,116,32,45,32,99,104,117,110,107,83,116,97,114,116,44,32,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,41,59,10,10,32,32,32,32,32,32,32,32,105,102,32,40,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,110,100,101,120,32,60,32,99,104,117,110,107,83,105,122,101,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,117,118,101,99,50,32,102,105,108,108,32,61,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,102,105,114,115,116,70,105,108,108,73,110,100,101,120,32,43,32,99,104,117,110,107,83,116,97,114,116,32,43,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,110,100,101,120,93,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,80,97,99,107,58,32,108,105,110,101,83,101,103,109,101,110,116,32,61,32,118,101,99,52,40,102,114,111,109,46,120,44,32,102,114,111,109,46,121,44,32,116,111,46,120,44,32,116,111,46,121,41,46,10,32,32,32,32,32,32,32,32,32,32,32,32,115,70,105,108,108,115,91,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,110,100,101,120,93,32,61,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,52,40,102,105,108,108,46,120,32,38,32,48,120,102,102,102,102,117,44,32,102,105,108,108,46,120,32,62,62,32,49,54,44,32,102,105,108,108,46,121,32,38,32,48,120,102,102,102,102,117,44,32,102,105,108,108,46,121,32,62,62,32,49,54,41,32,47,32,50,53,54,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,99,104,117,110,107,83,105,122,101,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,67,111,110,118,101,114,116,32,116,111,32,116,105,108,101,39,115,32,108,111,99,97,108,32,99,111,111,114,100,105,110,97,116,101,115,46,10,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,52,32,108,105,110,101,83,101,103,109,101,110,116,32,61,32,115,70,105,108,108,115,91,105,93,32,45,32,116,105,108,101,70,114,97,103,67,111,111,114,100,46,120,121,120,121,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,43,61,32,99,111,109,112,117,116,101,67,111,118,101,114,97,103,101,40,108,105,110,101,83,101,103,109,101,110,116,46,120,121,44,32,108,105,110,101,83,101,103,109,101,110,116,46,122,119,44,32,117,65,114,101,97,76,85,84,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,32,32,32,32,125,10,10,32,32,32,32,114,101,116,117,114,110,32,99,111,118,101,114,97,103,101,115,59,10,125,10,10,105,118,101,99,50,32,99,111,109,112,117,116,101,84,105,108,101,67,111,111,114,100,40,117,105,110,116,32,97,108,112,104,97,84,105,108,101,73,110,100,101,120,41,32,123,10,32,32,32,32,117,105,110,116,32,120,32,61,32,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,38,32,48,120,102,102,117,59,10,32,32,32,32,117,105,110,116,32,121,32,61,32,40,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,62,32,56,117,41,32,38,32,48,120,102,102,117,41,32,124,32,40,40,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,62,32,49,54,117,41,32,38,32,48,120,102,102,117,41,32,60,60,32,56,117,41,59,10,32,32,32,32,114,101,116,117,114,110,32,105,118,101,99,50,40,49,54,44,32,52,41,32,42,32,105,118,101,99,50,40,120,44,32,121,41,32,43,32,105,118,101,99,50,40,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,10,125,10,10,47,47,47,32,70,105,108,108,32,97,108,112,104,97,32,116,105,108,101,115,46,32,83,97,109,101,32,97,115,32,102,105,108,108,46,99,111,109,112,44,32,98,117,116,32,114,101,97,100,115,32,116,104,101,32,102,105,108,108,115,32,103,114,111,117,112,101,100,32,112,101,114,32,97,108,112,104,97,32,116,105,108,101,46,10,118,111,105,100,32,109,97,105,110,40,41,32,123,10,32,32,32,32,47,47,32,76,111,99,97,108,32,99,111,111,114,100,105,110,97,116,101,115,32,111,117,116,32,111,102,32,108,111,99,97,108,32,115,105,122,101,32,40,49,54,44,32,52,41,32,42,32,105,118,101,99,50,40,49,44,32,52,41,46,10,32,32,32,32,105,118,101,99,50,32,116,105,108,101,83,117,98,67,111,111,114,100,32,61,32,105,118,101,99,50,40,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,32,42,32,105,118,101,99,50,40,49,44,32,52,41,59,10,10,32,32,32,32,47,47,32,84,104,105,115,32,105,115,32,97,32,119,111,114,107,97,114,111,117,110,100,32,102,111,114,32,116,104,101,32,54,52,75,32,119,111,114,107,103,114,111,117,112,32,100,105,115,112,97,116,99,104,32,108,105,109,105,116,32,105,110,32,79,112,101,110,71,76,46,10,32,32,32,32,117,105,110,116,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,61,32,40,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,120,32,124,32,40,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,121,32,60,60,32,49,53,41,41,59,10,10,32,32,32,32,117,105,110,116,32,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,61,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,43,32,117,105,110,116,40,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,120,41,59,10,32,32,32,32,105,102,32,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,61,32,117,105,110,116,40,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,121,41,41,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,10,10,32,32,32,32,117,105,110,116,32,116,105,108,101,73,110,100,101,120,32,61,32,105,65,108,112,104,97,84,105,108,101,115,91,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,59,10,10,32,32,32,32,47,47,32,124,63,40,56,98,105,116,41,124,120,40,50,52,98,105,116,41,124,32,45,62,32,124,48,40,56,98,105,116,41,124,120,40,50,52,98,105,116,41,124,10,32,32,32,32,47,47,32,67,111,109,109,101,110,116,101,100,32,116,111,32,102,105,120,32,97,114,116,105,102,97,99,116,115,32,105,110,32,79,112,101,110,71,76,46,10,32,32,32,32,47,47,105,102,32,40,40,105,110,116,40,105,84,105,108,101,115,91,116,105,108,101,73,110,100,101,120,32,42,32,52,117,32,43,32,84,73,76,69,95,70,73,69,76,68,95,66,65,67,75,68,82,79,80,95,65,76,80,72,65,95,84,73,76,69,95,73,68,93,32,60,60,32,56,41,32,62,62,32,56,41,32,60,32,48,41,10,32,32,32,32,47,47,32,32,32,32,114,101,116,117,114,110,59,10,10,32,32,32,32,117,105,110,116,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,32,61,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,59,10,32,32,32,32,117,105,110,116,32,102,105,108,108,67,111,117,110,116,32,61,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,49,117,93,59,10,32,32,32,32,117,105,110,116,32,116,105,108,101,67,111,110,116,114,111,108,87,111,114,100,32,61,32,105,84,105,108,101,115,91,116,105,108,101,73,110,100,101,120,32,42,32,52,117,32,43,32,84,73,76,69,95,70,73,69,76,68,95,67,79,78,84,82,79,76,93,59,10,32,32,32,32,105,110,116,32,98,97,99,107,100,114,111,112,32,61,32,105,110,116,40,116,105,108,101,67,111,110,116,114,111,108,87,111,114,100,41,32,62,62,32,50,52,59,10,10,32,32,32,32,118,101,99,52,32,99,111,118,101,114,97,103,101,115,32,61,32,118,101,99,52,40,98,97,99,107,100,114,111,112,41,59,10,32,32,32,32,99,111,118,101,114,97,103,101,115,32,43,61,32,97,99,99,117,109,117,108,97,116,101,67,111,118,101,114,97,103,101,70,111,114,70,105,108,108,82,97,110,103,101,40,102,105,114,115,116,70,105,108,108,73,110,100,101,120,44,32,102,105,108,108,67,111,117,110,116,44,32,116,105,108,101,83,117,98,67,111,111,114,100,41,59,10,10,32,32,32,32,105,110,116,32,116,105,108,101,67,116,114,108,32,61,32,105,110,116,40,40,116,105,108,101,67,111,110,116,114,111,108,87,111,114,100,32,62,62,32,49,54,41,32,38,32,48,120,102,102,117,41,59,10,32,32,32,32,105,110,116,32,109,97,115,107,67,116,114,108,32,61,32,40,116,105,108,101,67,116,114,108,32,62,62,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,48,95,83,72,73,70,84,41,32,38,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,77,65,83,75,59,10,32,32,32,32,105,102,32,40,40,109,97,115,107,67,116,114,108,32,38,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,87,73,78,68,73,78,71,41,32,33,61,32,48,41,32,123,10,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,61,32,99,108,97,109,112,40,97,98,115,40,99,111,118,101,114,97,103,101,115,41,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,32,101,108,115,101,32,123,10,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,61,32,99,108,97,109,112,40,49,46,48,32,45,32,97,98,115,40,49,46,48,32,45,32,109,111,100,40,99,111,118,101,114,97,103,101,115,44,32,50,46,48,41,41,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,10,32,32,32,32,47,47,32,78,111,116,32,97,118,97,105,108,97,98,108,101,32,102,111,114,32,71,76,69,83,46,10,32,32,32,32,35,105,102,110,100,101,102,32,71,76,95,69,83,10,32,32,32,32,47,47,32,72,97,110,100,108,101,32,99,108,105,112,32,105,102,32,110,101,99,101,115,115,97,114,121,46,10,10,32,32,32,32,47,47,32,99,108,105,112,84,105,108,101,73,110,100,101,120,32,115,104,111,117,108,100,32,98,101,32,99,111,110,118,101,114,116,101,100,32,116,111,32,105,110,116,32,102,105,114,115,116,44,32,97,115,32,105,116,32,109,105,103,104,116,32,98,101,32,110,101,103,97,116,105,118,101,46,10,32,32,32,32,105,110,116,32,99,108,105,112,84,105,108,101,73,110,100,101,120,32,61,32,105,110,116,40,105,65,108,112,104,97,84,105,108,101,115,91,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,49,117,93,41,59,10,32,32,32,32,105,102,32,40,99,108,105,112,84,105,108,101,73,110,100,101,120,32,62,61,32,48,41,32,123,10,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,61,32,109,105,110,40,99,111,118,101,114,97,103,101,115,44,32,105,109,97,103,101,76,111,97,100,40,117,68,101,115,116,44,32,99,111,109,112,117,116,101,84,105,108,101,67,111,111,114,100,40,117,105,110,116,40,99,108,105,112,84,105,108,101,73,110,100,101,120,41,41,41,41,59,10,32,32,32,32,125,10,32,32,32,32,35,101,110,100,105,102,10,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,117,68,101,115,116,44,32,99,111,109,112,117,116,101,84,105,108,101,67,111,111,114,100,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,41,44,32,99,111,118,101,114,97,103,101,115,41,59,10,125,10,83,72,68,66,1,0,0,0,4,3,0,0,0,1,0,0,0,2,4,0,0,0,168,24,0,0,109,97,105,110,47,47,66,73,78,68,73,78,71,95,83,84,65,82,84,10,47,47,84,69,88,58,117,65,114,101,97,76,85,84,58,52,10,47,47,85,66,79,58,98,85,110,105,102,111,114,109,58,53,10,47,47,66,73,78,68,73,78,71,95,69,78,68,10,35,118,101,114,115,105,111,110,32,51,49,48,32,101,115,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,115,97,109,112,108,101,114,50,68,59,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,105,109,97,103,101,50,68,59,10,10,108,97,121,111,117,116,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,49,54,44,32,108,111,99,97,108,95,115,105,122,101,95,121,32,61,32,52,41,32,105,110,59,10,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,78,69,88,84,95,84,73,76,69,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,70,73,82,83,84,95,70,73,76,76,95,73,68,32,32,32,32,32,32,32,32,32,32,32,32,49,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,66,65,67,75,68,82,79,80,95,65,76,80,72,65,95,84,73,76,69,95,73,68,32,32,32,50,117,10,35,100,101,102,105,110,101,32,84,73,76,69,95,70,73,69,76,68,95,67,79,78,84,82,79,76,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,51,117,10,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,77,65,83,75,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,51,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,87,73,78,68,73,78,71,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,49,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,69,86,69,78,95,79,68,68,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,120,50,10,35,100,101,102,105,110,101,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,48,95,83,72,73,70,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,10,10,35,100,101,102,105,110,101,32,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,32,32,52,117,10,10,47,47,32,79,110,101,32,102,105,108,108,32,112,101,114,32,105,110,118,111,99,97,116,105,111,110,32,105,115,32,108,111,97,100,101,100,32,105,110,116,111,32,115,104,97,114,101,100,32,109,101,109,111,114,121,32,97,116,32,97,32,116,105,109,101,46,10,35,100,101,102,105,110,101,32,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,54,52,117,10,10,47,47,32,78,111,32,115,105,109,117,108,116,97,110,101,111,117,115,32,105,109,97,103,101,32,82,69,65,68,32,38,32,87,82,73,84,69,32,102,111,114,32,71,76,69,83,46,10,35,105,102,100,101,102,32,71,76,95,69,83,10,119,114,105,116,101,111,110,108,121,32,108,97,121,111,117,116,40,114,103,98,97,56,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,117,68,101,115,116,59,10,35,101,108,115,101,10,108,97,121,111,117,116,40,114,103,98,97,56,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,117,110,105,102,111,114,109,32,105,109,97,103,101,50,68,32,117,68,101,115,116,59,10,35,101,110,100,105,102,10,10,108,97,121,111,117,116,40,98,105,110,100,105,110,103,32,61,32,52,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,117,65,114,101,97,76,85,84,59,10,10,108,97,121,111,117,116,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,53,41,32,117,110,105,102,111,114,109,32,98,85,110,105,102,111,114,109,32,123,10,32,32,32,32,105,118,101,99,50,32,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,59,10,32,32,32,32,105,118,101,99,50,32,117,80,97,100,48,59,10,125,59,10,10,47,47,32,70,105,108,108,115,32,103,114,111,117,112,101,100,32,98,121,32,102,105,108,108,95,103,114,111,117,112,46,99,111,109,112,46,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,71,114,111,117,112,101,100,70,105,108,108,115,32,123,10,32,32,32,32,47,47,32,120,58,32,102,114,111,109,44,32,121,58,32,116,111,10,32,32,32,32,117,118,101,99,50,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,93,59,10,125,59,10,10,47,47,32,112,114,111,112,97,103,97,116,101,95,109,101,116,97,100,97,116,97,95,98,117,102,102,101,114,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,112,97,116,104,32,73,68,10,32,32,32,32,47,47,32,91,49,93,58,32,110,101,120,116,32,116,105,108,101,32,73,68,10,32,32,32,32,47,47,32,91,50,93,58,32,102,105,114,115,116,32,102,105,108,108,32,73,68,10,32,32,32,32,47,47,32,91,51,93,58,32,98,97,99,107,100,114,111,112,32,100,101,108,116,97,32,117,112,112,101,114,32,56,32,98,105,116,115,44,32,97,108,112,104,97,32,116,105,108,101,32,73,68,32,108,111,119,101,114,32,50,52,32,98,105,116,115,10,32,32,32,32,47,47,32,91,52,93,58,32,99,111,108,111,114,47,99,116,114,108,47,98,97,99,107,100,114,111,112,32,119,111,114,100,10,32,32,32,32,117,105,110,116,32,105,84,105,108,101,115,91,93,59,10,125,59,10,10,47,47,32,122,95,98,117,102,102,101,114,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,65,108,112,104,97,84,105,108,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,97,108,112,104,97,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,47,47,32,91,49,93,58,32,99,108,105,112,32,116,105,108,101,32,105,110,100,101,120,10,32,32,32,32,117,105,110,116,32,105,65,108,112,104,97,84,105,108,101,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,54,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,70,105,108,108,82,97,110,103,101,115,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,103,114,111,117,112,101,100,32,102,105,108,108,32,99,111,117,110,116,10,32,32,32,32,47,47,32,91,52,46,46,93,58,32,102,105,114,115,116,32,103,114,111,117,112,101,100,32,102,105,108,108,32,97,110,100,32,102,105,108,108,32,99,111,117,110,116,32,111,102,32,101,97,99,104,32,97,108,112,104,97,32,116,105,108,101,10,32,32,32,32,117,105,110,116,32,105,70,105,108,108,82,97,110,103,101,115,91,93,59,10,125,59,10,10,115,104,97,114,101,100,32,118,101,99,52,32,115,70,105,108,108,115,91,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,93,59,10,10,118,101,99,52,32,99,111,109,112,117,116,101,67,111,118,101,114,97,103,101,40,118,101,99,50,32,102,114,111,109,44,32,118,101,99,50,32,116,111,44,32,115,97,109,112,108,101,114,50,68,32,97,114,101,97,76,85,84,41,32,123,10,32,32,32,32,47,47,32,68,101,116,101,114,109,105,110,101,32,119,105,110,100,105,110,103,44,32,97,110,100,32,115,111,114,116,32,105,110,116,111,32,97,32,99,111,110,115,105,115,116,101,110,116,32,111,114,100,101,114,32,115,111,32,119,101,32,111,110,108,121,32,110,101,101,100,32,116,111,32,102,105,110,100,32,111,110,101,32,114,111,111,116,32,98,101,108,111,119,46,10,32,32,32,32,118,101,99,50,32,108,101,102,116,32,61,32,102,114,111,109,46,120,32,60,32,116,111,46,120,32,63,32,102,114,111,109,32,58,32,116,111,44,32,114,105,103,104,116,32,61,32,102,114,111,109,46,120,32,60,32,116,111,46,120,32,63,32,116,111,32,58,32,102,114,111,109,59,10,10,32,32,32,32,47,47,32,83,104,111,111,116,32,97,32,118,101,114,116,105,99,97,108,32,114,97,121,32,116,111,119,97,114,100,32,116,104,101,32,99,117,114,118,101,46,10,32,32,32,32,118,101,99,50,32,119,105,110,100,111,119,32,61,32,99,108,97,109,112,40,118,101,99,50,40,102,114,111,109,46,120,44,32,116,111,46,120,41,44,32,45,48,46,53,44,32,48,46,53,41,59,10,32,32,32,32,102,108,111,97,116,32,111,102,102,115,101,116,32,61,32,109,105,120,40,119,105,110,100,111,119,46,120,44,32,119,105,110,100,111,119,46,121,44,32,48,46,53,41,32,45,32,108,101,102,116,46,120,59,10,10,32,32,32,32,47,47,32,79,110,45,115,101,103,109,101,110,116,32,99,111,111,114,100,105,110,97,116,101,46,10,32,32,32,32,102,108,111,97,116,32,116,32,61,32,111,102,102,115,101,116,32,47,32,40,114,105,103,104,116,46,120,32,45,32,108,101,102,116,46,120,41,59,10,10,32,32,32,32,47,47,32,67,111,109,112,117,116,101,32,112,111,115,105,116,105,111,110,32,97,110,100,32,100,101,114,105,118,97,116,105,118,101,32,116,111,32,102,111,114,109,32,97,32,108,105,110,101,32,97,112,112,114,111,120,105,109,97,116,105,111,110,46,10,32,32,32,32,102,108,111,97,116,32,121,32,61,32,109,105,120,40,108,101,102,116,46,121,44,32,114,105,103,104,116,46,121,44,32,116,41,59,32,47,47,32,67,72,89,58,32,121,32,112,111,115,105,116,105,111,110,32,99,97,108,99,117,108,97,116,101,100,32,102,114,111,109,32,116,46,10,32,32,32,32,102,108,111,97,116,32,100,32,61,32,40,114,105,103,104,116,46,121,32,45,32,108,101,102,116,46,121,41,32,47,32,40,114,105,103,104,116,46,120,32,45,32,108,101,102,116,46,120,41,59,32,47,47,32,67,72,89,58,32,68,101,114,105,118,97,116,105,118,101,32,111,102,32,116,104,101,32,115,101,103,109,101,110,116,46,10,10,32,32,32,32,47,47,32,76,111,111,107,32,117,112,32,97,114,101,97,32,117,110,100,101,114,32,116,104,97,116,32,108,105,110,101,44,32,97,110,100,32,115,99,97,108,101,32,104,111,114,105,122,111,110,116,97,108,108,121,32,116,111,32,116,104,101,32,119,105,110,100,111,119,32,115,105,122,101,46,10,32,32,32,32,102,108,111,97,116,32,100,88,32,61,32,119,105,110,100,111,119,46,120,32,45,32,119,105,110,100,111,119,46,121,59,10,10,32,32,32,32,47,47,32,82,101,116,117,114,110,32,116,104,101,32,99,111,108,111,114,32,97,116,32,116,104,101,32,115,112,101,99,105,102,105,99,32,112,111,115,105,116,105,111,110,32,105,110,32,116,101,120,116,117,114,101,32,97,114,101,97,76,85,84,46,10,32,32,32,32,114,101,116,117,114,110,32,116,101,120,116,117,114,101,40,97,114,101,97,76,85,84,44,32,118,101,99,50,40,121,32,43,32,56,46,48,44,32,97,98,115,40,100,32,42,32,100,88,41,41,32,47,32,49,54,46,48,41,32,42,32,100,88,59,10,125,10,10,47,47,32,84,104,101,32,119,104,111,108,101,32,119,111,114,107,103,114,111,117,112,32,119,111,114,107,115,32,111,110,32,116,104,101,32,115,97,109,101,32,97,108,112,104,97,32,116,105,108,101,44,32,115,111,32,105,116,32,108,111,97,100,115,32,116,104,101,32,116,105,108,101,39,115,32,102,105,108,108,115,32,116,111,103,101,116,104,101,114,46,10,118,101,99,52,32,97,99,99,117,109,117,108,97,116,101,67,111,118,101,114,97,103,101,70,111,114,70,105,108,108,82,97,110,103,101,40,117,105,110,116,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,44,32,117,105,110,116,32,102,105,108,108,67,111,117,110,116,44,32,105,118,101,99,50,32,116,105,108,101,83,117,98,67,111,111,114,100,41,32,123,10,32,32,32,32,118,101,99,50,32,116,105,108,101,70,114,97,103,67,111,111,114,100,32,61,32,118,101,99,50,40,116,105,108,101,83,117,98,67,111,111,114,100,41,32,43,32,118,101,99,50,40,48,46,53,41,59,10,10,32,32,32,32,118,101,99,52,32,99,111,118,101,114,97,103,101,115,32,61,32,118,101,99,52,40,48,46,48,41,59,10,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,99,104,117,110,107,83,116,97,114,116,32,61,32,48,117,59,32,99,104,117,110,107,83,116,97,114,116,32,60,32,102,105,108,108,67,111,117,110,116,59,32,99,104,117,110,107,83,116,97,114,116,32,43,61,32,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,41,32,123,10,32,32,32,32,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,105,122,101,32,61,32,109,105,110,40,102,105,108,108,67,111,117,110,116,32,45,32,99,104,117,110,107,83,116,97,114,116,44,32,70,73,76,76,95,67,72,85,78,75,95,83,73,90,69,41,59,10,10,32,32,32,32,32,32,32,32,105,102,32,40,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,110,100,101,120,32,60,32,99,104,117,110,107,83,105,122,101,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,117,118,101,99,50,32,102,105,108,108,32,61,32,105,71,114,111,117,112,101,100,70,105,108,108,115,91,102,105,114,115,116,70,105,108,108,73,110,100,101,120,32,43,32,99,104,117,110,107,83,116,97,114,116,32,43,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,110,100,101,120,93,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,80,97,99,107,58,32,108,105,110,101,83,101,103,109,101,110,116,32,61,32,118,101,99,52,40,102,114,111,109,46,120,44,32,102,114,111,109,46,121,44,32,116,111,46,120,44,32,116,111,46,121,41,46,10,32,32,32,32,32,32,32,32,32,32,32,32,115,70,105,108,108,115,91,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,110,100,101,120,93,32,61,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,52,40,102,105,108,108,46,120,32,38,32,48,120,102,102,102,102,117,44,32,102,105,108,108,46,120,32,62,62,32,49,54,44,32,102,105,108,108,46,121,32,38,32,48,120,102,102,102,102,117,44,32,102,105,108,108,46,121,32,62,62,32,49,54,41,32,47,32,50,53,54,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,99,104,117,110,107,83,105,122,101,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,47,47,32,67,111,110,118,101,114,116,32,116,111,32,116,105,108,101,39,115,32,108,111,99,97,108,32,99,111,111,114,100,105,110,97,116,101,115,46,10,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,52,32,108,105,110,101,83,101,103,109,101,110,116,32,61,32,115,70,105,108,108,115,91,105,93,32,45,32,116,105,108,101,70,114,97,103,67,111,111,114,100,46,120,121,120,121,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,43,61,32,99,111,109,112,117,116,101,67,111,118,101,114,97,103,101,40,108,105,110,101,83,101,103,109,101,110,116,46,120,121,44,32,108,105,110,101,83,101,103,109,101,110,116,46,122,119,44,32,117,65,114,101,97,76,85,84,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,32,32,32,32,125,10,10,32,32,32,32,114,101,116,117,114,110,32,99,111,118,101,114,97,103,101,115,59,10,125,10,10,105,118,101,99,50,32,99,111,109,112,117,116,101,84,105,108,101,67,111,111,114,100,40,117,105,110,116,32,97,108,112,104,97,84,105,108,101,73,110,100,101,120,41,32,123,10,32,32,32,32,117,105,110,116,32,120,32,61,32,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,38,32,48,120,102,102,117,59,10,32,32,32,32,117,105,110,116,32,121,32,61,32,40,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,62,32,56,117,41,32,38,32,48,120,102,102,117,41,32,124,32,40,40,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,62,32,49,54,117,41,32,38,32,48,120,102,102,117,41,32,60,60,32,56,117,41,59,10,32,32,32,32,114,101,116,117,114,110,32,105,118,101,99,50,40,49,54,44,32,52,41,32,42,32,105,118,101,99,50,40,120,44,32,121,41,32,43,32,105,118,101,99,50,40,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,59,10,125,10,10,47,47,47,32,70,105,108,108,32,97,108,112,104,97,32,116,105,108,101,115,46,32,83,97,109,101,32,97,115,32,102,105,108,108,46,99,111,109,112,44,32,98,117,116,32,114,101,97,100,115,32,116,104,101,32,102,105,108,108,115,32,103,114,111,117,112,101,100,32,112,101,114,32,97,108,112,104,97,32,116,105,108,101,46,10,118,111,105,100,32,109,97,105,110,40,41,32,123,10,32,32,32,32,47,47,32,76,111,99,97,108,32,99,111,111,114,100,105,110,97,116,101,115,32,111,117,116,32,111,102,32,108,111,99,97,108,32,115,105,122,101,32,40,49,54,44,32,52,41,32,42,32,105,118,101,99,50,40,49,44,32,52,41,46,10,32,32,32,32,105,118,101,99,50,32,116,105,108,101,83,117,98,67,111,111,114,100,32,61,32,105,118,101,99,50,40,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,121,41,32,42,32,105,118,101,99,50,40,49,44,32,52,41,59,10,10,32,32,32,32,47,47,32,84,104,105,115,32,105,115,32,97,32,119,111,114,107,97,114,111,117,110,100,32,102,111,114,32,116,104,101,32,54,52,75,32,119,111,114,107,103,114,111,117,112,32,100,105,115,112,97,116,99,104,32,108,105,109,105,116,32,105,110,32,79,112,101,110,71,76,46,10,32,32,32,32,117,105,110,116,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,61,32,40,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,120,32,124,32,40,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,121,32,60,60,32,49,53,41,41,59,10,10,32,32,32,32,117,105,110,116,32,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,61,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,43,32,117,105,110,116,40,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,120,41,59,10,32,32,32,32,105,102,32,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,32,62,61,32,117,105,110,116,40,117,65,108,112,104,97,84,105,108,101,82,97,110,103,101,46,121,41,41,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,10,10,32,32,32,32,117,105,110,116,32,116,105,108,101,73,110,100,101,120,32,61,32,105,65,108,112,104,97,84,105,108,101,115,91,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,59,10,10,32,32,32,32,47,47,32,124,63,40,56,98,105,116,41,124,120,40,50,52,98,105,116,41,124,32,45,62,32,124,48,40,56,98,105,116,41,124,120,40,50,52,98,105,116,41,124,10,32,32,32,32,47,47,32,67,111,109,109,101,110,116,101,100,32,116,111,32,102,105,120,32,97,114,116,105,102,97,99,116,115,32,105,110,32,79,112,101,110,71,76,46,10,32,32,32,32,47,47,105,102,32,40,40,105,110,116,40,105,84,105,108,101,115,91,116,105,108,101,73,110,100,101,120,32,42,32,52,117,32,43,32,84,73,76,69,95,70,73,69,76,68,95,66,65,67,75,68,82,79,80,95,65,76,80,72,65,95,84,73,76,69,95,73,68,93,32,60,60,32,56,41,32,62,62,32,56,41,32,60,32,48,41,10,32,32,32,32,47,47,32,32,32,32,114,101,116,117,114,110,59,10,10,32,32,32,32,117,105,110,116,32,102,105,114,115,116,70,105,108,108,73,110,100,101,120,32,61,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,48,117,93,59,10,32,32,32,32,117,105,110,116,32,102,105,108,108,67,111,117,110,116,32,61,32,105,70,105,108,108,82,97,110,103,101,115,91,70,73,76,76,95,82,65,78,71,69,83,95,72,69,65,68,69,82,95,83,73,90,69,32,43,32,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,49,117,93,59,10,32,32,32,32,117,105,110,116,32,116,105,108,101,67,111,110,116,114,111,108,87,111,114,100,32,61,32,105,84,105,108,101,115,91,116,105,108,101,73,110,100,101,120,32,42,32,52,117,32,43,32,84,73,76,69,95,70,73,69,76,68,95,67,79,78,84,82,79,76,93,59,10,32,32,32,32,105,110,116,32,98,97,99,107,100,114,111,112,32,61,32,105,110,116,40,116,105,108,101,67,111,110,116,114,111,108,87,111,114,100,41,32,62,62,32,50,52,59,10,10,32,32,32,32,118,101,99,52,32,99,111,118,101,114,97,103,101,115,32,61,32,118,101,99,52,40,98,97,99,107,100,114,111,112,41,59,10,32,32,32,32,99,111,118,101,114,97,103,101,115,32,43,61,32,97,99,99,117,109,117,108,97,116,101,67,111,118,101,114,97,103,101,70,111,114,70,105,108,108,82,97,110,103,101,40,102,105,114,115,116,70,105,108,108,73,110,100,101,120,44,32,102,105,108,108,67,111,117,110,116,44,32,116,105,108,101,83,117,98,67,111,111,114,100,41,59,10,10,32,32,32,32,105,110,116,32,116,105,108,101,67,116,114,108,32,61,32,105,110,116,40,40,116,105,108,101,67,111,110,116,114,111,108,87,111,114,100,32,62,62,32,49,54,41,32,38,32,48,120,102,102,117,41,59,10,32,32,32,32,105,110,116,32,109,97,115,107,67,116,114,108,32,61,32,40,116,105,108,101,67,116,114,108,32,62,62,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,48,95,83,72,73,70,84,41,32,38,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,77,65,83,75,59,10,32,32,32,32,105,102,32,40,40,109,97,115,107,67,116,114,108,32,38,32,84,73,76,69,95,67,84,82,76,95,77,65,83,75,95,87,73,78,68,73,78,71,41,32,33,61,32,48,41,32,123,10,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,61,32,99,108,97,109,112,40,97,98,115,40,99,111,118,101,114,97,103,101,115,41,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,32,101,108,115,101,32,123,10,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,61,32,99,108,97,109,112,40,49,46,48,32,45,32,97,98,115,40,49,46,48,32,45,32,109,111,100,40,99,111,118,101,114,97,103,101,115,44,32,50,46,48,41,41,44,32,48,46,48,44,32,49,46,48,41,59,10,32,32,32,32,125,10,10,32,32,32,32,47,47,32,78,111,116,32,97,118,97,105,108,97,98,108,101,32,102,111,114,32,71,76,69,83,46,10,32,32,32,32,35,105,102,110,100,101,102,32,71,76,95,69,83,10,32,32,32,32,47,47,32,72,97,110,100,108,101,32,99,108,105,112,32,105,102,32,110,101,99,101,115,115,97,114,121,46,10,10,32,32,32,32,47,47,32,99,108,105,112,84,105,108,101,73,110,100,101,120,32,115,104,111,117,108,100,32,98,101,32,99,111,110,118,101,114,116,101,100,32,116,111,32,105,110,116,32,102,105,114,115,116,44,32,97,115,32,105,116,32,109,105,103,104,116,32,98,101,32,110,101,103,97,116,105,118,101,46,10,32,32,32,32,105,110,116,32,99,108,105,112,84,105,108,101,73,110,100,101,120,32,61,32,105,110,116,40,105,65,108,112,104,97,84,105,108,101,115,91,98,97,116,99,104,65,108,112,104,97,84,105,108,101,73,110,100,101,120,32,42,32,50,117,32,43,32,49,117,93,41,59,10,32,32,32,32,105,102,32,40,99,108,105,112,84,105,108,101,73,110,100,101,120,32,62,61,32,48,41,32,123,10,32,32,32,32,32,32,32,32,99,111,118,101,114,97,103,101,115,32,61,32,109,105,110,40,99,111,118,101,114,97,103,101,115,44,32,105,109,97,103,101,76,111,97,100,40,117,68,101,115,116,44,32,99,111,109,112,117,116,101,84,105,108,101,67,111,111,114,100,40,117,105,110,116,40,99,108,105,112,84,105,108,101,73,110,100,101,120,41,41,41,41,59,10,32,32,32,32,125,10,32,32,32,32,35,101,110,100,105,102,10,10,32,32,32,32,105,109,97,103,101,83,116,111,114,101,40,117,68,101,115,116,44,32,99,111,109,112,117,116,101,84,105,108,101,67,111,111,114,100,40,97,108,112,104,97,84,105,108,101,73,110,100,101,120,41,44,32,99,111,118,101,114,97,103,101,115,41,59,10,125,10};
+}
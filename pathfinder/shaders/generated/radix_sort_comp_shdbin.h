@@ -0,0 +1,5 @@
+#pragma once
+
+namespace Pathfinder {
+    static uint8_t radix_sort_comp_shdbin[] = {83,72,68,66,1,0,0,0,1,4,0,0,0,5,0,0,0,2,4,0,0,0,239,15,0,0,109,97,105,110,47,47,66,73,78,68,73,78,71,95,83,84,65,82,84,10,47,47,85,66,79,58,98,85,110,105,102,111,114,109,58,51,10,47,47,66,73,78,68,73,78,71,95,69,78,68,10,35,118,101,114,115,105,111,110,32,52,53,48,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,83,67,65,78,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,83,67,65,84,84,69,82,32,32,32,32,32,32,32,32,32,32,32,32,32,50,10,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,50,53,54,117,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,54,117,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,77,65,83,75,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,53,117,10,10,35,100,101,102,105,110,101,32,83,79,82,84,95,73,78,70,79,95,75,69,89,95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,52,117,10,10,47,47,32,79,110,101,32,112,97,115,115,32,111,102,32,97,32,115,116,97,98,108,101,32,76,83,68,32,114,97,100,105,120,32,115,111,114,116,32,111,118,101,114,32,52,45,98,105,116,32,100,105,103,105,116,115,46,10,47,47,32,65,32,112,97,115,115,32,114,117,110,115,32,105,110,32,116,104,114,101,101,32,100,105,115,112,97,116,99,104,101,115,58,32,99,111,117,110,116,32,100,105,103,105,116,115,32,112,101,114,32,119,111,114,107,103,114,111,117,112,44,32,115,99,97,110,32,116,104,101,32,104,105,115,116,111,103,114,97,109,115,44,32,115,99,97,116,116,101,114,32,107,101,121,115,46,10,108,97,121,111,117,116,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,117,110,105,102,111,114,109,32,98,85,110,105,102,111,114,109,32,123,10,32,32,32,32,105,110,116,32,117,77,111,100,101,59,10,32,32,32,32,47,47,32,48,32,115,111,114,116,115,32,98,121,32,120,44,32,49,32,115,111,114,116,115,32,98,121,32,121,46,10,32,32,32,32,105,110,116,32,117,75,101,121,67,111,109,112,111,110,101,110,116,59,10,32,32,32,32,105,110,116,32,117,68,105,103,105,116,83,104,105,102,116,59,10,32,32,32,32,47,47,32,87,111,114,107,103,114,111,117,112,115,32,111,102,32,116,104,101,32,99,111,117,110,116,32,97,110,100,32,115,99,97,116,116,101,114,32,100,105,115,112,97,116,99,104,101,115,46,10,32,32,32,32,105,110,116,32,117,71,114,111,117,112,67,111,117,110,116,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,98,117,102,102,101,114,32,98,83,114,99,75,101,121,115,32,123,10,32,32,32,32,117,118,101,99,50,32,105,83,114,99,75,101,121,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,98,117,102,102,101,114,32,98,68,115,116,75,101,121,115,32,123,10,32,32,32,32,117,118,101,99,50,32,105,68,115,116,75,101,121,115,91,93,59,10,125,59,10,10,114,101,115,116,114,105,99,116,32,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,98,117,102,102,101,114,32,98,83,111,114,116,73,110,102,111,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,107,101,121,32,99,111,117,110,116,10,32,32,32,32,47,47,32,91,52,46,46,93,58,32,100,105,103,105,116,32,99,111,117,110,116,115,44,32,116,104,101,110,32,111,102,102,115,101,116,115,44,32,108,97,105,100,32,111,117,116,32,100,105,103,105,116,32,98,121,32,100,105,103,105,116,32,97,110,100,32,119,111,114,107,103,114,111,117,112,32,98,121,32,119,111,114,107,103,114,111,117,112,10,32,32,32,32,117,105,110,116,32,105,83,111,114,116,73,110,102,111,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,41,32,105,110,59,10,10,115,104,97,114,101,100,32,117,105,110,116,32,115,68,105,103,105,116,67,111,117,110,116,115,91,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,93,59,10,115,104,97,114,101,100,32,117,105,110,116,32,115,86,97,108,117,101,115,91,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,93,59,10,10,117,105,110,116,32,103,101,116,68,105,103,105,116,40,117,118,101,99,50,32,107,101,121,41,32,123,10,32,32,32,32,117,105,110,116,32,118,97,108,117,101,32,61,32,117,75,101,121,67,111,109,112,111,110,101,110,116,32,61,61,32,48,32,63,32,107,101,121,46,120,32,58,32,107,101,121,46,121,59,10,32,32,32,32,114,101,116,117,114,110,32,40,118,97,108,117,101,32,62,62,32,117,105,110,116,40,117,68,105,103,105,116,83,104,105,102,116,41,41,32,38,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,77,65,83,75,59,10,125,10,10,117,105,110,116,32,104,105,115,116,111,103,114,97,109,73,110,100,101,120,40,117,105,110,116,32,100,105,103,105,116,44,32,117,105,110,116,32,103,114,111,117,112,73,110,100,101,120,41,32,123,10,32,32,32,32,114,101,116,117,114,110,32,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,100,105,103,105,116,32,42,32,117,105,110,116,40,117,71,114,111,117,112,67,111,117,110,116,41,32,43,32,103,114,111,117,112,73,110,100,101,120,59,10,125,10,10,118,111,105,100,32,99,111,117,110,116,68,105,103,105,116,115,40,41,32,123,10,32,32,32,32,117,105,110,116,32,108,111,99,97,108,73,110,100,101,120,32,61,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,117,105,110,116,32,107,101,121,73,110,100,101,120,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,10,32,32,32,32,105,102,32,40,108,111,99,97,108,73,110,100,101,120,32,60,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,41,32,115,68,105,103,105,116,67,111,117,110,116,115,91,108,111,99,97,108,73,110,100,101,120,93,32,61,32,48,117,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,107,101,121,73,110,100,101,120,32,60,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,75,69,89,95,67,79,85,78,84,93,41,32,97,116,111,109,105,99,65,100,100,40,115,68,105,103,105,116,67,111,117,110,116,115,91,103,101,116,68,105,103,105,116,40,105,83,114,99,75,101,121,115,91,107,101,121,73,110,100,101,120,93,41,93,44,32,49,117,41,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,108,111,99,97,108,73,110,100,101,120,32,60,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,41,32,123,10,32,32,32,32,32,32,32,32,105,83,111,114,116,73,110,102,111,91,104,105,115,116,111,103,114,97,109,73,110,100,101,120,40,108,111,99,97,108,73,110,100,101,120,44,32,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,120,41,93,32,61,32,115,68,105,103,105,116,67,111,117,110,116,115,91,108,111,99,97,108,73,110,100,101,120,93,59,10,32,32,32,32,125,10,125,10,10,47,47,32,82,117,110,115,32,105,110,32,97,32,115,105,110,103,108,101,32,119,111,114,107,103,114,111,117,112,46,32,84,117,114,110,115,32,116,104,101,32,100,105,103,105,116,32,99,111,117,110,116,115,32,105,110,116,111,32,101,120,99,108,117,115,105,118,101,32,111,102,102,115,101,116,115,32,105,110,32,116,104,101,32,100,101,115,116,105,110,97,116,105,111,110,46,10,118,111,105,100,32,115,99,97,110,72,105,115,116,111,103,114,97,109,115,40,41,32,123,10,32,32,32,32,117,105,110,116,32,108,111,99,97,108,73,110,100,101,120,32,61,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,10,32,32,32,32,117,105,110,116,32,101,110,116,114,121,67,111,117,110,116,32,61,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,32,42,32,117,105,110,116,40,117,71,114,111,117,112,67,111,117,110,116,41,59,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,105,122,101,32,61,32,40,101,110,116,114,121,67,111,117,110,116,32,43,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,32,45,32,49,117,41,32,47,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,59,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,116,97,114,116,32,61,32,109,105,110,40,108,111,99,97,108,73,110,100,101,120,32,42,32,99,104,117,110,107,83,105,122,101,44,32,101,110,116,114,121,67,111,117,110,116,41,59,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,69,110,100,32,61,32,109,105,110,40,99,104,117,110,107,83,116,97,114,116,32,43,32,99,104,117,110,107,83,105,122,101,44,32,101,110,116,114,121,67,111,117,110,116,41,59,10,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,117,109,32,61,32,48,117,59,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,99,104,117,110,107,83,116,97,114,116,59,32,105,32,60,32,99,104,117,110,107,69,110,100,59,32,105,43,43,41,32,99,104,117,110,107,83,117,109,32,43,61,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,105,93,59,10,32,32,32,32,115,86,97,108,117,101,115,91,108,111,99,97,108,73,110,100,101,120,93,32,61,32,99,104,117,110,107,83,117,109,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,108,111,99,97,108,73,110,100,101,120,32,61,61,32,48,117,41,32,123,10,32,32,32,32,32,32,32,32,117,105,110,116,32,111,102,102,115,101,116,32,61,32,48,117,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,32,115,117,109,32,61,32,115,86,97,108,117,101,115,91,105,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,115,86,97,108,117,101,115,91,105,93,32,61,32,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,61,32,115,117,109,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,117,105,110,116,32,111,102,102,115,101,116,32,61,32,115,86,97,108,117,101,115,91,108,111,99,97,108,73,110,100,101,120,93,59,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,99,104,117,110,107,83,116,97,114,116,59,32,105,32,60,32,99,104,117,110,107,69,110,100,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,117,105,110,116,32,99,111,117,110,116,32,61,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,105,93,59,10,32,32,32,32,32,32,32,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,105,93,32,61,32,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,61,32,99,111,117,110,116,59,10,32,32,32,32,125,10,125,10,10,118,111,105,100,32,115,99,97,116,116,101,114,75,101,121,115,40,41,32,123,10,32,32,32,32,117,105,110,116,32,108,111,99,97,108,73,110,100,101,120,32,61,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,117,105,110,116,32,107,101,121,73,110,100,101,120,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,98,111,111,108,32,118,97,108,105,100,32,61,32,107,101,121,73,110,100,101,120,32,60,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,75,69,89,95,67,79,85,78,84,93,59,10,10,32,32,32,32,117,118,101,99,50,32,107,101,121,32,61,32,118,97,108,105,100,32,63,32,105,83,114,99,75,101,121,115,91,107,101,121,73,110,100,101,120,93,32,58,32,117,118,101,99,50,40,48,117,41,59,10,32,32,32,32,117,105,110,116,32,100,105,103,105,116,32,61,32,118,97,108,105,100,32,63,32,103,101,116,68,105,103,105,116,40,107,101,121,41,32,58,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,59,10,10,32,32,32,32,115,86,97,108,117,101,115,91,108,111,99,97,108,73,110,100,101,120,93,32,61,32,100,105,103,105,116,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,33,118,97,108,105,100,41,32,114,101,116,117,114,110,59,10,10,32,32,32,32,47,47,32,75,101,121,115,32,119,105,116,104,32,116,104,101,32,115,97,109,101,32,100,105,103,105,116,32,107,101,101,112,32,116,104,101,105,114,32,111,114,100,101,114,44,32,119,104,105,99,104,32,109,97,107,101,115,32,116,104,101,32,115,111,114,116,32,115,116,97,98,108,101,46,10,32,32,32,32,117,105,110,116,32,114,97,110,107,32,61,32,48,117,59,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,108,111,99,97,108,73,110,100,101,120,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,105,102,32,40,115,86,97,108,117,101,115,91,105,93,32,61,61,32,100,105,103,105,116,41,32,114,97,110,107,43,43,59,10,32,32,32,32,125,10,10,32,32,32,32,105,68,115,116,75,101,121,115,91,105,83,111,114,116,73,110,102,111,91,104,105,115,116,111,103,114,97,109,73,110,100,101,120,40,100,105,103,105,116,44,32,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,120,41,93,32,43,32,114,97,110,107,93,32,61,32,107,101,121,59,10,125,10,10,118,111,105,100,32,109,97,105,110,40,41,32,123,10,32,32,32,32,105,102,32,40,117,77,111,100,101,32,61,61,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,67,79,85,78,84,41,32,123,10,32,32,32,32,32,32,32,32,99,111,117,110,116,68,105,103,105,116,115,40,41,59,10,32,32,32,32,125,32,101,108,115,101,32,105,102,32,40,117,77,111,100,101,32,61,61,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,83,67,65,78,41,32,123,10,32,32,32,32,32,32,32,32,115,99,97,110,72,105,115,116,111,103,114,97,109,115,40,41,59,10,32,32,32,32,125,32,101,108,115,101,32,123,10,32,32,32,32,32,32,32,32,115,99,97,116,116,101,114,75,101,121,115,40,41,59,10,32,32,32,32,125,10,125,10,83,72,68,66,1,0,0,0,4,3,0,0,0,1,0,0,0,2,4,0,0,0,242,15,0,0,109,97,105,110,47,47,66,73,78,68,73,78,71,95,83,84,65,82,84,10,47,47,85,66,79,58,98,85,110,105,102,111,114,109,58,51,10,47,47,66,73,78,68,73,78,71,95,69,78,68,10,35,118,101,114,115,105,111,110,32,51,49,48,32,101,115,10,10,112,114,101,99,105,115,105,111,110,32,104,105,103,104,112,32,102,108,111,97,116,59,10,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,83,67,65,78,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,83,67,65,84,84,69,82,32,32,32,32,32,32,32,32,32,32,32,32,32,50,10,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,32,32,32,32,32,32,32,32,32,32,32,50,53,54,117,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,54,117,10,35,100,101,102,105,110,101,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,77,65,83,75,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,53,117,10,10,35,100,101,102,105,110,101,32,83,79,82,84,95,73,78,70,79,95,75,69,89,95,67,79,85,78,84,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,117,10,35,100,101,102,105,110,101,32,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,52,117,10,10,47,47,32,79,110,101,32,112,97,115,115,32,111,102,32,97,32,115,116,97,98,108,101,32,76,83,68,32,114,97,100,105,120,32,115,111,114,116,32,111,118,101,114,32,52,45,98,105,116,32,100,105,103,105,116,115,46,10,47,47,32,65,32,112,97,115,115,32,114,117,110,115,32,105,110,32,116,104,114,101,101,32,100,105,115,112,97,116,99,104,101,115,58,32,99,111,117,110,116,32,100,105,103,105,116,115,32,112,101,114,32,119,111,114,107,103,114,111,117,112,44,32,115,99,97,110,32,116,104,101,32,104,105,115,116,111,103,114,97,109,115,44,32,115,99,97,116,116,101,114,32,107,101,121,115,46,10,108,97,121,111,117,116,40,115,116,100,49,52,48,44,32,98,105,110,100,105,110,103,32,61,32,51,41,32,117,110,105,102,111,114,109,32,98,85,110,105,102,111,114,109,32,123,10,32,32,32,32,105,110,116,32,117,77,111,100,101,59,10,32,32,32,32,47,47,32,48,32,115,111,114,116,115,32,98,121,32,120,44,32,49,32,115,111,114,116,115,32,98,121,32,121,46,10,32,32,32,32,105,110,116,32,117,75,101,121,67,111,109,112,111,110,101,110,116,59,10,32,32,32,32,105,110,116,32,117,68,105,103,105,116,83,104,105,102,116,59,10,32,32,32,32,47,47,32,87,111,114,107,103,114,111,117,112,115,32,111,102,32,116,104,101,32,99,111,117,110,116,32,97,110,100,32,115,99,97,116,116,101,114,32,100,105,115,112,97,116,99,104,101,115,46,10,32,32,32,32,105,110,116,32,117,71,114,111,117,112,67,111,117,110,116,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,98,83,114,99,75,101,121,115,32,123,10,32,32,32,32,117,118,101,99,50,32,105,83,114,99,75,101,121,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,49,41,32,114,101,115,116,114,105,99,116,32,119,114,105,116,101,111,110,108,121,32,98,117,102,102,101,114,32,98,68,115,116,75,101,121,115,32,123,10,32,32,32,32,117,118,101,99,50,32,105,68,115,116,75,101,121,115,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,115,116,100,52,51,48,44,32,98,105,110,100,105,110,103,32,61,32,50,41,32,114,101,115,116,114,105,99,116,32,98,117,102,102,101,114,32,98,83,111,114,116,73,110,102,111,32,123,10,32,32,32,32,47,47,32,91,48,93,58,32,107,101,121,32,99,111,117,110,116,10,32,32,32,32,47,47,32,91,52,46,46,93,58,32,100,105,103,105,116,32,99,111,117,110,116,115,44,32,116,104,101,110,32,111,102,102,115,101,116,115,44,32,108,97,105,100,32,111,117,116,32,100,105,103,105,116,32,98,121,32,100,105,103,105,116,32,97,110,100,32,119,111,114,107,103,114,111,117,112,32,98,121,32,119,111,114,107,103,114,111,117,112,10,32,32,32,32,117,105,110,116,32,105,83,111,114,116,73,110,102,111,91,93,59,10,125,59,10,10,108,97,121,111,117,116,40,108,111,99,97,108,95,115,105,122,101,95,120,32,61,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,41,32,105,110,59,10,10,115,104,97,114,101,100,32,117,105,110,116,32,115,68,105,103,105,116,67,111,117,110,116,115,91,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,93,59,10,115,104,97,114,101,100,32,117,105,110,116,32,115,86,97,108,117,101,115,91,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,93,59,10,10,117,105,110,116,32,103,101,116,68,105,103,105,116,40,117,118,101,99,50,32,107,101,121,41,32,123,10,32,32,32,32,117,105,110,116,32,118,97,108,117,101,32,61,32,117,75,101,121,67,111,109,112,111,110,101,110,116,32,61,61,32,48,32,63,32,107,101,121,46,120,32,58,32,107,101,121,46,121,59,10,32,32,32,32,114,101,116,117,114,110,32,40,118,97,108,117,101,32,62,62,32,117,105,110,116,40,117,68,105,103,105,116,83,104,105,102,116,41,41,32,38,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,77,65,83,75,59,10,125,10,10,117,105,110,116,32,104,105,115,116,111,103,114,97,109,73,110,100,101,120,40,117,105,110,116,32,100,105,103,105,116,44,32,117,105,110,116,32,103,114,111,117,112,73,110,100,101,120,41,32,123,10,32,32,32,32,114,101,116,117,114,110,32,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,100,105,103,105,116,32,42,32,117,105,110,116,40,117,71,114,111,117,112,67,111,117,110,116,41,32,43,32,103,114,111,117,112,73,110,100,101,120,59,10,125,10,10,118,111,105,100,32,99,111,117,110,116,68,105,103,105,116,115,40,41,32,123,10,32,32,32,32,117,105,110,116,32,108,111,99,97,108,73,110,100,101,120,32,61,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,117,105,110,116,32,107,101,121,73,110,100,101,120,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,10,32,32,32,32,105,102,32,40,108,111,99,97,108,73,110,100,101,120,32,60,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,41,32,115,68,105,103,105,116,67,111,117,110,116,115,91,108,111,99,97,108,73,110,100,101,120,93,32,61,32,48,117,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,107,101,121,73,110,100,101,120,32,60,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,75,69,89,95,67,79,85,78,84,93,41,32,97,116,111,109,105,99,65,100,100,40,115,68,105,103,105,116,67,111,117,110,116,115,91,103,101,116,68,105,103,105,116,40,105,83,114,99,75,101,121,115,91,107,101,121,73,110,100,101,120,93,41,93,44,32,49,117,41,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,108,111,99,97,108,73,110,100,101,120,32,60,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,41,32,123,10,32,32,32,32,32,32,32,32,105,83,111,114,116,73,110,102,111,91,104,105,115,116,111,103,114,97,109,73,110,100,101,120,40,108,111,99,97,108,73,110,100,101,120,44,32,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,120,41,93,32,61,32,115,68,105,103,105,116,67,111,117,110,116,115,91,108,111,99,97,108,73,110,100,101,120,93,59,10,32,32,32,32,125,10,125,10,10,47,47,32,82,117,110,115,32,105,110,32,97,32,115,105,110,103,108,101,32,119,111,114,107,103,114,111,117,112,46,32,84,117,114,110,115,32,116,104,101,32,100,105,103,105,116,32,99,111,117,110,116,115,32,105,110,116,111,32,101,120,99,108,117,115,105,118,101,32,111,102,102,115,101,116,115,32,105,110,32,116,104,101,32,100,101,115,116,105,110,97,116,105,111,110,46,10,118,111,105,100,32,115,99,97,110,72,105,115,116,111,103,114,97,109,115,40,41,32,123,10,32,32,32,32,117,105,110,116,32,108,111,99,97,108,73,110,100,101,120,32,61,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,10,32,32,32,32,117,105,110,116,32,101,110,116,114,121,67,111,117,110,116,32,61,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,32,42,32,117,105,110,116,40,117,71,114,111,117,112,67,111,117,110,116,41,59,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,105,122,101,32,61,32,40,101,110,116,114,121,67,111,117,110,116,32,43,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,32,45,32,49,117,41,32,47,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,59,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,116,97,114,116,32,61,32,109,105,110,40,108,111,99,97,108,73,110,100,101,120,32,42,32,99,104,117,110,107,83,105,122,101,44,32,101,110,116,114,121,67,111,117,110,116,41,59,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,69,110,100,32,61,32,109,105,110,40,99,104,117,110,107,83,116,97,114,116,32,43,32,99,104,117,110,107,83,105,122,101,44,32,101,110,116,114,121,67,111,117,110,116,41,59,10,10,32,32,32,32,117,105,110,116,32,99,104,117,110,107,83,117,109,32,61,32,48,117,59,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,99,104,117,110,107,83,116,97,114,116,59,32,105,32,60,32,99,104,117,110,107,69,110,100,59,32,105,43,43,41,32,99,104,117,110,107,83,117,109,32,43,61,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,105,93,59,10,32,32,32,32,115,86,97,108,117,101,115,91,108,111,99,97,108,73,110,100,101,120,93,32,61,32,99,104,117,110,107,83,117,109,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,108,111,99,97,108,73,110,100,101,120,32,61,61,32,48,117,41,32,123,10,32,32,32,32,32,32,32,32,117,105,110,116,32,111,102,102,115,101,116,32,61,32,48,117,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,82,65,68,73,88,95,83,79,82,84,95,87,79,82,75,71,82,79,85,80,95,83,73,90,69,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,117,105,110,116,32,115,117,109,32,61,32,115,86,97,108,117,101,115,91,105,93,59,10,32,32,32,32,32,32,32,32,32,32,32,32,115,86,97,108,117,101,115,91,105,93,32,61,32,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,61,32,115,117,109,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,117,105,110,116,32,111,102,102,115,101,116,32,61,32,115,86,97,108,117,101,115,91,108,111,99,97,108,73,110,100,101,120,93,59,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,99,104,117,110,107,83,116,97,114,116,59,32,105,32,60,32,99,104,117,110,107,69,110,100,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,117,105,110,116,32,99,111,117,110,116,32,61,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,105,93,59,10,32,32,32,32,32,32,32,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,72,73,83,84,79,71,82,65,77,83,32,43,32,105,93,32,61,32,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,61,32,99,111,117,110,116,59,10,32,32,32,32,125,10,125,10,10,118,111,105,100,32,115,99,97,116,116,101,114,75,101,121,115,40,41,32,123,10,32,32,32,32,117,105,110,116,32,108,111,99,97,108,73,110,100,101,120,32,61,32,103,108,95,76,111,99,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,117,105,110,116,32,107,101,121,73,110,100,101,120,32,61,32,103,108,95,71,108,111,98,97,108,73,110,118,111,99,97,116,105,111,110,73,68,46,120,59,10,32,32,32,32,98,111,111,108,32,118,97,108,105,100,32,61,32,107,101,121,73,110,100,101,120,32,60,32,105,83,111,114,116,73,110,102,111,91,83,79,82,84,95,73,78,70,79,95,75,69,89,95,67,79,85,78,84,93,59,10,10,32,32,32,32,117,118,101,99,50,32,107,101,121,32,61,32,118,97,108,105,100,32,63,32,105,83,114,99,75,101,121,115,91,107,101,121,73,110,100,101,120,93,32,58,32,117,118,101,99,50,40,48,117,41,59,10,32,32,32,32,117,105,110,116,32,100,105,103,105,116,32,61,32,118,97,108,105,100,32,63,32,103,101,116,68,105,103,105,116,40,107,101,121,41,32,58,32,82,65,68,73,88,95,83,79,82,84,95,68,73,71,73,84,95,67,79,85,78,84,59,10,10,32,32,32,32,115,86,97,108,117,101,115,91,108,111,99,97,108,73,110,100,101,120,93,32,61,32,100,105,103,105,116,59,10,32,32,32,32,98,97,114,114,105,101,114,40,41,59,10,10,32,32,32,32,105,102,32,40,33,118,97,108,105,100,41,32,114,101,116,117,114,110,59,10,10,32,32,32,32,47,47,32,75,101,121,115,32,119,105,116,104,32,116,104,101,32,115,97,109,101,32,100,105,103,105,116,32,107,101,101,112,32,116,104,101,105,114,32,111,114,100,101,114,44,32,119,104,105,99,104,32,109,97,107,101,115,32,116,104,101,32,115,111,114,116,32,115,116,97,98,108,101,46,10,32,32,32,32,117,105,110,116,32,114,97,110,107,32,61,32,48,117,59,10,32,32,32,32,102,111,114,32,40,117,105,110,116,32,105,32,61,32,48,117,59,32,105,32,60,32,108,111,99,97,108,73,110,100,101,120,59,32,105,43,43,41,32,123,10,32,32,32,32,32,32,32,32,105,102,32,40,115,86,97,108,117,101,115,91,105,93,32,61,61,32,100,105,103,105,116,41,32,114,97,110,107,43,43,59,10,32,32,32,32,125,10,10,32,32,32,32,105,68,115,116,75,101,121,115,91,105,83,111,114,116,73,110,102,111,91,104,105,115,116,111,103,114,97,109,73,110,100,101,120,40,100,105,103,105,116,44,32,103,108,95,87,111,114,107,71,114,111,117,112,73,68,46,120,41,93,32,43,32,114,97,110,107,93,32,61,32,107,101,121,59,10,125,10,10,118,111,105,100,32,109,97,105,110,40,41,32,123,10,32,32,32,32,105,102,32,40,117,77,111,100,101,32,61,61,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,67,79,85,78,84,41,32,123,10,32,32,32,32,32,32,32,32,99,111,117,110,116,68,105,103,105,116,115,40,41,59,10,32,32,32,32,125,32,101,108,115,101,32,105,102,32,40,117,77,111,100,101,32,61,61,32,82,65,68,73,88,95,83,79,82,84,95,77,79,68,69,95,83,67,65,78,41,32,123,10,32,32,32,32,32,32,32,32,115,99,97,110,72,105,115,116,111,103,114,97,109,115,40,41,59,10,32,32,32,32,125,32,101,108,115,101,32,123,10,32,32,32,32,32,32,32,32,115,99,97,116,116,101,114,75,101,121,115,40,41,59,10,32,32,32,32,125,10,125,10};
+}